@@ -38,6 +38,7 @@ class Channel : public Factory
     bool complex = false;
     int seed = 0;
     int gain_occur = 1;
+    float is_scale = 1.f; // scale of the noise standard deviation for the importance sampling (1 = disabled)
 
     // -------------------------------------------------------------------------------------------------------- METHODS
     explicit Channel(const std::string& p = Channel_prefix);
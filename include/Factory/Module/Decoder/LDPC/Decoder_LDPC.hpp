@@ -40,6 +40,7 @@ class Decoder_LDPC : public Decoder
     bool enable_syndrome = true;
     int syndrome_depth = 1;
     int n_ite = 10;
+    int dec_granularity = 0; // number of non zero padded information bits, no zero padding if 0
 
     std::vector<float> ppbf_proba;
 
@@ -63,6 +64,16 @@ class Decoder_LDPC : public Decoder
     module::Decoder_SISO<B, Q>* build_siso(const tools::Sparse_matrix& H,
                                            const std::vector<unsigned>& info_bits_pos,
                                            module::Encoder<B>* encoder = nullptr) const;
+
+  private:
+    // build the decoder of the code shortened to 'dec_granularity' information bits with 'build_dec' and wrap it in a
+    // zero padding decoder
+    template<typename B, typename Q, class D>
+    module::Decoder_SISO<B, Q>* build_zero_padding(const tools::Sparse_matrix& H,
+                                                   const std::vector<unsigned>& info_bits_pos,
+                                                   D* (Decoder_LDPC::*build_dec)(const tools::Sparse_matrix&,
+                                                                                 const std::vector<unsigned>&,
+                                                                                 module::Encoder<B>*) const) const;
 };
 }
 }
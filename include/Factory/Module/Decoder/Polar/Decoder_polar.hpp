@@ -34,6 +34,9 @@ class Decoder_polar : public Decoder
     int n_ite = 1;
     int L = 8;
     int T = 8;
+    int dscf_order = 2;
+    float dscf_alpha = 0.3f;
+    std::string cache_path = "";
 
     // -------------------------------------------------------------------------------------------------------- METHODS
     explicit Decoder_polar(const std::string& p = Decoder_polar_prefix);
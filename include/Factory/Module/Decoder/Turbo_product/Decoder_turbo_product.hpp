@@ -41,6 +41,7 @@ class Decoder_turbo_product : public Decoder
     std::vector<float> alpha;
     std::vector<float> beta;
     std::vector<float> cp_coef;
+    int n_threads = 1;
 
     // depending parameters
     tools::auto_cloned_unique_ptr<Decoder_BCH> sub;
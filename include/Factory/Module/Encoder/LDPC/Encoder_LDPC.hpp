@@ -36,6 +36,9 @@ class Encoder_LDPC : public Encoder
     std::string G_method = "IDENTITY";
     std::string G_save_path = "";
 
+    // folder of the cached inv(H2) and G matrices
+    std::string cache_path = "";
+
     // -------------------------------------------------------------------------------------------------------- METHODS
     explicit Encoder_LDPC(const std::string& p = Encoder_LDPC_prefix);
     virtual ~Encoder_LDPC() = default;
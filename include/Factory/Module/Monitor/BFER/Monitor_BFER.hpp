@@ -32,6 +32,7 @@ class Monitor_BFER : public Monitor
     int err_hist = -1;
     int n_frame_errors = 100;
     int max_frame = 0;
+    int dec_granularity = 0;
 
     // -------------------------------------------------------------------------------------------------------- METHODS
     explicit Monitor_BFER(const std::string& p = Monitor_BFER_prefix);
@@ -32,6 +32,9 @@ class Frozenbits_generator : public Factory
     std::string path_fb = "conf/cde/awgn_polar_codes/TV";
     std::string path_pb = "../lib/polar_bounds/bin/polar_bounds";
     std::string dump_channels_path = "";
+    std::string cache_path = "";
+    std::string tv_channel = "AWGN";
+    int tv_mu = 32;
     float noise = -1.f;
 
     // -------------------------------------------------------------------------------------------------------- METHODS
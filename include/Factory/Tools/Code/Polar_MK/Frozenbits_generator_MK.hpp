@@ -32,6 +32,7 @@ class Frozenbits_generator_MK : public Factory
     std::string type = "GA";
     std::string path_fb = "../conf/cde/awgn_polar_codes/TV";
     std::string dump_channels_path = "";
+    std::string cache_path = "";
     float noise = -1.f;
 
     // -------------------------------------------------------------------------------------------------------- METHODS
@@ -30,6 +30,9 @@ class Noise : public Factory
     // optional parameters
     std::string type = "EBN0";
     std::string pdf_path = "";
+    float adapt_fer = 0.f;
+    float adapt_step = 0.05f;
+    float adapt_dec = 0.5f;
 
     // -------------------------------------------------------------------------------------------------------- METHODS
     explicit Noise(const std::string& p = Noise_prefix);
@@ -5,6 +5,7 @@
 #ifndef CRC_POLYNOMIAL_HPP_
 #define CRC_POLYNOMIAL_HPP_
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <tuple>
@@ -20,9 +21,9 @@ template<typename B = int>
 class CRC_polynomial : public CRC<B>
 {
   protected:
-    const static std::map<std::string, std::tuple<unsigned, int>> known_polynomials;
+    const static std::map<std::string, std::tuple<uint64_t, int>> known_polynomials;
     std::vector<B> polynomial;
-    unsigned polynomial_packed;
+    uint64_t polynomial_packed;
     std::vector<B> buff_crc;
 
   public:
@@ -32,7 +33,7 @@ class CRC_polynomial : public CRC<B>
 
     static int get_size(const std::string& poly_key);
     static std::string get_name(const std::string& poly_key);
-    static unsigned get_value(const std::string& poly_key);
+    static uint64_t get_value(const std::string& poly_key);
 
     virtual void set_n_frames(const size_t n_frames);
 
@@ -6,7 +6,10 @@ namespace module
 {
 // database from here: https://en.wikipedia.org/wiki/Cyclic_redundancy_check#Commonly_used_and_standardized_CRCs
 template<typename B>
-const std::map<std::string, std::tuple<unsigned, int>> CRC_polynomial<B>::known_polynomials = {
+const std::map<std::string, std::tuple<uint64_t, int>> CRC_polynomial<B>::known_polynomials = {
+    { "64-ECMA", std::make_tuple(0x42F0E1EBA9EA3693, 64) },
+    { "64-ISO", std::make_tuple(0x000000000000001B, 64) },
+    { "40-GSM", std::make_tuple(0x0004820009, 40) },
     { "32-GZIP", std::make_tuple(0x04C11DB7, 32) },
     { "32-CASTAGNOLI", std::make_tuple(0x1EDC6F41, 32) },
     { "32-AIXM", std::make_tuple(0x814141AB, 32) },
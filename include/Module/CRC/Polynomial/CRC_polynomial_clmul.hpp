@@ -0,0 +1,81 @@
+/*!
+ * \file
+ * \brief Class module::CRC_polynomial_clmul.
+ */
+#ifndef CRC_POLYNOMIAL_CLMUL_HPP_
+#define CRC_POLYNOMIAL_CLMUL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Module/CRC/Polynomial/CRC_polynomial.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class CRC_polynomial_clmul
+ *
+ * \brief CRC of up to 64 bits computed on packed bits with carry-less multiplications.
+ *
+ * The CRC is computed in a reflected 64-bit register whatever its size (the polynomial is multiplied by
+ * \f$x^{64 - size}\f$, the CRC is in the 'size' LSBs of the register). The blocks of 16 bytes are folded with the
+ * PCLMULQDQ instruction when the CPU supports it (detected at runtime), the remaining bytes are processed with
+ * slicing-by-16 tables. The tables are used for all the bytes on the other CPUs.
+ *
+ * Several frames can be checked in one pass ('check_frames'): they are packed together and the carry-less
+ * multiplications of 4 frames are interleaved, this hides the latency of the PCLMULQDQ instruction even when a frame
+ * is too short to be split over several accumulators.
+ */
+template<typename B = int>
+class CRC_polynomial_clmul : public CRC_polynomial<B>
+{
+  protected:
+    uint64_t polynomial_packed_rev;
+    std::vector<uint64_t> lut_crc64; // 16 tables of 256 entries: 'lut_crc64[j * 256 + b]' is the CRC of the byte 'b'
+                                     // followed by 'j' zero bytes
+    uint64_t fold_128[2];            // constants to fold a block of 128 bits over the next block
+    uint64_t fold_512[2];            // constants to fold a block of 128 bits over the 4th next block
+    bool use_clmul;
+    std::vector<uint8_t> buff_frames; // packed information bits of the frames checked by 'check_frames'
+
+  public:
+    CRC_polynomial_clmul(const int K, const std::string& poly_key, const int size = 0);
+    virtual ~CRC_polynomial_clmul() = default;
+    virtual CRC_polynomial_clmul<B>* clone() const;
+
+    /*!
+     * \brief Checks the CRC of several frames in one packed pass, without the task machinery of the 'check' method.
+     *
+     * \param V_K:      the frames (information bits plus CRC bits, 'K + size' bits per frame) one after the other.
+     * \param n_frames: number of frames in 'V_K'.
+     * \param is_valid: 'is_valid[f]' is set to true when the CRC of the frame 'f' is verified.
+     *
+     * \return the number of frames with a verified CRC.
+     */
+    size_t check_frames(const B* V_K, const size_t n_frames, bool* is_valid);
+
+    /*!
+     * \brief Tells if the carry-less multiplications are used (depends on the CPU).
+     */
+    bool is_clmul() const;
+
+  protected:
+    virtual void _build(const B* U_K1, B* U_K2, const size_t frame_id);
+    virtual bool _check(const B* V_K, const size_t frame_id);
+    virtual bool _check_packed(const B* V_K, const size_t frame_id);
+
+    uint64_t compute_crc(const uint8_t* data, const int n_bits) const;
+
+  private:
+    uint64_t compute_crc_lut(const uint8_t* data, size_t n_bytes, uint64_t crc) const;
+    uint64_t compute_crc_end(const uint8_t* data, const int n_bits, const size_t n_done, uint64_t crc) const;
+    bool check_crc_bits(const B* V_K, const uint64_t crc) const;
+};
+}
+}
+
+#endif /* CRC_POLYNOMIAL_CLMUL_HPP_ */
@@ -19,16 +19,21 @@ class Channel_AWGN_LLR : public Channel<R>
 {
   private:
     const bool add_users;
+    const float is_scale; // scale of the standard deviation of the noise drawn by the 'add_noise_is' task
     std::shared_ptr<tools::Gaussian_gen<R>> gaussian_generator;
 
   public:
-    Channel_AWGN_LLR(const int N, const tools::Gaussian_gen<R>& noise_generator, const bool add_users = false);
+    Channel_AWGN_LLR(const int N,
+                     const tools::Gaussian_gen<R>& noise_generator,
+                     const bool add_users = false,
+                     const float is_scale = 1.f);
 
     explicit Channel_AWGN_LLR(
       const int N,
       const tools::Gaussian_noise_generator_implem implem = tools::Gaussian_noise_generator_implem::STD,
       const int seed = 0,
-      const bool add_users = false);
+      const bool add_users = false,
+      const float is_scale = 1.f);
 
     virtual ~Channel_AWGN_LLR() = default;
 
@@ -36,8 +41,14 @@ class Channel_AWGN_LLR : public Channel<R>
 
     void set_seed(const int seed);
 
+    float get_is_scale() const;
+
   protected:
     void _add_noise(const float* CP, const R* X_N, R* Y_N, const size_t frame_id);
+    void _add_noise_is(const float* CP, const R* X_N, R* Y_N, double* W, const size_t frame_id);
+
+    // draws the noise of one frame with the 'sigma' standard deviation (n_frames_per_wave = 1)
+    void add_gaussian_noise(const R sigma, const R* X_N, R* Y_N, const size_t frame_id);
 
     virtual void deep_copy(const Channel_AWGN_LLR<R>& m);
 };
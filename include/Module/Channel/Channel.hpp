@@ -23,6 +23,7 @@ enum class tsk : size_t
 {
     add_noise,
     add_noise_wg,
+    add_noise_is,
     SIZE
 };
 
@@ -43,6 +44,14 @@ enum class add_noise_wg : size_t
     Y_N,
     status
 };
+enum class add_noise_is : size_t
+{
+    CP,
+    X_N,
+    Y_N,
+    W,
+    status
+};
 }
 }
 
@@ -64,6 +73,7 @@ class Channel
     inline spu::runtime::Task& operator[](const chn::tsk t);
     inline spu::runtime::Socket& operator[](const chn::sck::add_noise s);
     inline spu::runtime::Socket& operator[](const chn::sck::add_noise_wg s);
+    inline spu::runtime::Socket& operator[](const chn::sck::add_noise_is s);
 
   protected:
     const int N;                // Size of one frame (= number of bits in one frame)
@@ -129,6 +139,34 @@ class Channel
                       const int frame_id = -1,
                       const bool managed_memory = true);
 
+    /*!
+     * \brief Task method that adds the noise drawn from a biased distribution (importance sampling).
+     *
+     * \param X_N: a perfectly clear message.
+     * \param Y_N: a noisy signal.
+     * \param W:   the likelihood ratio of each frame (probability of the noise with the real distribution divided by
+     *             its probability with the biased distribution).
+     */
+    template<class A = std::allocator<R>>
+    void add_noise_is(const std::vector<float, A>& CP,
+                      const std::vector<R, A>& X_N,
+                      std::vector<R, A>& Y_N,
+                      std::vector<double>& W,
+                      const int frame_id = -1,
+                      const bool managed_memory = true);
+
+    void add_noise_is(const float* CP,
+                      const R* X_N,
+                      R* Y_N,
+                      double* W,
+                      const int frame_id = -1,
+                      const bool managed_memory = true);
+
+    /*!
+     * \brief Sets the zero padding of the frames (one symbol per bit): the 'dec_granularity' first bits are the
+     *        information bits, the 'parity_size' last bits are the parity bits and the bits in between are zero padded.
+     *        The zero padded bits are known by the receiver, so they are transmitted without noise.
+     */
     void set_params(int dec_granularity_, int parity_size_){
       dec_granularity = dec_granularity_;
       parity_size = parity_size_;
@@ -137,9 +175,15 @@ class Channel
     virtual void set_n_frames(const size_t n_frames);
 
   protected:
+    // the zero padded positions of a frame are ['get_padding_begin()', 'get_padding_end()'), empty range if no padding
+    int get_padding_begin() const;
+    int get_padding_end() const;
+
     virtual void _add_noise(const float* CP, const R* X_N, R* Y_N, const size_t frame_id);
 
     virtual void _add_noise_wg(const float* CP, const R* X_N, R* H_N, R* Y_N, const size_t frame_id);
+
+    virtual void _add_noise_is(const float* CP, const R* X_N, R* Y_N, double* W, const size_t frame_id);
 };
 }
 }
@@ -2,6 +2,7 @@
 #include <string>
 
 #include "Module/Channel/Channel.hpp"
+#include "Tools/Code/LDPC/Zero_padding/zero_padding.h"
 #include "Tools/Noise/Sigma.hpp"
 
 namespace aff3ct
@@ -30,6 +31,13 @@ Channel<R>::operator[](const chn::sck::add_noise_wg s)
     return spu::module::Module::operator[]((size_t)chn::tsk::add_noise_wg)[(size_t)s];
 }
 
+template<typename R>
+spu::runtime::Socket&
+Channel<R>::operator[](const chn::sck::add_noise_is s)
+{
+    return spu::module::Module::operator[]((size_t)chn::tsk::add_noise_is)[(size_t)s];
+}
+
 template<typename R>
 Channel<R>::Channel(const int N)
   : spu::module::Stateful()
@@ -84,6 +92,26 @@ Channel<R>::Channel(const int N)
 
           return spu::runtime::status_t::SUCCESS;
       });
+
+    auto& p3 = this->create_task("add_noise_is");
+    auto p3s_CP = this->template create_socket_in<float>(p3, "CP", 1);
+    auto p3s_X_N = this->template create_socket_in<R>(p3, "X_N", this->N);
+    auto p3s_Y_N = this->template create_socket_out<R>(p3, "Y_N", this->N);
+    auto p3s_W = this->template create_socket_out<double>(p3, "W", 1);
+    this->create_codelet(
+      p3,
+      [p3s_CP, p3s_X_N, p3s_Y_N, p3s_W](spu::module::Module& m, spu::runtime::Task& t, const size_t frame_id) -> int
+      {
+          auto& chn = static_cast<Channel<R>&>(m);
+
+          chn._add_noise_is(static_cast<float*>(t[p3s_CP].get_dataptr()),
+                            static_cast<R*>(t[p3s_X_N].get_dataptr()),
+                            static_cast<R*>(t[p3s_Y_N].get_dataptr()),
+                            static_cast<double*>(t[p3s_W].get_dataptr()),
+                            frame_id);
+
+          return spu::runtime::status_t::SUCCESS;
+      });
 }
 
 template<typename R>
@@ -107,6 +135,20 @@ Channel<R>::get_noised_data() const
     return this->noised_data;
 }
 
+template<typename R>
+int
+Channel<R>::get_padding_begin() const
+{
+    return tools::zero_padding_begin(this->N, this->dec_granularity, this->parity_size);
+}
+
+template<typename R>
+int
+Channel<R>::get_padding_end() const
+{
+    return tools::zero_padding_end(this->N, this->dec_granularity, this->parity_size);
+}
+
 template<typename R>
 void
 Channel<R>::set_seed(const int seed)
@@ -167,6 +209,39 @@ Channel<R>::add_noise_wg(const float* CP, const R* X_N, R* H_N, R* Y_N, const in
     (*this)[chn::tsk::add_noise_wg].exec(frame_id, managed_memory);
 }
 
+template<typename R>
+template<class A>
+void
+Channel<R>::add_noise_is(const std::vector<float, A>& CP,
+                         const std::vector<R, A>& X_N,
+                         std::vector<R, A>& Y_N,
+                         std::vector<double>& W,
+                         const int frame_id,
+                         const bool managed_memory)
+{
+    (*this)[chn::sck::add_noise_is::CP].bind(CP);
+    (*this)[chn::sck::add_noise_is::X_N].bind(X_N);
+    (*this)[chn::sck::add_noise_is::Y_N].bind(Y_N);
+    (*this)[chn::sck::add_noise_is::W].bind(W);
+    (*this)[chn::tsk::add_noise_is].exec(frame_id, managed_memory);
+}
+
+template<typename R>
+void
+Channel<R>::add_noise_is(const float* CP,
+                         const R* X_N,
+                         R* Y_N,
+                         double* W,
+                         const int frame_id,
+                         const bool managed_memory)
+{
+    (*this)[chn::sck::add_noise_is::CP].bind(CP);
+    (*this)[chn::sck::add_noise_is::X_N].bind(X_N);
+    (*this)[chn::sck::add_noise_is::Y_N].bind(Y_N);
+    (*this)[chn::sck::add_noise_is::W].bind(W);
+    (*this)[chn::tsk::add_noise_is].exec(frame_id, managed_memory);
+}
+
 template<typename R>
 void
 Channel<R>::_add_noise(const float* CP, const R* X_N, R* Y_N, const size_t frame_id)
@@ -181,6 +256,13 @@ Channel<R>::_add_noise_wg(const float* CP, const R* X_N, R* H_N, R* Y_N, const s
     throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__);
 }
 
+template<typename R>
+void
+Channel<R>::_add_noise_is(const float* CP, const R* X_N, R* Y_N, double* W, const size_t frame_id)
+{
+    throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__);
+}
+
 template<typename R>
 void
 Channel<R>::set_n_frames(const size_t n_frames)
@@ -30,6 +30,8 @@ class Decoder_BCH : public Decoder_SIHO<B, R>
 
     bool get_last_is_codeword(const int frame_id = -1) const;
 
+    int get_t() const;
+
     virtual void set_n_frames(const size_t n_frames);
 };
 }
@@ -41,7 +41,19 @@ class Decoder_BCH_std : public Decoder_BCH<B, R>
     virtual ~Decoder_BCH_std() = default;
     virtual Decoder_BCH_std<B, R>* clone() const;
 
+    // the syndromes 'syndromes[1..2t]' are given in the polynomial form ('syndromes[0]' is not used), they can be
+    // updated incrementally when a bit of the hard decision is flipped
+    void compute_syndromes(const B* Y_N, int* syndromes) const;
+    void flip_syndromes(const int pos, int* syndromes) const;
+
+    // return the number of errors and store their positions in 'err_pos' (at most 't' positions), or -1 when the
+    // errors cannot be corrected
+    int decode_syndromes(const int* syndromes, int* err_pos);
+
   protected:
+    // Berlekamp-Massey algorithm and Chien search on the syndromes 's' (index form), return the number of roots of the
+    // error location polynomial stored in 'loc', or -1 when the errors cannot be corrected
+    int _decode_syndromes();
     virtual int _decode(B* Y_N, const size_t frame_id);
     virtual int _decode_hiho(const B* Y_N, int8_t* CWD, B* V_K, const size_t frame_id);
     virtual int _decode_hiho_cw(const B* Y_N, int8_t* CWD, B* V_N, const size_t frame_id);
@@ -9,6 +9,7 @@
 
 #include "Module/Decoder/Decoder_SISO.hpp"
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_CSR.hpp"
 
 namespace aff3ct
 {
@@ -30,9 +31,8 @@ class Decoder_LDPC_bit_flipping : public Decoder_SISO<B, R>
 
     const std::vector<unsigned>& info_bits_pos;
 
-    std::vector<unsigned char> n_variables_per_parity;
-    std::vector<unsigned char> n_parities_per_variable;
-    std::vector<unsigned int> transpose;
+    const tools::Sparse_matrix_CSR chk_to_var_ids; // compressed view of H: the variable nodes of each check node
+    const tools::Sparse_matrix_CSR var_to_chk_ids; // compressed view of H: the check nodes of each variable node
 
     // data structures for iterative decoding
     std::vector<R> Lp_N;                // a posteriori information
@@ -61,6 +61,8 @@ class Decoder_LDPC_bit_flipping : public Decoder_SISO<B, R>
 
     // BP functions for decoding
     bool BF_decode(const R* Y_N, const size_t frame_id);
+    template<typename I>
+    void compute_Y_min(const R* Y_N);
 
     virtual bool BF_process(const R* Y_N, std::vector<R>& V_to_C, std::vector<R>& C_to_V) = 0;
 
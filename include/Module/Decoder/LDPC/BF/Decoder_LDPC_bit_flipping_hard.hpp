@@ -9,6 +9,7 @@
 
 #include "Module/Decoder/Decoder_SIHO.hpp"
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_CSR.hpp"
 
 namespace aff3ct
 {
@@ -24,6 +25,8 @@ class Decoder_LDPC_bit_flipping_hard : public Decoder_SIHO<B, R>
     int cur_syndrome_depth;
 
     const tools::Sparse_matrix& H;
+    const tools::Sparse_matrix_CSR chk_to_var_ids; // compressed view of H: the variable nodes of each check node
+    const tools::Sparse_matrix_CSR var_to_chk_ids; // compressed view of H: the check nodes of each variable node
 
     // data structures for iterative decoding
     std::vector<B> var_nodes;
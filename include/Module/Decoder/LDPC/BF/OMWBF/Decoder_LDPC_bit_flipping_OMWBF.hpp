@@ -36,6 +36,8 @@ class Decoder_LDPC_bit_flipping_OMWBF : public Decoder_LDPC_bit_flipping<B, R>
   protected:
     // BF functions for decoding
     virtual bool BF_process(const R* Y_N, std::vector<R>& V_to_C, std::vector<R>& C_to_V);
+    template<typename I>
+    bool _BF_process(const R* Y_N);
 };
 }
 }
@@ -41,6 +41,12 @@ class Decoder_LDPC_probabilistic_parallel_bit_flipping : public Decoder_LDPC_bit
   protected:
     virtual void cn_process(const B* VN, B* CN, const size_t frame_id);
     virtual void vn_process(const B* Y_N, B* VN, const B* CN, const size_t frame_id);
+
+  private:
+    template<typename I>
+    void _cn_process(const B* VN, B* CN);
+    template<typename I>
+    void _vn_process(const B* Y_N, B* VN, const B* CN);
 };
 
 template<typename B = int, typename R = float>
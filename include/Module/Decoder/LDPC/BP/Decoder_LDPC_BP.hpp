@@ -6,6 +6,7 @@
 #define DECODER_LDPC_BP_HPP_
 
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_CSR.hpp"
 
 namespace aff3ct
 {
@@ -16,6 +17,8 @@ class Decoder_LDPC_BP
   protected:
     const int n_ite;
     const tools::Sparse_matrix H;
+    const tools::Sparse_matrix_CSR chk_to_var_ids; // compressed view of H: the variable nodes of each check node
+    const tools::Sparse_matrix_CSR var_to_chk_ids; // compressed view of H: the check nodes of each variable node
     const bool enable_syndrome;
     const int syndrome_depth;
 
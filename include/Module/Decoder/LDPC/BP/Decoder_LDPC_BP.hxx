@@ -11,7 +11,7 @@ Decoder_LDPC_BP ::check_syndrome_soft(const R* Y_N)
 {
     if (this->enable_syndrome)
     {
-        const auto syndrome = tools::LDPC_syndrome::check_soft(Y_N, this->H);
+        const auto syndrome = tools::LDPC_syndrome::check_soft(Y_N, this->chk_to_var_ids);
         this->cur_syndrome_depth = syndrome ? (this->cur_syndrome_depth + 1) % this->syndrome_depth : 0;
         return syndrome && (this->cur_syndrome_depth == 0);
     }
@@ -25,7 +25,7 @@ Decoder_LDPC_BP ::check_syndrome_hard(const B* V_N)
 {
     if (this->enable_syndrome)
     {
-        const auto syndrome = tools::LDPC_syndrome::check_hard(V_N, this->H);
+        const auto syndrome = tools::LDPC_syndrome::check_hard(V_N, this->chk_to_var_ids);
         this->cur_syndrome_depth = syndrome ? (this->cur_syndrome_depth + 1) % this->syndrome_depth : 0;
         return syndrome && (this->cur_syndrome_depth == 0);
     }
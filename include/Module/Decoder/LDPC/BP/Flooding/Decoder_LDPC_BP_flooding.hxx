@@ -49,9 +49,7 @@ Decoder_LDPC_BP_flooding<B, R, Update_rule>::Decoder_LDPC_BP_flooding(const int
         {
             auto var_id = msg_chk_to_var_id[i][j];
 
-            auto branch_id = 0;
-            for (auto ii = 0; ii < (int)var_id; ii++)
-                branch_id += (int)msg_var_to_chk_id[ii].size();
+            auto branch_id = (int)this->var_to_chk_ids.get_offsets()[var_id];
             branch_id += connections[var_id];
             connections[var_id]++;
 
@@ -203,7 +201,7 @@ Decoder_LDPC_BP_flooding<B, R, Update_rule>::_initialize_var_to_chk(const R* Y_N
     ;
     for (auto v = 0; v < n_var_nodes; v++)
     {
-        const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+        const auto var_degree = (int)this->var_to_chk_ids.get_degree(v);
 
         auto sum_msg_chk_to_var = (R)0;
         for (auto c = 0; c < var_degree; c++)
@@ -229,7 +227,7 @@ Decoder_LDPC_BP_flooding<B, R, Update_rule>::_decode_single_ite(const std::vecto
     const auto n_chk_nodes = (int)this->H.get_n_cols();
     for (auto c = 0; c < n_chk_nodes; c++)
     {
-        const auto chk_degree = (int)this->H.get_col_to_rows()[c].size();
+        const auto chk_degree = (int)this->chk_to_var_ids.get_degree(c);
 
         this->up_rule.begin_chk_node_in(c, chk_degree);
         for (auto v = 0; v < chk_degree; v++)
@@ -257,7 +255,7 @@ Decoder_LDPC_BP_flooding<B, R, Update_rule>::_compute_post(const R* Y_N,
     ;
     for (auto v = 0; v < n_var_nodes; v++)
     {
-        const auto var_degree = (int)this->H.get_row_to_cols()[v].size();
+        const auto var_degree = (int)this->var_to_chk_ids.get_degree(v);
 
         auto sum_msg_chk_to_var = (R)0;
         for (auto c = 0; c < var_degree; c++)
@@ -73,7 +73,7 @@ Decoder_LDPC_BP_flooding_SPA<B, R>::_decode_single_ite(const std::vector<R>& msg
     const auto n_chk_nodes = (int)this->H.get_n_cols();
     for (auto c = 0; c < n_chk_nodes; c++)
     {
-        const auto chk_degree = (int)this->H.get_col_to_rows()[c].size();
+        const auto chk_degree = (int)this->chk_to_var_ids.get_degree(c);
 
         auto prod = (R)1;
         for (auto v = 0; v < chk_degree; v++)
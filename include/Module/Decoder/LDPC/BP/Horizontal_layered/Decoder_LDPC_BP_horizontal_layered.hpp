@@ -56,6 +56,7 @@ class Decoder_LDPC_BP_horizontal_layered
 
     void _load(const R* Y_N, const size_t frame_id);
     int _decode(const size_t frame_id);
+    template<typename I>
     void _decode_single_ite(std::vector<R>& var_nodes, std::vector<R>& messages);
 };
 }
@@ -163,7 +163,10 @@ Decoder_LDPC_BP_horizontal_layered<B, R, Update_rule>::_decode(const size_t fram
     for (auto ite = 0; ite < this->n_ite; ite++)
     {
         this->up_rule.begin_ite(ite);
-        this->_decode_single_ite(this->var_nodes[frame_id], this->messages[frame_id]);
+        if (this->chk_to_var_ids.is_compact())
+            this->template _decode_single_ite<uint16_t>(this->var_nodes[frame_id], this->messages[frame_id]);
+        else
+            this->template _decode_single_ite<uint32_t>(this->var_nodes[frame_id], this->messages[frame_id]);
         this->up_rule.end_ite();
 
         valid_synd = this->check_syndrome_soft(this->var_nodes[frame_id].data());
@@ -176,22 +179,25 @@ Decoder_LDPC_BP_horizontal_layered<B, R, Update_rule>::_decode(const size_t fram
 }
 
 template<typename B, typename R, class Update_rule>
+template<typename I>
 void
 Decoder_LDPC_BP_horizontal_layered<B, R, Update_rule>::_decode_single_ite(std::vector<R>& var_nodes,
                                                                           std::vector<R>& messages)
 {
-    auto kr = 0;
-    auto kw = 0;
+    const auto offsets = this->chk_to_var_ids.get_offsets().data();
+    const auto var_ids = this->chk_to_var_ids.template get_indexes<I>();
 
     // horizontal layered scheduling
-    const auto n_chk_nodes = (int)this->H.get_n_cols();
+    const auto n_chk_nodes = (int)this->chk_to_var_ids.size();
     for (auto c = 0; c < n_chk_nodes; c++)
     {
-        const auto chk_degree = (int)this->H[c].size();
+        const auto chk_vars = var_ids + offsets[c];
+        const auto chk_msgs = messages.data() + offsets[c];
+        const auto chk_degree = (int)(offsets[c + 1] - offsets[c]);
         this->up_rule.begin_chk_node_in(c, chk_degree);
         for (auto v = 0; v < chk_degree; v++)
         {
-            this->contributions[v] = var_nodes[this->H[c][v]] - messages[kr++];
+            this->contributions[v] = var_nodes[chk_vars[v]] - chk_msgs[v];
             this->up_rule.compute_chk_node_in(v, this->contributions[v]);
         }
         this->up_rule.end_chk_node_in();
@@ -199,8 +205,8 @@ Decoder_LDPC_BP_horizontal_layered<B, R, Update_rule>::_decode_single_ite(std::v
         this->up_rule.begin_chk_node_out(c, chk_degree);
         for (auto v = 0; v < chk_degree; v++)
         {
-            messages[kw] = this->up_rule.compute_chk_node_out(v, this->contributions[v]);
-            var_nodes[this->H[c][v]] = this->contributions[v] + messages[kw++];
+            chk_msgs[v] = this->up_rule.compute_chk_node_out(v, this->contributions[v]);
+            var_nodes[chk_vars[v]] = this->contributions[v] + chk_msgs[v];
         }
         this->up_rule.end_chk_node_out();
     }
@@ -0,0 +1,93 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_LDPC_BP_horizontal_layered_QC.
+ */
+#ifndef DECODER_LDPC_BP_HORIZONTAL_LAYERED_QC_HPP_
+#define DECODER_LDPC_BP_HORIZONTAL_LAYERED_QC_HPP_
+
+#include <mipp.h>
+#include <utility>
+#include <vector>
+
+#include "Module/Decoder/Decoder_SISO.hpp"
+#include "Module/Decoder/LDPC/BP/Decoder_LDPC_BP.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_LDPC_BP_horizontal_layered_QC
+ *
+ * \brief Horizontal layered Min-Sum decoder (MS, NMS and OMS) working on the circulant blocks of a QC-LDPC code.
+ *
+ * A layer is a block row of the base matrix: its Z check nodes are processed at once, the SIMD lanes being mapped on
+ * the rows of the circulants. Each block of variable nodes is stored twice in a row, so the cyclic shift of a
+ * circulant becomes a simple unaligned load. The base matrix is recovered from H, a matrix without QC structure is
+ * rejected.
+ *
+ * \tparam B: type of the bits in the decoder.
+ * \tparam R: type of the reals (LLRs) in the decoder.
+ */
+template<typename B = int, typename R = float>
+class Decoder_LDPC_BP_horizontal_layered_QC
+  : public Decoder_SISO<B, R>
+  , public Decoder_LDPC_BP
+{
+  private:
+    const float normalize_factor;
+    const R offset;
+
+  protected:
+    const R saturation;
+
+    const std::vector<unsigned> info_bits_pos;
+
+    unsigned Z;      // lifting size
+    unsigned Z_al;   // 'Z' rounded up to a multiple of the SIMD register size
+    unsigned stride; // size of a block of variable nodes in 'var_nodes' (two copies + padding)
+    std::vector<std::vector<std::pair<unsigned, unsigned>>> layers; // per block row: (block column, shift)
+
+    // data structures for iterative decoding
+    std::vector<mipp::vector<R>> var_nodes; // per frame, each block of variable nodes is stored twice in a row
+    std::vector<mipp::vector<R>> messages;  // per frame, 'Z_al' messages per non-null circulant
+    mipp::vector<R> contributions;
+    mipp::vector<R> lanes; // lane indexes, used to mask the padding lanes of the last register of a block
+
+  public:
+    Decoder_LDPC_BP_horizontal_layered_QC(const int K,
+                                          const int N,
+                                          const int n_ite,
+                                          const tools::Sparse_matrix& H,
+                                          const std::vector<unsigned>& info_bits_pos,
+                                          const float normalize_factor = 1.f,
+                                          const R offset = (R)0,
+                                          const bool enable_syndrome = true,
+                                          const int syndrome_depth = 1);
+    virtual ~Decoder_LDPC_BP_horizontal_layered_QC() = default;
+    virtual Decoder_LDPC_BP_horizontal_layered_QC<B, R>* clone() const;
+
+    virtual void set_n_frames(const size_t n_frames);
+
+    unsigned get_Z() const;
+
+  protected:
+    void _reset(const size_t frame_id);
+
+    int _decode_siso(const R* Y_N1, int8_t* CWD, R* Y_N2, const size_t frame_id);
+    int _decode_siho(const R* Y_N, int8_t* CWD, B* V_K, const size_t frame_id);
+    int _decode_siho_cw(const R* Y_N, int8_t* CWD, B* V_N, const size_t frame_id);
+
+    void _load(const R* Y_N, const size_t frame_id);
+    int _decode(const size_t frame_id);
+    template<int F>
+    int _decode(const size_t frame_id);
+    template<int F>
+    void _decode_single_ite(mipp::vector<R>& var_nodes, mipp::vector<R>& messages);
+    bool _check_syndrome(const mipp::vector<R>& var_nodes);
+};
+}
+}
+
+#endif /* DECODER_LDPC_BP_HORIZONTAL_LAYERED_QC_HPP_ */
@@ -31,7 +31,6 @@ class Decoder_LDPC_BP_vertical_layered
     std::vector<std::vector<R>> var_nodes;
     std::vector<std::vector<R>> messages;
     std::vector<R> contributions;
-    std::vector<uint32_t> messages_offsets;
 
   public:
     Decoder_LDPC_BP_vertical_layered(const int K,
@@ -57,6 +56,7 @@ class Decoder_LDPC_BP_vertical_layered
 
     void _load(const R* Y_N, const size_t frame_id);
     int _decode(const size_t frame_id);
+    template<typename I>
     void _decode_single_ite(std::vector<R>& var_nodes, std::vector<R>& messages);
 };
 }
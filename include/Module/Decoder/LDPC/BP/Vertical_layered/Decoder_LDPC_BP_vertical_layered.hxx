@@ -30,7 +30,6 @@ Decoder_LDPC_BP_vertical_layered<B, R, Update_rule>::Decoder_LDPC_BP_vertical_la
   , var_nodes(this->n_frames, std::vector<R>(N))
   , messages(this->n_frames, std::vector<R>(this->H.get_n_connections()))
   , contributions(this->H.get_cols_max_degree())
-  , messages_offsets(this->H.get_n_cols())
 {
     const std::string name = "Decoder_LDPC_BP_vertical_layered<" + this->up_rule.get_name() + ">";
     this->set_name(name);
@@ -39,14 +38,6 @@ Decoder_LDPC_BP_vertical_layered<B, R, Update_rule>::Decoder_LDPC_BP_vertical_la
 
     tools::check_LUT(info_bits_pos, "info_bits_pos", (size_t)K);
 
-    size_t cur_off_msg = 0;
-    const auto n_chk_nodes = (int)this->H.get_n_cols();
-    for (auto c = 0; c < n_chk_nodes; c++)
-    {
-        messages_offsets[c] = (uint32_t)cur_off_msg;
-        cur_off_msg += this->H[c].size();
-    }
-
     this->reset();
 }
 
@@ -175,7 +166,10 @@ Decoder_LDPC_BP_vertical_layered<B, R, Update_rule>::_decode(const size_t frame_
     for (auto ite = 0; ite < this->n_ite; ite++)
     {
         this->up_rule.begin_ite(ite);
-        this->_decode_single_ite(this->var_nodes[frame_id], this->messages[frame_id]);
+        if (this->chk_to_var_ids.is_compact())
+            this->template _decode_single_ite<uint16_t>(this->var_nodes[frame_id], this->messages[frame_id]);
+        else
+            this->template _decode_single_ite<uint32_t>(this->var_nodes[frame_id], this->messages[frame_id]);
         this->up_rule.end_ite();
 
         if (this->check_syndrome_soft(this->var_nodes[frame_id].data())) break;
@@ -187,27 +181,35 @@ Decoder_LDPC_BP_vertical_layered<B, R, Update_rule>::_decode(const size_t frame_
 }
 
 template<typename B, typename R, class Update_rule>
+template<typename I>
 void
 Decoder_LDPC_BP_vertical_layered<B, R, Update_rule>::_decode_single_ite(std::vector<R>& var_nodes,
                                                                         std::vector<R>& messages)
 {
+    // the offsets of the check nodes in 'chk_to_var_ids' are also the offsets of their messages
+    const auto chk_offsets = this->chk_to_var_ids.get_offsets().data();
+    const auto var_ids = this->chk_to_var_ids.template get_indexes<I>();
+    const auto var_offsets = this->var_to_chk_ids.get_offsets().data();
+    const auto chk_ids = this->var_to_chk_ids.template get_indexes<I>();
+
     // vertical layered scheduling
-    const auto n_var_nodes = (int)this->H.get_n_rows();
+    const auto n_var_nodes = (int)this->var_to_chk_ids.size();
     for (auto vv = 0; vv < n_var_nodes; vv++)
     {
         auto msg_acc = (R)0;
-        const auto var_degree = (int)this->H.get_cols_from_row(vv).size();
+        const auto var_chks = chk_ids + var_offsets[vv];
+        const auto var_degree = (int)(var_offsets[vv + 1] - var_offsets[vv]);
         for (auto c = 0; c < var_degree; c++)
         {
             auto v_out = -1;
-            const auto cc = (int)this->H.get_cols_from_row(vv)[c];
-            const auto off_msg = (int)this->messages_offsets[cc];
-            const auto chk_degree = (int)this->H[cc].size();
+            const auto cc = (int)var_chks[c];
+            const auto off_msg = (int)chk_offsets[cc];
+            const auto chk_degree = (int)(chk_offsets[cc + 1] - chk_offsets[cc]);
             this->up_rule.begin_chk_node_in(cc, chk_degree);
             for (auto v = 0; v < chk_degree; v++)
             {
-                const auto var_id = this->H[cc][v];
-                v_out = (var_id == (unsigned)vv) ? v : v_out;
+                const auto var_id = var_ids[off_msg + v];
+                v_out = (var_id == (I)vv) ? v : v_out;
                 this->contributions[v] = var_nodes[var_id] - messages[off_msg + v];
                 this->up_rule.compute_chk_node_in(v, this->contributions[v]);
             }
@@ -0,0 +1,73 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_LDPC_zero_padding.
+ */
+#ifndef DECODER_LDPC_ZERO_PADDING_HPP_
+#define DECODER_LDPC_ZERO_PADDING_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <mipp.h>
+#include <vector>
+
+#include "Module/Decoder/Decoder_SIHO.hpp"
+#include "Module/Decoder/Decoder_SISO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_LDPC_zero_padding
+ *
+ * \brief Decodes a shortened (zero padded) LDPC code on its pruned Tanner graph.
+ *
+ * The zero padded bits are known by the receiver, they are equivalent to infinite-confidence LLRs: their variable
+ * nodes are removed from H before building the inner decoder (see tools::LDPC_matrix_handler::shorten). This decoder
+ * gathers the LLRs of the remaining variable nodes, runs the inner decoder and scatters its output. The zero padded
+ * bits are the last 'K' - 'dec.get_K()' information bits.
+ *
+ * \tparam B: type of the bits in the decoder.
+ * \tparam R: type of the reals (LLRs) in the decoder.
+ */
+template<typename B = int, typename R = float>
+class Decoder_LDPC_zero_padding : public Decoder_SISO<B, R>
+{
+  protected:
+    std::shared_ptr<Decoder_SIHO<B, R>> dec; // inner decoder, built on the shortened code
+    const std::vector<uint32_t> kept_pos;    // position in the frame of each variable node of the shortened code
+    const R padding_llr;                     // soft output of the zero padded bits
+
+    mipp::vector<R> Y_N_red;  // LLRs of the shortened code
+    mipp::vector<R> Y_N2_red; // soft output of the shortened code
+    mipp::vector<B> V_red;    // hard output of the shortened code
+
+  public:
+    Decoder_LDPC_zero_padding(const int K,
+                              const int N,
+                              const Decoder_SIHO<B, R>& dec,
+                              const std::vector<uint32_t>& kept_pos);
+    virtual ~Decoder_LDPC_zero_padding() = default;
+    virtual Decoder_LDPC_zero_padding<B, R>* clone() const;
+
+    virtual void set_n_frames(const size_t n_frames);
+    virtual void set_seed(const int seed);
+
+    const Decoder_SIHO<B, R>& get_decoder() const;
+
+  protected:
+    virtual void deep_copy(const Decoder_LDPC_zero_padding<B, R>& m);
+
+    void _reset(const size_t frame_id);
+
+    int _decode_siso(const R* Y_N1, int8_t* CWD, R* Y_N2, const size_t frame_id);
+    int _decode_siho(const R* Y_N, int8_t* CWD, B* V_K, const size_t frame_id);
+    int _decode_siho_cw(const R* Y_N, int8_t* CWD, B* V_N, const size_t frame_id);
+
+  private:
+    void _gather(const R* Y_N);
+};
+}
+}
+
+#endif /* DECODER_LDPC_ZERO_PADDING_HPP_ */
@@ -0,0 +1,100 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_polar_SC_compiled_sys.
+ */
+#ifndef DECODER_POLAR_SC_COMPILED_SYS_
+#define DECODER_POLAR_SC_COMPILED_SYS_
+
+#include <memory>
+#include <mipp.h>
+#include <string>
+#include <vector>
+
+#include "Module/Decoder/Decoder_SIHO.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_i.hpp"
+#include "Tools/Code/Polar/Polar_program.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Interface/Interface_get_set_frozen_bits.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_SC_compiled_sys
+ *
+ * \brief Fast Successive Cancellation (SC) decoder of systematic polar codes specialized at runtime.
+ *
+ * The simplified tree of the fast SC decoder is compiled into a flat list of instructions (tools::Polar_program) each
+ * time the frozen bits are set. Each instruction is bound to the API_polar kernel specialized for its operation and
+ * its size (the sizes up to 64 are unrolled at compile time). The decoding calls these kernels in a single loop,
+ * without recursion nor node type tests, which is close to the decoders generated for a given code without having to
+ * rebuild the library. The program can be cached in a folder to skip the tree parsing in the next simulations.
+ */
+template<typename B = int,
+         typename R = float,
+         class API_polar = tools::API_polar_dynamic_seq<B,
+                                                        R,
+                                                        tools::f_LLR<R>,
+                                                        tools::g_LLR<B, R>,
+                                                        tools::g0_LLR<R>,
+                                                        tools::h_LLR<B, R>,
+                                                        tools::xo_STD<B>>>
+class Decoder_polar_SC_compiled_sys
+  : public Decoder_SIHO<B, R>
+  , public tools::Interface_get_set_frozen_bits
+{
+  protected:
+    mipp::vector<R> l;             // lambda, LR or LLR
+    mipp::vector<B> s;             // bits, partial sums
+    mipp::vector<B> s_bis;         // bits, partial sums
+    std::vector<bool> frozen_bits; // frozen bits
+
+    std::vector<std::shared_ptr<tools::Pattern_polar_i>> patterns;
+    const size_t idx_r0;
+    const size_t idx_r1;
+    const std::string cache_path;
+
+    using kernel_t = void (*)(mipp::vector<R>& l, mipp::vector<B>& s, const int32_t* off, const int n_elmts);
+
+    tools::Polar_program program;
+    std::vector<kernel_t> kernels; // kernel of each instruction of the program
+
+  public:
+    Decoder_polar_SC_compiled_sys(const int& K,
+                                  const int& N,
+                                  const std::vector<bool>& frozen_bits,
+                                  const std::vector<tools::Pattern_polar_i*>& polar_patterns,
+                                  const int idx_r0,
+                                  const int idx_r1,
+                                  const std::string& cache_path = "");
+
+    virtual ~Decoder_polar_SC_compiled_sys() = default;
+
+    virtual Decoder_polar_SC_compiled_sys<B, R, API_polar>* clone() const;
+
+    virtual void set_frozen_bits(const std::vector<bool>& frozen_bits);
+    virtual const std::vector<bool>& get_frozen_bits() const;
+
+    const tools::Polar_program& get_program() const;
+
+  protected:
+    void _load(const R* Y_N);
+    void _decode();
+    int _decode_siho(const R* Y_N, B* V_K, const size_t frame_id);
+    int _decode_siho_cw(const R* Y_N, B* V_N, const size_t frame_id);
+    void _store(B* V_K);
+    void _store_cw(B* V_N);
+
+  private:
+    void compile();
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Module/Decoder/Polar/SC/Decoder_polar_SC_compiled_sys.hxx"
+#endif
+
+#endif /* DECODER_POLAR_SC_COMPILED_SYS_ */
@@ -0,0 +1,403 @@
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+
+#include "Module/Decoder/Polar/SC/Decoder_polar_SC_compiled_sys.hpp"
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Tools/Code/Polar/fb_assert.h"
+#include "Tools/Code/Polar/fb_extract.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Perf/Transpose/transpose_selector.h"
+
+namespace aff3ct
+{
+namespace module
+{
+template<typename B, typename R, class API_polar, int N_ELMTS>
+struct Decoder_polar_SC_compiled_sys_kernels
+{
+    using kernel_t = void (*)(mipp::vector<R>& l, mipp::vector<B>& s, const int32_t* off, const int n_elmts);
+
+    static void f(mipp::vector<R>& l, mipp::vector<B>& s, const int32_t* off, const int n_elmts)
+    {
+        API_polar::template f<N_ELMTS>(l, off[0], off[1], off[2], n_elmts);
+    }
+
+    static void g(mipp::vector<R>& l, mipp::vector<B>& s, const int32_t* off, const int n_elmts)
+    {
+        API_polar::template g<N_ELMTS>(s, l, off[0], off[1], off[3], off[2], n_elmts);
+    }
+
+    static void g0(mipp::vector<R>& l, mipp::vector<B>& s, const int32_t* off, const int n_elmts)
+    {
+        API_polar::template g0<N_ELMTS>(l, off[0], off[1], off[2], n_elmts);
+    }
+
+    static void gr(mipp::vector<R>& l, mipp::vector<B>& s, const int32_t* off, const int n_elmts)
+    {
+        API_polar::template gr<N_ELMTS>(s, l, off[0], off[1], off[3], off[2], n_elmts);
+    }
+
+    static void h(mipp::vector<R>& l, mipp::vector<B>& s, const int32_t* off, const int n_elmts)
+    {
+        API_polar::template h<N_ELMTS>(s, l, off[0], off[1], n_elmts);
+    }
+
+    static void h0(mipp::vector<R>& l, mipp::vector<B>& s, const int32_t* off, const int n_elmts)
+    {
+        API_polar::template h0<N_ELMTS>(s, off[0], n_elmts);
+    }
+
+    static void rep(mipp::vector<R>& l, mipp::vector<B>& s, const int32_t* off, const int n_elmts)
+    {
+        API_polar::template rep<N_ELMTS>(s, l, off[0], off[1], n_elmts);
+    }
+
+    static void spc(mipp::vector<R>& l, mipp::vector<B>& s, const int32_t* off, const int n_elmts)
+    {
+        API_polar::template spc<N_ELMTS>(s, l, off[0], off[1], n_elmts);
+    }
+
+    static void xo(mipp::vector<R>& l, mipp::vector<B>& s, const int32_t* off, const int n_elmts)
+    {
+        API_polar::template xo<N_ELMTS>(s, off[0], off[1], off[2], n_elmts);
+    }
+
+    static void xo0(mipp::vector<R>& l, mipp::vector<B>& s, const int32_t* off, const int n_elmts)
+    {
+        API_polar::template xo0<N_ELMTS>(s, off[0], off[1], n_elmts);
+    }
+
+    static kernel_t get(const tools::polar_op_t op)
+    {
+        switch (op)
+        {
+            case tools::polar_op_t::F:
+                return f;
+            case tools::polar_op_t::G:
+                return g;
+            case tools::polar_op_t::G0:
+                return g0;
+            case tools::polar_op_t::GR:
+                return gr;
+            case tools::polar_op_t::H:
+                return h;
+            case tools::polar_op_t::H0:
+                return h0;
+            case tools::polar_op_t::REP:
+                return rep;
+            case tools::polar_op_t::SPC:
+                return spc;
+            case tools::polar_op_t::XO:
+                return xo;
+            case tools::polar_op_t::XO0:
+                return xo0;
+            default:
+                throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "Unknown polar operation.");
+        }
+    }
+
+    // the kernels of the small sizes are unrolled, the other ones use the generic (N_ELMTS = 0) implementation
+    static kernel_t get(const tools::polar_op_t op, const int n_elmts)
+    {
+        switch (n_elmts)
+        {
+            case 1:
+                return Decoder_polar_SC_compiled_sys_kernels<B, R, API_polar, 1>::get(op);
+            case 2:
+                return Decoder_polar_SC_compiled_sys_kernels<B, R, API_polar, 2>::get(op);
+            case 4:
+                return Decoder_polar_SC_compiled_sys_kernels<B, R, API_polar, 4>::get(op);
+            case 8:
+                return Decoder_polar_SC_compiled_sys_kernels<B, R, API_polar, 8>::get(op);
+            case 16:
+                return Decoder_polar_SC_compiled_sys_kernels<B, R, API_polar, 16>::get(op);
+            case 32:
+                return Decoder_polar_SC_compiled_sys_kernels<B, R, API_polar, 32>::get(op);
+            case 64:
+                return Decoder_polar_SC_compiled_sys_kernels<B, R, API_polar, 64>::get(op);
+            default:
+                return Decoder_polar_SC_compiled_sys_kernels<B, R, API_polar, 0>::get(op);
+        }
+    }
+};
+
+template<typename B, typename R, class API_polar>
+Decoder_polar_SC_compiled_sys<B, R, API_polar>::Decoder_polar_SC_compiled_sys(
+  const int& K,
+  const int& N,
+  const std::vector<bool>& frozen_bits,
+  const std::vector<tools::Pattern_polar_i*>& polar_patterns,
+  const int idx_r0,
+  const int idx_r1,
+  const std::string& cache_path)
+  : Decoder_SIHO<B, R>(K, N)
+  , l(2 * N * API_polar::get_n_frames() + mipp::nElReg<R>())
+  , s(1 * N * API_polar::get_n_frames() + mipp::nElReg<B>(), 0)
+  , s_bis(1 * N * API_polar::get_n_frames() + mipp::nElReg<B>())
+  , frozen_bits(frozen_bits)
+  , idx_r0((size_t)idx_r0)
+  , idx_r1((size_t)idx_r1)
+  , cache_path(cache_path)
+{
+    const std::string name = "Decoder_polar_SC_compiled_sys";
+    this->set_name(name);
+    this->set_n_frames_per_wave(API_polar::get_n_frames());
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    static_assert(sizeof(B) == sizeof(R), "");
+
+    if (!spu::tools::is_power_of_2(this->N))
+    {
+        std::stringstream message;
+        message << "'N' has to be a power of 2 ('N' = " << N << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->N != (int)frozen_bits.size())
+    {
+        std::stringstream message;
+        message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+                << ", 'N' = " << N << ").";
+        throw spu::tools::length_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    auto k = 0;
+    for (auto i = 0; i < this->N; i++)
+        if (frozen_bits[i] == 0) k++;
+    if (this->K != k)
+    {
+        std::stringstream message;
+        message << "The number of information bits in the frozen_bits is invalid ('K' = " << K << ", 'k' = " << k
+                << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    for (auto p : polar_patterns)
+        this->patterns.push_back(std::shared_ptr<tools::Pattern_polar_i>(p->alloc(0, nullptr)));
+
+    this->set_frozen_bits(frozen_bits);
+}
+
+template<typename B, typename R, class API_polar>
+Decoder_polar_SC_compiled_sys<B, R, API_polar>*
+Decoder_polar_SC_compiled_sys<B, R, API_polar>::clone() const
+{
+    auto m = new Decoder_polar_SC_compiled_sys(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SC_compiled_sys<B, R, API_polar>::set_frozen_bits(const std::vector<bool>& fb)
+{
+    aff3ct::tools::fb_assert(fb, this->K, this->N);
+    std::copy(fb.begin(), fb.end(), this->frozen_bits.begin());
+    this->compile();
+}
+
+template<typename B, typename R, class API_polar>
+const std::vector<bool>&
+Decoder_polar_SC_compiled_sys<B, R, API_polar>::get_frozen_bits() const
+{
+    return this->frozen_bits;
+}
+
+template<typename B, typename R, class API_polar>
+const tools::Polar_program&
+Decoder_polar_SC_compiled_sys<B, R, API_polar>::get_program() const
+{
+    return this->program;
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SC_compiled_sys<B, R, API_polar>::compile()
+{
+    std::vector<tools::Pattern_polar_i*> polar_patterns;
+    for (auto& p : this->patterns)
+        polar_patterns.push_back(p.get());
+
+    const auto key = tools::Polar_program::hash(this->frozen_bits, polar_patterns, this->idx_r0, this->idx_r1);
+
+    std::stringstream file;
+    file << this->cache_path << "/polar_" << std::hex << std::setw(16) << std::setfill('0') << key << ".prg";
+
+    if (this->cache_path.empty() || !this->program.load(file.str(), key) || this->program.get_N() != this->N)
+    {
+        tools::Pattern_polar_parser parser(this->frozen_bits, polar_patterns, this->idx_r0, this->idx_r1);
+        this->program = tools::Polar_program(parser);
+        if (!this->cache_path.empty()) this->program.save(file.str(), key);
+    }
+
+    this->kernels.clear();
+    for (auto& i : this->program.get_instructions())
+        this->kernels.push_back(Decoder_polar_SC_compiled_sys_kernels<B, R, API_polar, 0>::get(i.op, i.n_elmts));
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SC_compiled_sys<B, R, API_polar>::_load(const R* Y_N)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+
+    if (n_frames == 1)
+        std::copy(Y_N, Y_N + this->N, l.begin());
+    else
+    {
+        bool fast_interleave = false;
+        if (typeid(B) == typeid(signed char))
+            fast_interleave = tools::char_transpose((signed char*)Y_N, (signed char*)l.data(), (int)this->N);
+
+        if (!fast_interleave)
+        {
+            std::vector<const R*> frames(n_frames);
+            for (auto f = 0; f < n_frames; f++)
+                frames[f] = Y_N + f * this->N;
+            tools::Reorderer_static<R, n_frames>::apply(frames, l.data(), this->N);
+        }
+    }
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SC_compiled_sys<B, R, API_polar>::_decode()
+{
+    const auto& instructions = this->program.get_instructions();
+    const auto n_instructions = instructions.size();
+    for (size_t i = 0; i < n_instructions; i++)
+        this->kernels[i](this->l, this->s, instructions[i].off, instructions[i].n_elmts);
+}
+
+template<typename B, typename R, class API_polar>
+int
+Decoder_polar_SC_compiled_sys<B, R, API_polar>::_decode_siho(const R* Y_N, B* V_K, const size_t frame_id)
+{
+    if (!API_polar::isAligned(Y_N))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+    if (!API_polar::isAligned(V_K))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'V_K' is misaligned memory.");
+
+    this->_load(Y_N);
+    this->_decode();
+    this->_store(V_K);
+
+    return 0;
+}
+
+template<typename B, typename R, class API_polar>
+int
+Decoder_polar_SC_compiled_sys<B, R, API_polar>::_decode_siho_cw(const R* Y_N, B* V_N, const size_t frame_id)
+{
+    if (!API_polar::isAligned(Y_N))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+    if (!API_polar::isAligned(V_N))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'V_N' is misaligned memory.");
+
+    this->_load(Y_N);
+    this->_decode();
+    this->_store_cw(V_N);
+
+    return 0;
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SC_compiled_sys<B, R, API_polar>::_store(B* V_K)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+
+    if (n_frames == 1)
+        tools::fb_extract(this->program.get_leaves_pattern_types(), this->s.data(), V_K);
+    else
+    {
+        bool fast_deinterleave = false;
+#if defined(AFF3CT_POLAR_BIT_PACKING)
+        if (typeid(B) == typeid(signed char))
+        {
+            fast_deinterleave =
+              tools::char_itranspose((signed char*)s.data(), (signed char*)s_bis.data(), (int)this->N);
+            if (!fast_deinterleave)
+            {
+                std::stringstream message;
+                message << "Inverse transposition only supports NEON, SSE4.1 and AVX2 instruction sets and the "
+                           "frame size 'N' has to be greater than 128 for NEON/SSE4.1 and greater than 256 for AVX2 "
+                           "('N' = "
+                        << this->N
+                        << "). "
+                           "To ensure the portability please do not compile with the -DAFF3CT_POLAR_BIT_PACKING "
+                           "definition.";
+                throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+            }
+
+            spu::tools::Bit_packer::unpack(this->s_bis.data(), (unsigned char*)this->s.data(), this->N, n_frames);
+        }
+#endif
+        if (!fast_deinterleave)
+        {
+            tools::fb_extract<B, n_frames>(
+              this->program.get_leaves_pattern_types(), this->s.data(), this->s_bis.data());
+
+            // transpose without bit packing (vectorized)
+            std::vector<B*> frames(n_frames);
+            for (auto f = 0; f < n_frames; f++)
+                frames[f] = (B*)(V_K + f * this->K);
+            tools::Reorderer_static<B, n_frames>::apply_rev(s_bis.data(), frames, this->K);
+        }
+        else
+            for (auto f = 0; f < n_frames; f++)
+                tools::fb_extract(
+                  this->program.get_leaves_pattern_types(), this->s.data() + f * this->N, V_K + f * this->K);
+    }
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SC_compiled_sys<B, R, API_polar>::_store_cw(B* V_N)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+
+    if (n_frames == 1)
+        std::copy(this->s.begin(), this->s.begin() + this->N, V_N);
+    else
+    {
+        bool fast_deinterleave = false;
+#if defined(AFF3CT_POLAR_BIT_PACKING)
+        if (typeid(B) == typeid(signed char))
+        {
+            fast_deinterleave =
+              tools::char_itranspose((signed char*)s.data(), (signed char*)s_bis.data(), (int)this->N);
+            if (!fast_deinterleave)
+            {
+                std::stringstream message;
+                message << "Inverse transposition only supports NEON, SSE4.1 and AVX2 instruction sets and the "
+                           "frame size 'N' has to be greater than 128 for NEON/SSE4.1 and greater than 256 for AVX2 "
+                           "('N' = "
+                        << this->N
+                        << "). "
+                           "To ensure the portability please do not compile with the -DAFF3CT_POLAR_BIT_PACKING "
+                           "definition.";
+                throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+            }
+            spu::tools::Bit_packer::unpack(this->s_bis.data(), (unsigned char*)V_N, this->N, n_frames);
+        }
+#endif
+        if (!fast_deinterleave)
+        {
+            // transpose without bit packing (vectorized)
+            std::vector<B*> frames(n_frames);
+            for (auto f = 0; f < n_frames; f++)
+                frames[f] = (B*)(V_N + f * this->N);
+            tools::Reorderer_static<B, n_frames>::apply_rev(this->s.data(), frames, this->N);
+        }
+    }
+}
+}
+}
@@ -0,0 +1,94 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_polar_SCAN_fast_sys.
+ */
+#ifndef DECODER_POLAR_SCAN_FAST_SYS_
+#define DECODER_POLAR_SCAN_FAST_SYS_
+
+#include <mipp.h>
+#include <vector>
+
+#include "Module/Decoder/Decoder_SISO.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Interface/Interface_get_set_frozen_bits.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_SCAN_fast_sys
+ *
+ * \brief Soft CANcellation (SCAN) decoder of systematic polar codes working on a tree pruned from its rate 0 and rate
+ *        1 sub-trees.
+ *
+ * The right beliefs (the feedback) of a rate 0 sub-tree are always infinite and the ones of a rate 1 sub-tree are
+ * always null: these sub-trees are never visited and the left beliefs (the LLRs) of their root are not computed.
+ *
+ * The left beliefs are stored like the LLRs of the fast SC decoder (the children of a node follow its own LLRs) and
+ * the right beliefs of each level of the tree are stored in a contiguous buffer, kept from an iteration to the next
+ * one. All the computations go through the API_polar: one frame per SIMD lane with the inter-frame APIs.
+ */
+template<typename B = int,
+         typename R = float,
+         class API_polar = tools::API_polar_dynamic_seq<B,
+                                                        R,
+                                                        tools::f_LLR<R>,
+                                                        tools::g_LLR<B, R>,
+                                                        tools::g0_LLR<R>,
+                                                        tools::h_LLR<B, R>,
+                                                        tools::xo_STD<B>>>
+class Decoder_polar_SCAN_fast_sys
+  : public Decoder_SISO<B, R>
+  , public tools::Interface_get_set_frozen_bits
+{
+  protected:
+    const int m;        // graph depth
+    const int max_iter; // number of iterations
+    std::vector<bool> frozen_bits;
+    tools::Pattern_polar_parser polar_patterns;
+
+    mipp::vector<R> l;      // left beliefs (LLRs) of the nodes on the path to the current node
+    mipp::vector<R> b;      // right beliefs of all the nodes, level by level ('N' elements per level)
+    mipp::vector<R> b_init; // right beliefs at the beginning of a frame decoding
+    mipp::vector<B> s;      // hard decisions
+    mipp::vector<B> s_bis;  // hard decisions of the information bits
+
+  public:
+    Decoder_polar_SCAN_fast_sys(const int& K, const int& N, const int& max_iter, const std::vector<bool>& frozen_bits);
+
+    virtual ~Decoder_polar_SCAN_fast_sys() = default;
+
+    virtual Decoder_polar_SCAN_fast_sys<B, R, API_polar>* clone() const;
+
+    virtual void set_frozen_bits(const std::vector<bool>& frozen_bits);
+    virtual const std::vector<bool>& get_frozen_bits() const;
+
+  protected:
+    void _reset(const size_t frame_id);
+
+    void _load(const R* Y_N);
+    void _decode();
+    int _decode_siho(const R* Y_N, B* V_K, const size_t frame_id);
+    int _decode_siho_cw(const R* Y_N, B* V_N, const size_t frame_id);
+    int _decode_siso(const R* Y_N1, R* Y_N2, const size_t frame_id);
+    void _store(B* V_K);
+    void _store_cw(B* V_N);
+
+    void recursive_decode(const int off_l, const int off_s, const int reverse_depth, int& node_id);
+
+  private:
+    inline R* get_b(const int reverse_depth, const int off_s);
+    void init_b(const int off_s, const int reverse_depth, int& node_id);
+    void hard_decide();
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hxx"
+#endif
+
+#endif /* DECODER_POLAR_SCAN_FAST_SYS_ */
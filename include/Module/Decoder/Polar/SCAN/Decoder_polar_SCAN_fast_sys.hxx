@@ -0,0 +1,356 @@
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+#include "Tools/Code/Polar/fb_assert.h"
+#include "Tools/Code/Polar/fb_extract.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+#include "Tools/Perf/Transpose/transpose_selector.h"
+
+namespace aff3ct
+{
+namespace module
+{
+template<typename B, typename R, class API_polar>
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::Decoder_polar_SCAN_fast_sys(const int& K,
+                                                                          const int& N,
+                                                                          const int& max_iter,
+                                                                          const std::vector<bool>& frozen_bits)
+  : Decoder_SISO<B, R>(K, N)
+  , m((int)std::log2(N))
+  , max_iter(max_iter)
+  , frozen_bits(frozen_bits)
+  , polar_patterns(frozen_bits,
+                   { new tools::Pattern_polar_std, new tools::Pattern_polar_r0, new tools::Pattern_polar_r1 },
+                   1,
+                   2,
+                   true)
+  , l(2 * N * API_polar::get_n_frames())
+  , b((this->m + 1) * N * API_polar::get_n_frames())
+  , b_init((this->m + 1) * N * API_polar::get_n_frames())
+  , s(N * API_polar::get_n_frames())
+  , s_bis(N * API_polar::get_n_frames())
+{
+    const std::string name = "Decoder_polar_SCAN_fast_sys";
+    this->set_name(name);
+    this->set_n_frames_per_wave(API_polar::get_n_frames());
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    static_assert(sizeof(B) == sizeof(R), "Sizes of the bits and reals have to be identical.");
+
+    if (!spu::tools::is_power_of_2(this->N))
+    {
+        std::stringstream message;
+        message << "'N' has to be a power of 2 ('N' = " << N << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->N != (int)frozen_bits.size())
+    {
+        std::stringstream message;
+        message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+                << ", 'N' = " << N << ").";
+        throw spu::tools::length_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    auto k = 0;
+    for (auto i = 0; i < this->N; i++)
+        if (frozen_bits[i] == 0) k++;
+    if (this->K != k)
+    {
+        std::stringstream message;
+        message << "The number of information bits in the frozen_bits is invalid ('K' = " << K << ", 'k' = " << k
+                << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (max_iter <= 0)
+    {
+        std::stringstream message;
+        message << "'max_iter' has to be greater than 0 ('max_iter' = " << max_iter << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->set_frozen_bits(frozen_bits);
+}
+
+template<typename B, typename R, class API_polar>
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>*
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::clone() const
+{
+    auto m = new Decoder_polar_SCAN_fast_sys(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::set_frozen_bits(const std::vector<bool>& fb)
+{
+    aff3ct::tools::fb_assert(fb, this->K, this->N);
+    std::copy(fb.begin(), fb.end(), this->frozen_bits.begin());
+    this->polar_patterns.set_frozen_bits(this->frozen_bits);
+
+    int node_id = 0;
+    this->init_b(0, this->m, node_id);
+    this->reset();
+}
+
+template<typename B, typename R, class API_polar>
+const std::vector<bool>&
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::get_frozen_bits() const
+{
+    return this->frozen_bits;
+}
+
+template<typename B, typename R, class API_polar>
+R*
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::get_b(const int reverse_depth, const int off_s)
+{
+    return this->b.data() + (reverse_depth * this->N + off_s) * API_polar::get_n_frames();
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::init_b(const int off_s, const int reverse_depth, int& node_id)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+    const int n_elmts = 1 << reverse_depth;
+    const auto node_type = this->polar_patterns.get_node_type(node_id);
+
+    // the right beliefs of the frozen bits are infinite, the ones of the information bits are null
+    const auto val = node_type == tools::polar_node_t::RATE_0 ? spu::tools::sat_val<R>() : spu::tools::init_LLR<R>();
+    const auto off_b = (reverse_depth * this->N + off_s) * n_frames;
+    std::fill(this->b_init.begin() + off_b, this->b_init.begin() + off_b + n_elmts * n_frames, val);
+
+    node_id++;
+    if (node_type == tools::polar_node_t::STANDARD && reverse_depth)
+    {
+        this->init_b(off_s, reverse_depth - 1, node_id);
+        this->init_b(off_s + (n_elmts >> 1), reverse_depth - 1, node_id);
+    }
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::_reset(const size_t frame_id)
+{
+    std::copy(this->b_init.begin(), this->b_init.end(), this->b.begin());
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::_load(const R* Y_N)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+
+    if (n_frames == 1)
+        std::copy(Y_N, Y_N + this->N, this->l.begin());
+    else
+    {
+        bool fast_interleave = false;
+        if (typeid(R) == typeid(signed char))
+            fast_interleave = tools::char_transpose((signed char*)Y_N, (signed char*)this->l.data(), (int)this->N);
+
+        if (!fast_interleave)
+        {
+            std::vector<const R*> frames(n_frames);
+            for (auto f = 0; f < n_frames; f++)
+                frames[f] = Y_N + f * this->N;
+            tools::Reorderer_static<R, n_frames>::apply(frames, this->l.data(), this->N);
+        }
+    }
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::_decode()
+{
+    for (auto ite = 0; ite < this->max_iter; ite++)
+    {
+        int node_id = 0;
+        this->recursive_decode(0, 0, this->m, node_id);
+    }
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::recursive_decode(const int off_l,
+                                                               const int off_s,
+                                                               const int reverse_depth,
+                                                               int& node_id)
+{
+    // the right beliefs of the rate 0 and rate 1 nodes never change
+    if (this->polar_patterns.get_node_type(node_id) != tools::polar_node_t::STANDARD || !reverse_depth)
+    {
+        node_id++;
+        return;
+    }
+
+    constexpr int n_frames = API_polar::get_n_frames();
+    const int n_elmts = 1 << reverse_depth;
+    const int n_elm_2 = n_elmts >> 1;
+
+    const R* l_a = this->l.data() + off_l * n_frames;
+    const R* l_b = l_a + n_elm_2 * n_frames;
+    R* l_c = this->l.data() + (off_l + n_elmts) * n_frames;
+    const R* b_l = this->get_b(reverse_depth - 1, off_s);
+    const R* b_r = this->get_b(reverse_depth - 1, off_s + n_elm_2);
+    R* b_a = this->get_b(reverse_depth, off_s);
+    R* b_b = b_a + n_elm_2 * n_frames;
+
+    node_id++;
+
+    // left child: l_c = f(l_a, l_b + b_r), 'b_r' comes from the previous iteration
+    if (this->polar_patterns.get_node_type(node_id) == tools::polar_node_t::STANDARD)
+    {
+        API_polar::g0(l_b, b_r, l_c, n_elm_2);
+        API_polar::f(l_a, l_c, l_c, n_elm_2);
+        this->recursive_decode(off_l + n_elmts, off_s, reverse_depth - 1, node_id);
+    }
+    else
+        node_id++;
+
+    // f(b_l, l_a) is used by the right child and by the right beliefs of the node, it is kept in 'b_b'
+    API_polar::f(b_l, l_a, b_b, n_elm_2);
+
+    // right child: l_c = l_b + f(b_l, l_a)
+    if (this->polar_patterns.get_node_type(node_id) == tools::polar_node_t::STANDARD)
+    {
+        API_polar::g0(l_b, b_b, l_c, n_elm_2);
+        this->recursive_decode(off_l + n_elmts, off_s + n_elm_2, reverse_depth - 1, node_id);
+    }
+    else
+        node_id++;
+
+    // right beliefs of the node: b_a = f(b_l, b_r + l_b) and b_b = b_r + f(b_l, l_a)
+    API_polar::g0(b_r, l_b, b_a, n_elm_2);
+    API_polar::f(b_l, b_a, b_a, n_elm_2);
+    API_polar::g0(b_r, b_b, b_b, n_elm_2);
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::hard_decide()
+{
+    // the a posteriori LLRs of the root are stored after its left beliefs (this area is free after the decoding)
+    constexpr int n_frames = API_polar::get_n_frames();
+    R* l_app = this->l.data() + this->N * n_frames;
+    API_polar::g0(this->l.data(), this->get_b(this->m, 0), l_app, this->N);
+    API_polar::h(l_app, this->s.data(), this->N);
+}
+
+template<typename B, typename R, class API_polar>
+int
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::_decode_siho(const R* Y_N, B* V_K, const size_t frame_id)
+{
+    if (!API_polar::isAligned(Y_N))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+    if (!API_polar::isAligned(V_K))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'V_K' is misaligned memory.");
+
+    this->_load(Y_N);
+    this->_decode();
+    this->hard_decide();
+    this->_store(V_K);
+
+    return 0;
+}
+
+template<typename B, typename R, class API_polar>
+int
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::_decode_siho_cw(const R* Y_N, B* V_N, const size_t frame_id)
+{
+    if (!API_polar::isAligned(Y_N))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+    if (!API_polar::isAligned(V_N))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'V_N' is misaligned memory.");
+
+    this->_load(Y_N);
+    this->_decode();
+    this->hard_decide();
+    this->_store_cw(V_N);
+
+    return 0;
+}
+
+template<typename B, typename R, class API_polar>
+int
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::_decode_siso(const R* Y_N1, R* Y_N2, const size_t frame_id)
+{
+    if (!API_polar::isAligned(Y_N1))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N1' is misaligned memory.");
+
+    if (!API_polar::isAligned(Y_N2))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N2' is misaligned memory.");
+
+    // ----------------------------------------------------------------------------------------------------------- LOAD
+    this->_load(Y_N1);
+
+    // --------------------------------------------------------------------------------------------------------- DECODE
+    this->_decode();
+
+    // ---------------------------------------------------------------------------------------------------------- STORE
+    // the extrinsic information is the right beliefs of the root
+    constexpr int n_frames = API_polar::get_n_frames();
+    const R* b_root = this->get_b(this->m, 0);
+    if (n_frames == 1)
+        std::copy(b_root, b_root + this->N, Y_N2);
+    else
+    {
+        std::vector<R*> frames(n_frames);
+        for (auto f = 0; f < n_frames; f++)
+            frames[f] = Y_N2 + f * this->N;
+        tools::Reorderer_static<R, n_frames>::apply_rev(b_root, frames, this->N);
+    }
+
+    return 0;
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::_store(B* V_K)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+
+    if (n_frames == 1)
+        tools::fb_extract(this->polar_patterns.get_leaves_pattern_types(), this->s.data(), V_K);
+    else
+    {
+        tools::fb_extract<B, n_frames>(
+          this->polar_patterns.get_leaves_pattern_types(), this->s.data(), this->s_bis.data());
+
+        std::vector<B*> frames(n_frames);
+        for (auto f = 0; f < n_frames; f++)
+            frames[f] = V_K + f * this->K;
+        tools::Reorderer_static<B, n_frames>::apply_rev(this->s_bis.data(), frames, this->K);
+    }
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCAN_fast_sys<B, R, API_polar>::_store_cw(B* V_N)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+
+    if (n_frames == 1)
+        std::copy(this->s.begin(), this->s.begin() + this->N, V_N);
+    else
+    {
+        std::vector<B*> frames(n_frames);
+        for (auto f = 0; f < n_frames; f++)
+            frames[f] = V_N + f * this->N;
+        tools::Reorderer_static<B, n_frames>::apply_rev(this->s.data(), frames, this->N);
+    }
+}
+}
+}
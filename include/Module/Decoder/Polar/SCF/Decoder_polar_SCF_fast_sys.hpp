@@ -0,0 +1,116 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_polar_SCF_fast_sys.
+ */
+#ifndef DECODER_POLAR_SCF_FAST_SYS_
+#define DECODER_POLAR_SCF_FAST_SYS_
+
+#include <memory>
+#include <mipp.h>
+#include <utility>
+#include <vector>
+
+#include "Module/CRC/CRC.hpp"
+#include "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_seq.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_i.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_SCF_fast_sys
+ *
+ * \brief Successive Cancellation Flip (SCF) and Dynamic SCF (DSCF) decoder of systematic polar codes working on the
+ *        simplified tree of the fast SC decoder.
+ *
+ * The flip candidates are the hard decisions of the rate 1, repetition and SPC nodes. A decoding attempt restarts from
+ * the first flipped bit: the partial sums of the bits decoded before are recovered from the codeword of the first
+ * attempt and only the LLRs of the nodes on the path to this bit are computed again.
+ *
+ * With 'order' = 1 and 'alpha' = 0 the candidates are sorted by reliability (SCF). Otherwise the metric of the DSCF
+ * decoder is used and up to 'order' bits are flipped in a same attempt.
+ */
+template<typename B = int,
+         typename R = float,
+         class API_polar = tools::API_polar_dynamic_seq<B,
+                                                        R,
+                                                        tools::f_LLR<R>,
+                                                        tools::g_LLR<B, R>,
+                                                        tools::g0_LLR<R>,
+                                                        tools::h_LLR<B, R>,
+                                                        tools::xo_STD<B>>>
+class Decoder_polar_SCF_fast_sys : public Decoder_polar_SC_fast_sys<B, R, API_polar>
+{
+  protected:
+    std::shared_ptr<CRC<B>> crc;
+
+    const int n_flips; // maximum number of decoding attempts after the first one
+    const int order;   // maximum number of bits flipped in an attempt
+    const float alpha; // scaling factor of the DSCF metric (0 for the SCF metric)
+
+    std::vector<int> last_node;     // last node (pre-order id) of the sub-tree of each node
+    std::vector<float> reliability; // flip metric of the decision of each bit (last attempt)
+    std::vector<bool> is_candidate; // bits that can be flipped (last attempt)
+    mipp::vector<B> s_ref;          // codeword of the first attempt
+    mipp::vector<B> U_test;         // information bits checked by the CRC
+    std::vector<int> flips;         // flipped bits of the current attempt (sorted)
+    int restart_bit;                // first bit decoded again in the current attempt
+    size_t next_flip;               // next flip to apply in the current attempt
+
+    std::vector<std::pair<float, std::vector<int>>> flip_sets; // pending flip sets and their metrics
+    std::vector<std::pair<float, int>> new_flips;              // metrics of the flip sets extending the current one
+
+  public:
+    Decoder_polar_SCF_fast_sys(const int& K,
+                               const int& N,
+                               const std::vector<bool>& frozen_bits,
+                               const CRC<B>& crc,
+                               const int n_flips,
+                               const int order = 1,
+                               const float alpha = 0.f);
+
+    Decoder_polar_SCF_fast_sys(const int& K,
+                               const int& N,
+                               const std::vector<bool>& frozen_bits,
+                               const std::vector<tools::Pattern_polar_i*>& polar_patterns,
+                               const int idx_r0,
+                               const int idx_r1,
+                               const CRC<B>& crc,
+                               const int n_flips,
+                               const int order = 1,
+                               const float alpha = 0.f);
+
+    virtual ~Decoder_polar_SCF_fast_sys() = default;
+
+    virtual Decoder_polar_SCF_fast_sys<B, R, API_polar>* clone() const;
+
+    virtual void set_frozen_bits(const std::vector<bool>& frozen_bits);
+
+  protected:
+    void deep_copy(const Decoder_polar_SCF_fast_sys<B, R, API_polar>& m);
+
+    void _decode_flips(const size_t frame_id);
+    int _decode_siho(const R* Y_N, B* V_K, const size_t frame_id);
+    int _decode_siho_cw(const R* Y_N, B* V_N, const size_t frame_id);
+
+    virtual void recursive_decode(const int off_l, const int off_s, const int reverse_depth, int& node_id);
+    void decode_terminal(const int off_l, const int off_s, const int n_elmts, const tools::polar_node_t node_type);
+
+    bool check_crc(const size_t frame_id);
+    void add_flip_sets(const float metric, const int max_sets);
+
+  private:
+    void init_constructor();
+    int init_last_node(const int node_id, const int reverse_depth);
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hxx"
+#endif
+
+#endif /* DECODER_POLAR_SCF_FAST_SYS_ */
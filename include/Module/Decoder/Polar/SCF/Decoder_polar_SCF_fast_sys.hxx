@@ -0,0 +1,452 @@
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+
+#include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hpp"
+#include "Tools/Code/Polar/fb_extract.h"
+
+namespace aff3ct
+{
+namespace module
+{
+template<typename B, typename R, class API_polar>
+Decoder_polar_SCF_fast_sys<B, R, API_polar>::Decoder_polar_SCF_fast_sys(const int& K,
+                                                                        const int& N,
+                                                                        const std::vector<bool>& frozen_bits,
+                                                                        const CRC<B>& crc,
+                                                                        const int n_flips,
+                                                                        const int order,
+                                                                        const float alpha)
+  : Decoder_polar_SC_fast_sys<B, R, API_polar>(K, N, frozen_bits)
+  , crc(crc.clone())
+  , n_flips(n_flips)
+  , order(order)
+  , alpha(alpha)
+  , last_node(2 * N - 1)
+  , reliability(N)
+  , is_candidate(N)
+  , s_ref(N)
+  , U_test(K)
+  , restart_bit(0)
+  , next_flip(0)
+{
+    this->init_constructor();
+}
+
+template<typename B, typename R, class API_polar>
+Decoder_polar_SCF_fast_sys<B, R, API_polar>::Decoder_polar_SCF_fast_sys(
+  const int& K,
+  const int& N,
+  const std::vector<bool>& frozen_bits,
+  const std::vector<tools::Pattern_polar_i*>& polar_patterns,
+  const int idx_r0,
+  const int idx_r1,
+  const CRC<B>& crc,
+  const int n_flips,
+  const int order,
+  const float alpha)
+  : Decoder_polar_SC_fast_sys<B, R, API_polar>(K, N, frozen_bits, polar_patterns, idx_r0, idx_r1)
+  , crc(crc.clone())
+  , n_flips(n_flips)
+  , order(order)
+  , alpha(alpha)
+  , last_node(2 * N - 1)
+  , reliability(N)
+  , is_candidate(N)
+  , s_ref(N)
+  , U_test(K)
+  , restart_bit(0)
+  , next_flip(0)
+{
+    this->init_constructor();
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCF_fast_sys<B, R, API_polar>::init_constructor()
+{
+    const std::string name = "Decoder_polar_SCF_fast_sys";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    if (API_polar::get_n_frames() != 1)
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, "The inter-frame API_polar is not supported.");
+
+    if (this->crc->get_size() > this->K)
+    {
+        std::stringstream message;
+        message << "'crc->get_size()' has to be equal or smaller than 'K' ('crc->get_size()' = "
+                << this->crc->get_size() << ", 'K' = " << this->K << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->n_flips < 0)
+    {
+        std::stringstream message;
+        message << "'n_flips' has to be positive ('n_flips' = " << this->n_flips << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->order <= 0)
+    {
+        std::stringstream message;
+        message << "'order' has to be greater than 0 ('order' = " << this->order << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->alpha < 0.f)
+    {
+        std::stringstream message;
+        message << "'alpha' has to be positive ('alpha' = " << this->alpha << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->init_last_node(0, this->m);
+}
+
+template<typename B, typename R, class API_polar>
+Decoder_polar_SCF_fast_sys<B, R, API_polar>*
+Decoder_polar_SCF_fast_sys<B, R, API_polar>::clone() const
+{
+    auto m = new Decoder_polar_SCF_fast_sys(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCF_fast_sys<B, R, API_polar>::deep_copy(const Decoder_polar_SCF_fast_sys<B, R, API_polar>& m)
+{
+    Decoder_polar_SC_fast_sys<B, R, API_polar>::deep_copy(m);
+    if (m.crc != nullptr) this->crc.reset(m.crc->clone());
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCF_fast_sys<B, R, API_polar>::set_frozen_bits(const std::vector<bool>& fb)
+{
+    Decoder_polar_SC_fast_sys<B, R, API_polar>::set_frozen_bits(fb);
+    this->init_last_node(0, this->m);
+}
+
+template<typename B, typename R, class API_polar>
+int
+Decoder_polar_SCF_fast_sys<B, R, API_polar>::init_last_node(const int node_id, const int reverse_depth)
+{
+    const auto node_type = this->polar_patterns.get_node_type(node_id);
+    const bool is_terminal_pattern =
+      (node_type == tools::polar_node_t::RATE_0) || (node_type == tools::polar_node_t::RATE_1) ||
+      (node_type == tools::polar_node_t::REP) || (node_type == tools::polar_node_t::SPC);
+
+    auto last = node_id;
+    if (!is_terminal_pattern && reverse_depth)
+    {
+        last = this->init_last_node(node_id + 1, reverse_depth - 1);
+        last = this->init_last_node(last + 1, reverse_depth - 1);
+    }
+
+    this->last_node[node_id] = last;
+    return last;
+}
+
+template<typename B, typename R, class API_polar>
+int
+Decoder_polar_SCF_fast_sys<B, R, API_polar>::_decode_siho(const R* Y_N, B* V_K, const size_t frame_id)
+{
+    if (!API_polar::isAligned(Y_N))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+    if (!API_polar::isAligned(V_K))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'V_K' is misaligned memory.");
+
+    this->_load(Y_N);
+    this->_decode_flips(frame_id);
+    this->_store(V_K);
+
+    return 0;
+}
+
+template<typename B, typename R, class API_polar>
+int
+Decoder_polar_SCF_fast_sys<B, R, API_polar>::_decode_siho_cw(const R* Y_N, B* V_N, const size_t frame_id)
+{
+    if (!API_polar::isAligned(Y_N))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+    if (!API_polar::isAligned(V_N))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'V_N' is misaligned memory.");
+
+    this->_load(Y_N);
+    this->_decode_flips(frame_id);
+    this->_store_cw(V_N);
+
+    return 0;
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCF_fast_sys<B, R, API_polar>::_decode_flips(const size_t frame_id)
+{
+    // first attempt: standard SC decoding
+    this->flips.clear();
+    this->restart_bit = 0;
+    this->next_flip = 0;
+    int first_id = 0;
+    this->recursive_decode(0, 0, this->m, first_id);
+
+    if (this->n_flips == 0 || this->check_crc(frame_id)) return;
+
+    std::copy(this->s.begin(), this->s.begin() + this->N, this->s_ref.begin());
+    this->flip_sets.clear();
+    this->add_flip_sets(0.f, this->n_flips);
+
+    for (auto a = 0; a < this->n_flips && !this->flip_sets.empty(); a++)
+    {
+        // pop the most likely flip set
+        auto best = std::min_element(this->flip_sets.begin(),
+                                     this->flip_sets.end(),
+                                     [](const std::pair<float, std::vector<int>>& x,
+                                        const std::pair<float, std::vector<int>>& y) { return x.first < y.first; });
+        const auto metric = best->first;
+        this->flips.swap(best->second);
+        std::swap(*best, this->flip_sets.back());
+        this->flip_sets.pop_back();
+
+        // the bits before the first flip are the same as in the first attempt
+        std::copy(this->s_ref.begin(), this->s_ref.end(), this->s.begin());
+        this->restart_bit = this->flips[0];
+        this->next_flip = 0;
+        first_id = 0;
+        this->recursive_decode(0, 0, this->m, first_id);
+
+        if (this->check_crc(frame_id)) return;
+
+        if ((int)this->flips.size() < this->order) this->add_flip_sets(metric, this->n_flips - a - 1);
+    }
+
+    // no attempt verifies the CRC, return the SC decoding
+    std::copy(this->s_ref.begin(), this->s_ref.end(), this->s.begin());
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCF_fast_sys<B, R, API_polar>::add_flip_sets(const float metric, const int max_sets)
+{
+    if (max_sets <= 0) return;
+
+    // metrics of the current flip set extended with each candidate decoded after its last flip
+    this->new_flips.clear();
+    auto bias = 0.f;
+    const auto first = this->flips.empty() ? 0 : this->flips.back() + 1;
+    for (auto i = first; i < this->N; i++)
+        if (this->is_candidate[i])
+        {
+            if (this->alpha > 0.f) bias += std::log1p(std::exp(-this->alpha * this->reliability[i])) / this->alpha;
+            this->new_flips.push_back(std::make_pair(metric + this->reliability[i] + bias, i));
+        }
+
+    const auto by_metric = [](const std::pair<float, int>& x, const std::pair<float, int>& y)
+    { return x.first < y.first; };
+    if ((int)this->new_flips.size() > max_sets)
+    {
+        std::nth_element(
+          this->new_flips.begin(), this->new_flips.begin() + max_sets, this->new_flips.end(), by_metric);
+        this->new_flips.resize(max_sets);
+    }
+
+    for (auto& f : this->new_flips)
+    {
+        this->flip_sets.push_back(std::make_pair(f.first, this->flips));
+        this->flip_sets.back().second.push_back(f.second);
+    }
+
+    // only the sets that can still be tried are kept
+    if ((int)this->flip_sets.size() > max_sets)
+    {
+        std::nth_element(this->flip_sets.begin(),
+                         this->flip_sets.begin() + max_sets,
+                         this->flip_sets.end(),
+                         [](const std::pair<float, std::vector<int>>& x, const std::pair<float, std::vector<int>>& y)
+                         { return x.first < y.first; });
+        this->flip_sets.resize(max_sets);
+    }
+}
+
+template<typename B, typename R, class API_polar>
+bool
+Decoder_polar_SCF_fast_sys<B, R, API_polar>::check_crc(const size_t frame_id)
+{
+    tools::fb_extract(this->polar_patterns.get_leaves_pattern_types(), this->s.data(), this->U_test.data());
+    return this->crc->check(this->U_test, frame_id);
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCF_fast_sys<B, R, API_polar>::recursive_decode(const int off_l,
+                                                              const int off_s,
+                                                              const int reverse_depth,
+                                                              int& node_id)
+{
+    const int n_elmts = 1 << reverse_depth;
+    const int n_elm_2 = n_elmts >> 1;
+
+    // the sub-trees decoded before the restart bit are skipped
+    if (off_s + n_elmts <= this->restart_bit)
+    {
+        node_id = this->last_node[node_id];
+        return;
+    }
+
+    const auto node_type = this->polar_patterns.get_node_type(node_id);
+    const bool is_terminal_pattern =
+      (node_type == tools::polar_node_t::RATE_0) || (node_type == tools::polar_node_t::RATE_1) ||
+      (node_type == tools::polar_node_t::REP) || (node_type == tools::polar_node_t::SPC);
+
+    if (!is_terminal_pattern && reverse_depth)
+    {
+        auto& l = this->l;
+        auto& s = this->s;
+
+        // the node contains the restart bit: undo the xor to get back the partial sums of the children
+        if (off_s < this->restart_bit) API_polar::xo(s, off_s, off_s + n_elm_2, off_s, n_elm_2);
+
+        // f
+        if (off_s + n_elm_2 > this->restart_bit) switch (node_type)
+            {
+                case tools::polar_node_t::STANDARD:
+                    API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2);
+                    break;
+                case tools::polar_node_t::REP_LEFT:
+                    API_polar::f(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2);
+                    break;
+                default:
+                    break;
+            }
+
+        this->recursive_decode(off_l + n_elmts, off_s, reverse_depth - 1, ++node_id); // recursive call left
+
+        // g
+        switch (node_type)
+        {
+            case tools::polar_node_t::STANDARD:
+                API_polar::g(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2);
+                break;
+            case tools::polar_node_t::RATE_0_LEFT:
+                API_polar::g0(l, off_l, off_l + n_elm_2, off_l + n_elmts, n_elm_2);
+                break;
+            case tools::polar_node_t::REP_LEFT:
+                API_polar::gr(s, l, off_l, off_l + n_elm_2, off_s, off_l + n_elmts, n_elm_2);
+                break;
+            default:
+                break;
+        }
+
+        this->recursive_decode(off_l + n_elmts, off_s + n_elm_2, reverse_depth - 1, ++node_id); // recursive call right
+
+        // xor
+        switch (node_type)
+        {
+            case tools::polar_node_t::STANDARD:
+                API_polar::xo(s, off_s, off_s + n_elm_2, off_s, n_elm_2);
+                break;
+            case tools::polar_node_t::RATE_0_LEFT:
+                API_polar::xo0(s, off_s + n_elm_2, off_s, n_elm_2);
+                break;
+            case tools::polar_node_t::REP_LEFT:
+                API_polar::xo(s, off_s, off_s + n_elm_2, off_s, n_elm_2);
+                break;
+            default:
+                break;
+        }
+    }
+    else
+        this->decode_terminal(off_l, off_s, n_elmts, node_type);
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCF_fast_sys<B, R, API_polar>::decode_terminal(const int off_l,
+                                                             const int off_s,
+                                                             const int n_elmts,
+                                                             const tools::polar_node_t node_type)
+{
+    auto& l = this->l;
+    auto& s = this->s;
+    auto lambda = [&l, off_l](const int i) { return std::abs((float)l[off_l + i]); };
+
+    // h and the flip metrics of the decisions
+    auto spc_min = 0;
+    switch (node_type)
+    {
+        case tools::polar_node_t::RATE_0:
+            API_polar::h0(s, off_s, n_elmts);
+            for (auto i = 0; i < n_elmts; i++)
+                this->is_candidate[off_s + i] = false;
+            break;
+        case tools::polar_node_t::RATE_1:
+            API_polar::h(s, l, off_l, off_s, n_elmts);
+            for (auto i = 0; i < n_elmts; i++)
+            {
+                this->reliability[off_s + i] = lambda(i);
+                this->is_candidate[off_s + i] = true;
+            }
+            break;
+        case tools::polar_node_t::REP:
+        {
+            API_polar::rep(s, l, off_l, off_s, n_elmts);
+            auto sum = 0.f;
+            for (auto i = 0; i < n_elmts; i++)
+            {
+                sum += (float)l[off_l + i];
+                this->is_candidate[off_s + i] = false;
+            }
+            // the repeated bit is stored on the last position (like in 'fb_extract')
+            this->reliability[off_s + n_elmts - 1] = std::abs(sum);
+            this->is_candidate[off_s + n_elmts - 1] = true;
+            break;
+        }
+        case tools::polar_node_t::SPC:
+        {
+            API_polar::spc(s, l, off_l, off_s, n_elmts);
+            for (auto i = 1; i < n_elmts; i++)
+                if (lambda(i) < lambda(spc_min)) spc_min = i;
+            // flipping a bit also flips the least reliable one to keep the parity
+            for (auto i = 0; i < n_elmts; i++)
+            {
+                this->reliability[off_s + i] = lambda(i) + lambda(spc_min);
+                this->is_candidate[off_s + i] = i != spc_min;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+
+    // apply the flips of the node
+    const auto one = spu::tools::bit_init<B>();
+    while (this->next_flip < this->flips.size() && this->flips[this->next_flip] < off_s + n_elmts)
+    {
+        const auto bit = this->flips[this->next_flip++];
+        switch (node_type)
+        {
+            case tools::polar_node_t::RATE_1:
+                s[bit] ^= one;
+                break;
+            case tools::polar_node_t::REP:
+                for (auto i = 0; i < n_elmts; i++)
+                    s[off_s + i] ^= one;
+                break;
+            case tools::polar_node_t::SPC:
+                s[bit] ^= one;
+                s[off_s + spc_min] ^= one;
+                break;
+            default:
+                break;
+        }
+    }
+}
+}
+}
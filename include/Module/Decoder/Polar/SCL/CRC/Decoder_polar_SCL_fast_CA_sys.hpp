@@ -5,6 +5,7 @@
 #ifndef DECODER_POLAR_SCL_FAST_SYS_CA
 #define DECODER_POLAR_SCL_FAST_SYS_CA
 
+#include <cstdint>
 #include <memory>
 #include <mipp.h>
 #include <vector>
@@ -36,6 +37,13 @@ class Decoder_polar_SCL_fast_CA_sys : public Decoder_polar_SCL_fast_sys<B, R, AP
     std::shared_ptr<CRC<B>> crc;
     mipp::vector<B> U_test;
 
+    // the CRC syndrome of each path is updated after each leaf, it is a linear function of the bits of the leaves
+    bool crc_incr;                     // false if the CRC is bigger than 64 bits (or empty), then the paths are checked
+    bool crc_pruning;                  // delete the paths with a complete and wrong part of syndrome
+    std::vector<uint64_t> crc_contrib; // 'crc_contrib[i]' is added to the syndrome if the bit 'i' of a leaf is 1
+    std::vector<uint64_t> crc_done;    // bits of the syndrome which are complete once the bit 'i' is decided
+    std::vector<uint64_t> syndromes;   // the CRC syndrome of each path (0 if the CRC is verified)
+
   public:
     Decoder_polar_SCL_fast_CA_sys(const int& K,
                                   const int& N,
@@ -56,6 +64,19 @@ class Decoder_polar_SCL_fast_CA_sys : public Decoder_polar_SCL_fast_sys<B, R, AP
 
     virtual Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>* clone() const;
 
+    virtual void set_frozen_bits(const std::vector<bool>& frozen_bits);
+
+    /*!
+     * \brief Enables the early pruning of the paths on the CRC.
+     *
+     * A path is deleted as soon as a bit of its CRC syndrome depends only on decided bits and is not 0 (the last
+     * active path is never deleted). The pruning happens early when the CRC bits are distributed among the
+     * information bits, with a CRC appended at the end of the frame it only concerns the last leaves.
+     *
+     * \param crc_pruning: true to enable the pruning (disabled by default).
+     */
+    void set_crc_pruning(const bool crc_pruning);
+
   protected:
     void deep_copy(const Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>& m);
 
@@ -64,6 +85,14 @@ class Decoder_polar_SCL_fast_CA_sys : public Decoder_polar_SCL_fast_sys<B, R, AP
 
     virtual void init_buffers();
     virtual void _store(B* V_K) const;
+
+    virtual void leaf_decided(const int off_s, const int n_elmts);
+    virtual void path_duplicated(const int old_path, const int new_path);
+
+    void init_crc_contrib();
+
+  private:
+    void transpose_tree(const int off_s, const int rev_depth, int& node_id);
 };
 }
 }
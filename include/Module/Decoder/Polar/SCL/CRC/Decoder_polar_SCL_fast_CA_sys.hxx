@@ -20,6 +20,11 @@ Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::Decoder_polar_SCL_fast_CA_sys(co
   , fast_store(false)
   , crc(crc.clone())
   , U_test(K)
+  , crc_incr(false)
+  , crc_pruning(false)
+  , crc_contrib(N)
+  , crc_done(N)
+  , syndromes(L)
 {
     const std::string name = "Decoder_polar_SCL_fast_CA_sys";
     this->set_name(name);
@@ -33,6 +38,8 @@ Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::Decoder_polar_SCL_fast_CA_sys(co
                 << this->crc->get_size() << ", 'K' = " << K << ").";
         throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
     }
+
+    this->init_crc_contrib();
 }
 
 template<typename B, typename R, class API_polar>
@@ -49,6 +56,11 @@ Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::Decoder_polar_SCL_fast_CA_sys(
   , fast_store(false)
   , crc(crc.clone())
   , U_test(K)
+  , crc_incr(false)
+  , crc_pruning(false)
+  , crc_contrib(N)
+  , crc_done(N)
+  , syndromes(L)
 {
     const std::string name = "Decoder_polar_SCL_fast_CA_sys";
     this->set_name(name);
@@ -62,6 +74,8 @@ Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::Decoder_polar_SCL_fast_CA_sys(
                 << this->crc->get_size() << ", 'K' = " << K << ").";
         throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
     }
+
+    this->init_crc_contrib();
 }
 
 template<typename B, typename R, class API_polar>
@@ -81,6 +95,131 @@ Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::deep_copy(const Decoder_polar_SC
     if (m.crc != nullptr) this->crc.reset(m.crc->clone());
 }
 
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::set_frozen_bits(const std::vector<bool>& frozen_bits)
+{
+    Decoder_polar_SCL_fast_sys<B, R, API_polar>::set_frozen_bits(frozen_bits);
+    this->init_crc_contrib();
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::set_crc_pruning(const bool crc_pruning)
+{
+    this->crc_pruning = crc_pruning;
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::init_crc_contrib()
+{
+    const auto crc_size = this->crc->get_size();
+    const auto K_crc = this->crc->get_K();
+
+    this->crc_incr = crc_size > 0 && crc_size <= 64;
+    if (!this->crc_incr) return;
+
+    // the bit 'j' of a CRC is its coefficient of degree 'crc_size - 1 - j', the CRC of a message with only its last
+    // bit to 1 is 'x^crc_size mod P' (that is 'P' without its MSB)
+    uint64_t poly = 0;
+    if (K_crc > 0)
+    {
+        const auto n_frames = (int)this->crc->get_n_frames();
+        std::vector<B> U_K1(K_crc * n_frames, (B)0), U_K2((K_crc + crc_size) * n_frames);
+        for (auto f = 0; f < n_frames; f++)
+            U_K1[f * K_crc + K_crc - 1] = (B)1;
+        this->crc->build(U_K1.data(), U_K2.data());
+        for (auto j = 0; j < crc_size; j++)
+            poly |= (uint64_t)(U_K2[K_crc + j] != 0) << j;
+    }
+
+    // contribution of each information bit to the syndrome (the computed CRC plus the received CRC): going one bit
+    // back in the message multiplies its CRC by 'x'
+    std::vector<uint64_t> info_contrib(this->K);
+    auto r = poly;
+    for (auto k = K_crc - 1; k >= 0; k--)
+    {
+        info_contrib[k] = r;
+        r = (r >> 1) ^ ((r & 1) ? poly : (uint64_t)0);
+    }
+    for (auto j = 0; j < crc_size; j++)
+        info_contrib[K_crc + j] = (uint64_t)1 << j;
+
+    // contribution of each bit of the codeword, the information bits are extracted as in 'fb_extract'
+    const auto& leaves = this->polar_patterns.get_leaves_pattern_types();
+    std::fill(this->crc_contrib.begin(), this->crc_contrib.end(), (uint64_t)0);
+    auto off_s = 0;
+    auto k = 0;
+    for (auto& leaf : leaves)
+    {
+        const auto n_elmts = leaf.second;
+        switch ((tools::polar_node_t)leaf.first)
+        {
+            case tools::polar_node_t::RATE_1:
+                for (auto i = 0; i < n_elmts; i++)
+                    this->crc_contrib[off_s + i] = info_contrib[k++];
+                break;
+            case tools::polar_node_t::REP:
+                this->crc_contrib[off_s + n_elmts - 1] = info_contrib[k++];
+                break;
+            case tools::polar_node_t::SPC:
+                for (auto i = 1; i < n_elmts; i++)
+                    this->crc_contrib[off_s + i] = info_contrib[k++];
+                break;
+            default:
+                break;
+        }
+        off_s += n_elmts;
+    }
+
+    // contribution of each bit of the leaves, before the XORs of the partial sums of the internal nodes
+    int node_id = 0;
+    this->transpose_tree(0, this->m, node_id);
+
+    // the rate 0 leaves do not contribute, then the syndrome bits which do not depend on the next bits are complete
+    const auto crc_mask = crc_size == 64 ? ~(uint64_t)0 : (((uint64_t)1 << crc_size) - 1);
+    uint64_t next_bits = 0;
+    off_s = this->N;
+    for (auto l = (int)leaves.size() - 1; l >= 0; l--)
+    {
+        const auto n_elmts = leaves[l].second;
+        off_s -= n_elmts;
+        if ((tools::polar_node_t)leaves[l].first == tools::polar_node_t::RATE_0)
+            std::fill(this->crc_contrib.begin() + off_s, this->crc_contrib.begin() + off_s + n_elmts, (uint64_t)0);
+        for (auto i = off_s + n_elmts - 1; i >= off_s; i--)
+        {
+            this->crc_done[i] = crc_mask & ~next_bits;
+            next_bits |= this->crc_contrib[i];
+        }
+    }
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::transpose_tree(const int off_s, const int rev_depth, int& node_id)
+{
+    const int n_elm_2 = (1 << rev_depth) >> 1;
+    const auto node_type = this->polar_patterns.get_node_type(node_id);
+
+    const bool is_terminal_pattern = (node_type == tools::polar_node_t::RATE_0) ||
+                                     (node_type == tools::polar_node_t::RATE_1) ||
+                                     (node_type == tools::polar_node_t::REP) || (node_type == tools::polar_node_t::SPC);
+
+    // same traversal as 'recursive_decode': the partial sums of a right child are added to the left child, so the
+    // contributions of the left child are added to the right child, from the root to the leaves
+    if (rev_depth == this->m || (!is_terminal_pattern && rev_depth))
+    {
+        if (node_type == tools::polar_node_t::STANDARD || node_type == tools::polar_node_t::RATE_0_LEFT ||
+            node_type == tools::polar_node_t::REP_LEFT)
+            for (auto i = 0; i < n_elm_2; i++)
+                this->crc_contrib[off_s + n_elm_2 + i] ^= this->crc_contrib[off_s + i];
+
+        this->transpose_tree(off_s, rev_depth - 1, ++node_id);
+        this->transpose_tree(off_s + n_elm_2, rev_depth - 1, ++node_id);
+    }
+}
+
 template<typename B, typename R, class API_polar>
 bool
 Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::crc_check(mipp::vector<B>& s, const size_t frame_id)
@@ -100,8 +239,18 @@ Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::select_best_path(const size_t fr
               [this](int x, int y) { return this->metrics[x] < this->metrics[y]; });
 
     auto i = 0;
-    while (i < this->n_active_paths && !crc_check(this->s[this->paths[i]], frame_id))
-        i++;
+    if (this->crc_incr)
+    {
+        while (i < this->n_active_paths && this->syndromes[this->paths[i]])
+            i++;
+
+        if (i < this->n_active_paths)
+            tools::fb_extract(
+              this->polar_patterns.get_leaves_pattern_types(), this->s[this->paths[i]].data(), U_test.data());
+    }
+    else
+        while (i < this->n_active_paths && !crc_check(this->s[this->paths[i]], frame_id))
+            i++;
 
     this->best_path = (i == this->n_active_paths) ? this->paths[0] : this->paths[i];
     fast_store = i != this->n_active_paths;
@@ -115,6 +264,7 @@ Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::init_buffers()
 {
     Decoder_polar_SCL_fast_sys<B, R, API_polar>::init_buffers();
     fast_store = false;
+    this->syndromes[0] = 0;
 }
 
 template<typename B, typename R, class API_polar>
@@ -126,5 +276,38 @@ Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::_store(B* V_K) const
     else
         Decoder_polar_SCL_fast_sys<B, R, API_polar>::_store(V_K);
 }
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::leaf_decided(const int off_s, const int n_elmts)
+{
+    if (!this->crc_incr) return;
+
+    for (auto i = 0; i < this->n_active_paths; i++)
+    {
+        const auto path = this->paths[i];
+        auto syndrome = this->syndromes[path];
+        for (auto j = off_s; j < off_s + n_elmts; j++)
+            syndrome ^= this->s[path][j] ? this->crc_contrib[j] : (uint64_t)0;
+        this->syndromes[path] = syndrome;
+    }
+
+    if (this->crc_pruning)
+    {
+        const auto done = this->crc_done[off_s + n_elmts - 1];
+        auto i = 0;
+        while (done && i < this->n_active_paths && this->n_active_paths > 1)
+            if (this->syndromes[this->paths[i]] & done)
+                this->delete_path(i);
+            else
+                i++;
+    }
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_fast_CA_sys<B, R, API_polar>::path_duplicated(const int old_path, const int new_path)
+{
+    this->syndromes[new_path] = this->syndromes[old_path];
+}
 }
 }
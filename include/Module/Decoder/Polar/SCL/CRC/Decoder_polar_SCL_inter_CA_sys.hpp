@@ -0,0 +1,53 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_polar_SCL_inter_CA_sys.
+ */
+#ifndef DECODER_POLAR_SCL_INTER_CA_SYS
+#define DECODER_POLAR_SCL_INTER_CA_SYS
+
+#include <memory>
+#include <mipp.h>
+#include <vector>
+
+#include "Module/CRC/CRC.hpp"
+#include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_inter_sys.hpp"
+#include "Tools/Code/Polar/API/API_polar_dynamic_inter.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template<typename B = int, typename R = float, class API_polar = tools::API_polar_dynamic_inter<B, R>>
+class Decoder_polar_SCL_inter_CA_sys : public Decoder_polar_SCL_inter_sys<B, R, API_polar>
+{
+  protected:
+    std::shared_ptr<CRC<B>> crc;
+    mipp::vector<B> U_test;      // information bits of the tested path
+    mipp::vector<B> s_test;      // codeword of the tested path
+    std::vector<int> paths_lane; // paths of a lane sorted by metric
+
+  public:
+    Decoder_polar_SCL_inter_CA_sys(const int& K,
+                                   const int& N,
+                                   const int& L,
+                                   const std::vector<bool>& frozen_bits,
+                                   const CRC<B>& crc);
+
+    virtual ~Decoder_polar_SCL_inter_CA_sys() = default;
+
+    virtual Decoder_polar_SCL_inter_CA_sys<B, R, API_polar>* clone() const;
+
+  protected:
+    void deep_copy(const Decoder_polar_SCL_inter_CA_sys<B, R, API_polar>& m);
+
+    bool crc_check(const int path, const int lane, const size_t frame_id);
+    virtual void select_best_paths(const size_t frame_id);
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_inter_CA_sys.hxx"
+#endif
+
+#endif /* DECODER_POLAR_SCL_INTER_CA_SYS */
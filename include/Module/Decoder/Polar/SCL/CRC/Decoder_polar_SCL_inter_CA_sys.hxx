@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+
+#include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_inter_CA_sys.hpp"
+#include "Tools/Code/Polar/fb_extract.h"
+
+namespace aff3ct
+{
+namespace module
+{
+template<typename B, typename R, class API_polar>
+Decoder_polar_SCL_inter_CA_sys<B, R, API_polar>::Decoder_polar_SCL_inter_CA_sys(const int& K,
+                                                                                const int& N,
+                                                                                const int& L,
+                                                                                const std::vector<bool>& frozen_bits,
+                                                                                const CRC<B>& crc)
+  : Decoder_polar_SCL_inter_sys<B, R, API_polar>(K, N, L, frozen_bits)
+  , crc(crc.clone())
+  , U_test(K)
+  , s_test(N)
+  , paths_lane(L)
+{
+    const std::string name = "Decoder_polar_SCL_inter_CA_sys";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    if (this->crc->get_size() > K)
+    {
+        std::stringstream message;
+        message << "'crc->get_size()' has to be equal or smaller than 'K' ('crc->get_size()' = "
+                << this->crc->get_size() << ", 'K' = " << K << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+}
+
+template<typename B, typename R, class API_polar>
+Decoder_polar_SCL_inter_CA_sys<B, R, API_polar>*
+Decoder_polar_SCL_inter_CA_sys<B, R, API_polar>::clone() const
+{
+    auto m = new Decoder_polar_SCL_inter_CA_sys(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_inter_CA_sys<B, R, API_polar>::deep_copy(const Decoder_polar_SCL_inter_CA_sys<B, R, API_polar>& m)
+{
+    Decoder_polar_SCL_inter_sys<B, R, API_polar>::deep_copy(m);
+    if (m.crc != nullptr) this->crc.reset(m.crc->clone());
+}
+
+template<typename B, typename R, class API_polar>
+bool
+Decoder_polar_SCL_inter_CA_sys<B, R, API_polar>::crc_check(const int path, const int lane, const size_t frame_id)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+
+    // deinterleave the codeword of the path in the lane
+    const auto s = this->s[path].data();
+    for (auto i = 0; i < this->N; i++)
+        this->s_test[i] = s[i * n_frames + lane];
+
+    tools::fb_extract(this->polar_patterns.get_leaves_pattern_types(), this->s_test.data(), this->U_test.data());
+
+    // check the CRC
+    return this->crc->check(this->U_test, frame_id + lane);
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_inter_CA_sys<B, R, API_polar>::select_best_paths(const size_t frame_id)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+
+    for (auto f = 0; f < n_frames; f++)
+    {
+        std::iota(this->paths_lane.begin(), this->paths_lane.begin() + this->n_active_paths, 0);
+        std::sort(this->paths_lane.begin(),
+                  this->paths_lane.begin() + this->n_active_paths,
+                  [this, f](int x, int y)
+                  { return this->metrics[x * n_frames + f] < this->metrics[y * n_frames + f]; });
+
+        auto i = 0;
+        while (i < this->n_active_paths && !crc_check(this->paths_lane[i], f, frame_id))
+            i++;
+
+        this->best_path[f] = (i == this->n_active_paths) ? this->paths_lane[0] : this->paths_lane[i];
+    }
+}
+}
+}
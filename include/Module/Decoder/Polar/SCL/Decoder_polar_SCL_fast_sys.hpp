@@ -108,6 +108,12 @@ class Decoder_polar_SCL_fast_sys
     virtual inline int select_best_path(const size_t frame_id);
     inline int up_ref_array_idx(const int path, const int r_d); // return the array
 
+    // hooks for the derived decoders which follow a state per path (they do nothing here): 'leaf_decided' is called
+    // once the bits of the leaf ['off_s', 'off_s' + 'n_elmts'[ are decided for all the active paths (except for the
+    // rate 0 leaves) and 'path_duplicated' is called when 'new_path' is created from 'old_path'
+    virtual inline void leaf_decided(const int off_s, const int n_elmts);
+    virtual inline void path_duplicated(const int old_path, const int new_path);
+
   private:
     inline void flip_bits_r1(const int old_path, const int new_path, const int dup, const int off_s, const int n_elmts);
     inline void flip_bits_spc(const int old_path,
@@ -731,6 +731,8 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::update_paths_r1(const int r_d,
 
             dup_count[path]--;
         }
+
+        leaf_decided(off_s, n_elmts);
     }
 }
 
@@ -817,6 +819,8 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::update_paths_r1(const int off_l, co
 
             dup_count[path]--;
         }
+
+        leaf_decided(off_s, N_ELMTS);
     }
 }
 
@@ -931,6 +935,8 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::update_paths_rep(const int r_d,
             dup_count[path] = 0;
         }
     }
+
+    leaf_decided(off_s, n_elmts);
 }
 
 template<typename B, typename R, class API_polar>
@@ -1007,6 +1013,8 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::update_paths_rep(const int off_l, c
             dup_count[path] = 0;
         }
     }
+
+    leaf_decided(off_s, N_ELMTS);
 }
 
 template<typename B, typename R, class API_polar>
@@ -1130,6 +1138,8 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::update_paths_spc(const int r_d,
 
         dup_count[path]--;
     }
+
+    leaf_decided(off_s, n_elmts);
 }
 
 template<typename B, typename R, class API_polar>
@@ -1251,6 +1261,8 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::update_paths_spc(const int off_l, c
 
         dup_count[path]--;
     }
+
+    leaf_decided(off_s, N_ELMTS);
 }
 
 template<typename B, typename R, class API_polar>
@@ -1348,6 +1360,18 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::select_best_path(const size_t frame
     return n_active_paths;
 }
 
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_fast_sys<B, R, API_polar>::leaf_decided(const int off_s, const int n_elmts)
+{
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_fast_sys<B, R, API_polar>::path_duplicated(const int old_path, const int new_path)
+{
+}
+
 template<typename B, typename R, class API_polar>
 int
 Decoder_polar_SCL_fast_sys<B, R, API_polar>::up_ref_array_idx(const int path, const int r_d)
@@ -1403,6 +1427,8 @@ Decoder_polar_SCL_fast_sys<B, R, API_polar>::duplicate_tree(const int old_path,
 
     std::copy(s[old_path].begin(), s[old_path].begin() + off_s + n_elmts, s[new_path].begin());
 
+    path_duplicated(old_path, new_path);
+
     return new_path;
 }
 }
@@ -0,0 +1,113 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_polar_SCL_inter_sys.
+ */
+#ifndef DECODER_POLAR_SCL_INTER_SYS
+#define DECODER_POLAR_SCL_INTER_SYS
+
+#include <mipp.h>
+#include <vector>
+
+#include "Tools/Code/Polar/API/API_polar_dynamic_inter.hpp"
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Tools/Interface/Interface_get_set_frozen_bits.hpp"
+
+#include "Module/Decoder/Decoder_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_SCL_inter_sys
+ *
+ * \brief Successive Cancellation List decoder of systematic polar codes, decodes one frame per SIMD lane.
+ *
+ * The LLRs and the partial sums of each path are interleaved like in the inter-frame SC decoder and the f, g and xor
+ * functions of a path process all the frames at once. Each lane has its own path metrics and its own pruning: the
+ * metrics of a path are one register of lanes and the candidates are ranked in registers, then when a path is
+ * duplicated in some lanes only, its data is copied in the free path of these lanes with masked blends. Only the
+ * partial sums and the LLR levels that are read again after the current bit are copied. With the fixed-point types,
+ * the metrics saturate and are normalized after each information bit.
+ *
+ * The tree is pruned with the rate 0 nodes only (the list decoding of the specialized nodes is sequential by nature).
+ */
+template<typename B = int, typename R = float, class API_polar = tools::API_polar_dynamic_inter<B, R>>
+class Decoder_polar_SCL_inter_sys
+  : public Decoder_SIHO<B, R>
+  , public tools::Interface_get_set_frozen_bits
+{
+  protected:
+    const int m; // graph depth
+    const int L; // maximum paths number
+    std::vector<bool> frozen_bits;
+    tools::Pattern_polar_parser polar_patterns;
+
+    int n_active_paths;             // number of active paths (the same in all the lanes)
+    mipp::vector<R> y;              // interleaved channel LLRs
+    std::vector<mipp::vector<R>> l; // interleaved LLRs of each path (all the levels of the tree)
+    std::vector<mipp::vector<B>> s; // interleaved partial sums of each path
+    mipp::vector<B> s_bis;          // interleaved codewords of the best paths
+    mipp::vector<B> s_ext;          // interleaved information bits of the best paths
+
+    // the following vectors are indexed by 'path * n_frames + lane': each path has one register of lanes
+    mipp::vector<R> metrics;     // path metrics
+    mipp::vector<R> metrics_new; // metrics of the selected candidates
+    mipp::vector<R> src_path;    // path to copy in a free path ('-1' when the path is not a copy)
+    mipp::vector<B> bits;        // bit of the current leaf of each path
+
+    // the following vectors are indexed by 'c * n_frames + lane', the candidate 'c' is the path 'c / 2' with the bit
+    // 'c % 2'
+    mipp::vector<R> cand_metrics; // metrics of the 2L candidates
+    mipp::vector<R> cand_rank;    // rank of the candidates in their lane (the L first ones are selected)
+    std::vector<int> best_path;   // best path of each lane
+
+  public:
+    Decoder_polar_SCL_inter_sys(const int& K, const int& N, const int& L, const std::vector<bool>& frozen_bits);
+
+    virtual ~Decoder_polar_SCL_inter_sys() = default;
+
+    virtual Decoder_polar_SCL_inter_sys<B, R, API_polar>* clone() const;
+
+    virtual void set_frozen_bits(const std::vector<bool>& frozen_bits);
+    virtual const std::vector<bool>& get_frozen_bits() const;
+
+  protected:
+    void _load(const R* Y_N);
+    void _decode();
+    int _decode_siho(const R* Y_N, B* V_K, const size_t frame_id);
+    int _decode_siho_cw(const R* Y_N, B* V_N, const size_t frame_id);
+    void _store(B* V_K);
+    void _store_cw(B* V_N);
+
+    virtual void init_buffers();
+    virtual void select_best_paths(const size_t frame_id);
+
+    void recursive_decode(const int off_s, const int rev_depth, int& node_id);
+    void update_paths_r0(const int off_s, const int rev_depth);
+    void update_paths_r1(const int off_s);
+
+    inline R* get_llr(const int path, const int rev_depth);
+    void copy_paths(const int off_s, const bool same_src);
+    void gather_best_paths();
+
+  private:
+    void select_candidates();
+
+    // copy the elements ['first', 'last') of the path 'r_src[f]' in the lane 'f' of 'dst' (lanes with 'r_src[f] < 0'
+    // are left untouched)
+    template<typename T>
+    void blend_lanes(const std::vector<mipp::vector<T>>& buf,
+                     const mipp::Reg<R>& r_src,
+                     T* dst,
+                     const int first,
+                     const int last) const;
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_inter_sys.hxx"
+#endif
+
+#endif /* DECODER_POLAR_SCL_INTER_SYS */
@@ -0,0 +1,549 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+
+#include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_inter_sys.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r0_left.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_r1.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_std.hpp"
+#include "Tools/Code/Polar/fb_assert.h"
+#include "Tools/Code/Polar/fb_extract.h"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template<typename B, typename R, class API_polar>
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::Decoder_polar_SCL_inter_sys(const int& K,
+                                                                          const int& N,
+                                                                          const int& L,
+                                                                          const std::vector<bool>& frozen_bits)
+  : Decoder_SIHO<B, R>(K, N)
+  , m((int)std::log2(N))
+  , L(L)
+  , frozen_bits(frozen_bits)
+  , polar_patterns(frozen_bits,
+                   { new tools::Pattern_polar_std,
+                     new tools::Pattern_polar_r0_left,
+                     new tools::Pattern_polar_r0,
+                     new tools::Pattern_polar_r1(0, 0) }, // the rate 1 nodes are only the leaves
+                   2,
+                   3,
+                   true)
+  , n_active_paths(1)
+  , y(N * API_polar::get_n_frames())
+  , l(L, mipp::vector<R>(N * API_polar::get_n_frames()))
+  , s(L, mipp::vector<B>(N * API_polar::get_n_frames()))
+  , s_bis(N * API_polar::get_n_frames())
+  , s_ext(std::max(K, 1) * API_polar::get_n_frames())
+  , metrics(L * API_polar::get_n_frames())
+  , metrics_new(L * API_polar::get_n_frames())
+  , src_path(L * API_polar::get_n_frames(), (R)-1)
+  , bits(L * API_polar::get_n_frames())
+  , cand_metrics(2 * L * API_polar::get_n_frames())
+  , cand_rank(2 * L * API_polar::get_n_frames())
+  , best_path(API_polar::get_n_frames())
+{
+    const std::string name = "Decoder_polar_SCL_inter_sys";
+    this->set_name(name);
+    this->set_n_frames_per_wave(API_polar::get_n_frames());
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    static_assert(sizeof(B) == sizeof(R), "Sizes of the bits and reals have to be identical.");
+    static_assert(API_polar::get_n_frames() == mipp::N<R>(),
+                  "The number of frames has to be the number of elements of a register.");
+
+    if (!spu::tools::is_power_of_2(this->N) || this->N < 2)
+    {
+        std::stringstream message;
+        message << "'N' has to be a power of 2 greater than 1 ('N' = " << N << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->N != (int)frozen_bits.size())
+    {
+        std::stringstream message;
+        message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+                << ", 'N' = " << N << ").";
+        throw spu::tools::length_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->L <= 0 || !spu::tools::is_power_of_2(this->L))
+    {
+        std::stringstream message;
+        message << "'L' has to be a positive power of 2 ('L' = " << L << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    // the ranks of the 2L candidates are counted in the type of the LLRs
+    if ((long long)(2 * this->L - 1) > (long long)std::numeric_limits<R>::max())
+    {
+        std::stringstream message;
+        message << "'2 * L - 1' has to be smaller than or equal to the maximum value of the LLR type ('L' = " << L
+                << ", 'std::numeric_limits<R>::max()' = " << (long long)std::numeric_limits<R>::max() << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    auto k = 0;
+    for (auto i = 0; i < this->N; i++)
+        if (frozen_bits[i] == 0) k++;
+    if (this->K != k)
+    {
+        std::stringstream message;
+        message << "The number of information bits in the frozen_bits is invalid ('K' = " << K << ", 'k' = " << k
+                << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+}
+
+template<typename B, typename R, class API_polar>
+Decoder_polar_SCL_inter_sys<B, R, API_polar>*
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::clone() const
+{
+    auto m = new Decoder_polar_SCL_inter_sys(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::set_frozen_bits(const std::vector<bool>& fb)
+{
+    aff3ct::tools::fb_assert(fb, this->K, this->N);
+    std::copy(fb.begin(), fb.end(), this->frozen_bits.begin());
+    polar_patterns.set_frozen_bits(fb);
+}
+
+template<typename B, typename R, class API_polar>
+const std::vector<bool>&
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::get_frozen_bits() const
+{
+    return this->frozen_bits;
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::init_buffers()
+{
+    this->n_active_paths = 1;
+    std::fill(this->metrics.begin(), this->metrics.end(), (R)0);
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::_load(const R* Y_N)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+
+    std::vector<const R*> frames(n_frames);
+    for (auto f = 0; f < n_frames; f++)
+        frames[f] = Y_N + f * this->N;
+    tools::Reorderer_static<R, n_frames>::apply(frames, this->y.data(), this->N);
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::_decode()
+{
+    int first_node_id = 0, off_s = 0;
+    this->recursive_decode(off_s, this->m, first_node_id);
+}
+
+template<typename B, typename R, class API_polar>
+int
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::_decode_siho(const R* Y_N, B* V_K, const size_t frame_id)
+{
+    if (!API_polar::isAligned(Y_N))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+    if (!API_polar::isAligned(V_K))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'V_K' is misaligned memory.");
+
+    this->init_buffers();
+    this->_load(Y_N);
+    this->_decode();
+    this->select_best_paths(frame_id);
+    this->_store(V_K);
+
+    return 0;
+}
+
+template<typename B, typename R, class API_polar>
+int
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::_decode_siho_cw(const R* Y_N, B* V_N, const size_t frame_id)
+{
+    if (!API_polar::isAligned(Y_N))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'Y_N' is misaligned memory.");
+
+    if (!API_polar::isAligned(V_N))
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'V_N' is misaligned memory.");
+
+    this->init_buffers();
+    this->_load(Y_N);
+    this->_decode();
+    this->select_best_paths(frame_id);
+    this->_store_cw(V_N);
+
+    return 0;
+}
+
+template<typename B, typename R, class API_polar>
+R*
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::get_llr(const int path, const int rev_depth)
+{
+    // the root LLRs are shared by all the paths, the node of depth 'rev_depth' is stored at 'N - 2^(rev_depth +1)'
+    if (rev_depth == this->m) return this->y.data();
+    return this->l[path].data() + (this->N - (2 << rev_depth)) * API_polar::get_n_frames();
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::recursive_decode(const int off_s, const int rev_depth, int& node_id)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+
+    const int n_elmts = 1 << rev_depth;
+    const int n_elm_2 = n_elmts >> 1;
+    const auto node_type = polar_patterns.get_node_type(node_id);
+
+    if (node_type == tools::polar_node_t::RATE_0)
+        this->update_paths_r0(off_s, rev_depth);
+    else if (node_type == tools::polar_node_t::RATE_1)
+        this->update_paths_r1(off_s);
+    else
+    {
+        const auto is_r0_left = node_type == tools::polar_node_t::RATE_0_LEFT;
+
+        // f (the LLRs of a rate 0 left child are only used to penalize the paths)
+        if (!is_r0_left || this->n_active_paths > 1)
+            for (auto p = 0; p < this->n_active_paths; p++)
+            {
+                const auto parent = this->get_llr(p, rev_depth);
+                API_polar::f(parent, parent + n_elm_2 * n_frames, this->get_llr(p, rev_depth - 1), n_elm_2);
+            }
+
+        this->recursive_decode(off_s, rev_depth - 1, ++node_id); // recursive call left
+
+        // g
+        for (auto p = 0; p < this->n_active_paths; p++)
+        {
+            const auto parent = this->get_llr(p, rev_depth);
+            const auto child = this->get_llr(p, rev_depth - 1);
+            if (is_r0_left)
+                API_polar::g0(parent, parent + n_elm_2 * n_frames, child, n_elm_2);
+            else
+                API_polar::g(parent, parent + n_elm_2 * n_frames, this->s[p].data() + off_s * n_frames, child, n_elm_2);
+        }
+
+        this->recursive_decode(off_s + n_elm_2, rev_depth - 1, ++node_id); // recursive call right
+
+        // xor
+        for (auto p = 0; p < this->n_active_paths; p++)
+        {
+            const auto s_a = this->s[p].data() + off_s * n_frames;
+            if (is_r0_left)
+                API_polar::xo0(s_a + n_elm_2 * n_frames, s_a, n_elm_2);
+            else
+                API_polar::xo(s_a, s_a + n_elm_2 * n_frames, s_a, n_elm_2);
+        }
+    }
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::update_paths_r0(const int off_s, const int rev_depth)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+    const int n_elmts = 1 << rev_depth;
+
+    if (this->n_active_paths > 1)
+    {
+        const mipp::Reg<R> r_zero = (R)0;
+        for (auto p = 0; p < this->n_active_paths; p++)
+        {
+            const auto llr = this->get_llr(p, rev_depth);
+            const auto met = this->metrics.data() + p * n_frames;
+
+            // the negative LLRs penalize the path (the fixed-point metrics saturate)
+            mipp::Reg<R> r_met = met;
+            for (auto i = 0; i < n_elmts; i++)
+                r_met -= mipp::min(mipp::Reg<R>(llr + i * n_frames), r_zero);
+            r_met.store(met);
+        }
+    }
+
+    for (auto p = 0; p < this->n_active_paths; p++)
+        API_polar::h0(this->s[p].data() + off_s * n_frames, n_elmts);
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::update_paths_r1(const int off_s)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+    const mipp::Reg<R> r_zero = (R)0;
+    const mipp::Reg<B> r_bit0 = (B)0;
+    const mipp::Reg<B> r_bit1 = spu::tools::bit_init<B>();
+
+    std::fill(this->src_path.begin(), this->src_path.end(), (R)-1);
+    if (2 * this->n_active_paths <= this->L)
+    {
+        // all the candidates are kept: the path 'p' takes the bit 0 and its copy 'n_active_paths + p' the bit 1
+        for (auto p = 0; p < this->n_active_paths; p++)
+        {
+            const auto q = this->n_active_paths + p;
+            const mipp::Reg<R> r_llr = this->get_llr(p, 0);
+            const mipp::Reg<R> r_met = this->metrics.data() + p * n_frames;
+            (r_met - mipp::min(r_llr, r_zero)).store(this->metrics.data() + p * n_frames);
+            (r_met + mipp::max(r_llr, r_zero)).store(this->metrics.data() + q * n_frames);
+            r_bit0.store(this->bits.data() + p * n_frames);
+            r_bit1.store(this->bits.data() + q * n_frames);
+            mipp::Reg<R>((R)p).store(this->src_path.data() + q * n_frames);
+        }
+
+        this->copy_paths(off_s, true);
+        this->n_active_paths *= 2;
+    }
+    else
+    {
+        for (auto p = 0; p < this->L; p++)
+        {
+            const mipp::Reg<R> r_llr = this->get_llr(p, 0);
+            const mipp::Reg<R> r_met = this->metrics.data() + p * n_frames;
+            (r_met - mipp::min(r_llr, r_zero)).store(this->cand_metrics.data() + (2 * p + 0) * n_frames);
+            (r_met + mipp::max(r_llr, r_zero)).store(this->cand_metrics.data() + (2 * p + 1) * n_frames);
+        }
+
+        this->select_candidates();
+
+        this->copy_paths(off_s, false);
+        std::copy(this->metrics_new.begin(), this->metrics_new.end(), this->metrics.begin());
+    }
+
+    // the best fixed-point metric of each lane is moved back to 0 to keep the dynamic range
+    if (!std::is_floating_point<R>::value)
+    {
+        mipp::Reg<R> r_min = this->metrics.data();
+        for (auto p = 1; p < this->n_active_paths; p++)
+            r_min = mipp::min(r_min, mipp::Reg<R>(this->metrics.data() + p * n_frames));
+        for (auto p = 0; p < this->n_active_paths; p++)
+            (mipp::Reg<R>(this->metrics.data() + p * n_frames) - r_min).store(this->metrics.data() + p * n_frames);
+    }
+
+    for (auto p = 0; p < this->n_active_paths; p++)
+        std::copy(this->bits.begin() + p * n_frames,
+                  this->bits.begin() + (p + 1) * n_frames,
+                  this->s[p].begin() + off_s * n_frames);
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::select_candidates()
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+    const int n_cands = 2 * this->L;
+    const mipp::Reg<R> r_zero = (R)0;
+    const mipp::Reg<R> r_one = (R)1;
+    const mipp::Reg<R> r_none = (R)-1;
+    const mipp::Reg<R> r_L = (R)this->L;
+    const mipp::Reg<B> r_bit0 = (B)0;
+    const mipp::Reg<B> r_bit1 = spu::tools::bit_init<B>();
+
+    const auto cand = [this](const int c) { return mipp::Reg<R>(this->cand_metrics.data() + c * n_frames); };
+    const auto rank = [this](const int c) { return this->cand_rank.data() + c * n_frames; };
+
+    // rank of each candidate in its lane: number of better candidates, the ties are broken by the candidate index
+    std::fill(this->cand_rank.begin(), this->cand_rank.end(), (R)0);
+    for (auto c = 1; c < n_cands; c++)
+    {
+        const auto r_c = cand(c);
+        auto r_rank_c = mipp::Reg<R>(rank(c));
+        for (auto d = 0; d < c; d++)
+        {
+            const auto m_d_first = cand(d) <= r_c;
+            r_rank_c += mipp::blend(r_one, r_zero, m_d_first);
+            (mipp::Reg<R>(rank(d)) + mipp::blend(r_zero, r_one, m_d_first)).store(rank(d));
+        }
+        r_rank_c.store(rank(c));
+    }
+
+    // a path keeps one of its selected candidates (the bit 0 first), the paths with two selected candidates and the
+    // paths without selected candidate are numbered in each lane: the k-th free path receives the bit 1 of the k-th
+    // path with two candidates
+    mipp::Reg<R> r_n_dup = r_zero, r_n_free = r_zero;
+    for (auto p = 0; p < this->L; p++)
+    {
+        const auto m_sel0 = mipp::Reg<R>(rank(2 * p + 0)) < r_L;
+        const auto m_sel1 = mipp::Reg<R>(rank(2 * p + 1)) < r_L;
+        const auto m_dup = m_sel0 & m_sel1;
+        const auto m_free = ~(m_sel0 | m_sel1);
+
+        mipp::blend(r_bit0, r_bit1, m_sel0).store(this->bits.data() + p * n_frames);
+        mipp::blend(cand(2 * p + 0), cand(2 * p + 1), m_sel0).store(this->metrics_new.data() + p * n_frames);
+
+        // the ranks of the path are not read anymore: their slots store the numbers of the path
+        mipp::blend(r_n_dup, r_none, m_dup).store(rank(2 * p + 0));
+        mipp::blend(r_n_free, r_none, m_free).store(rank(2 * p + 1));
+        r_n_dup += mipp::blend(r_one, r_zero, m_dup);
+        r_n_free += mipp::blend(r_one, r_zero, m_free);
+    }
+
+    for (auto q = 0; q < this->L; q++)
+    {
+        const mipp::Reg<R> r_free_id = rank(2 * q + 1);
+        const auto m_free = r_free_id >= r_zero;
+        if (mipp::testz(m_free)) continue;
+
+        mipp::Reg<R> r_src = r_none;
+        mipp::Reg<R> r_met = this->metrics_new.data() + q * n_frames;
+        for (auto p = 0; p < this->L; p++)
+        {
+            const auto m_src = m_free & (mipp::Reg<R>(rank(2 * p + 0)) == r_free_id);
+            r_src = mipp::blend(mipp::Reg<R>((R)p), r_src, m_src);
+            r_met = mipp::blend(cand(2 * p + 1), r_met, m_src);
+        }
+
+        r_src.store(this->src_path.data() + q * n_frames);
+        r_met.store(this->metrics_new.data() + q * n_frames);
+        mipp::blend(r_bit1, mipp::Reg<B>(this->bits.data() + q * n_frames), m_free)
+          .store(this->bits.data() + q * n_frames);
+    }
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::copy_paths(const int off_s, const bool same_src)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+    const mipp::Reg<R> r_zero = (R)0;
+
+    for (auto dst = 0; dst < this->L; dst++)
+    {
+        const mipp::Reg<R> r_src = this->src_path.data() + dst * n_frames;
+        if (mipp::testz(r_src >= r_zero)) continue;
+
+        // the partial sums of the decoded bits and the LLRs of the nodes whose right child is not decoded yet are the
+        // only data read after the current bit
+        const auto src0 = (int)this->src_path[dst * n_frames];
+        if (same_src)
+            std::copy(this->s[src0].begin(), this->s[src0].begin() + off_s * n_frames, this->s[dst].begin());
+        else
+            this->blend_lanes(this->s, r_src, this->s[dst].data(), 0, off_s);
+
+        for (auto r = 1; r < this->m; r++)
+            if (((off_s >> (r - 1)) & 1) == 0)
+            {
+                const auto first = this->N - (2 << r);
+                const auto last = first + (1 << r);
+                if (same_src)
+                    std::copy(this->l[src0].begin() + first * n_frames,
+                              this->l[src0].begin() + last * n_frames,
+                              this->l[dst].begin() + first * n_frames);
+                else
+                    this->blend_lanes(this->l, r_src, this->l[dst].data(), first, last);
+            }
+    }
+}
+
+template<typename B, typename R, class API_polar>
+template<typename T>
+void
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::blend_lanes(const std::vector<mipp::vector<T>>& buf,
+                                                          const mipp::Reg<R>& r_src,
+                                                          T* dst,
+                                                          const int first,
+                                                          const int last) const
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+    static_assert(n_frames == mipp::N<T>(), "The number of frames has to be the number of elements of a register.");
+
+    // one masked pass per source path
+    for (auto p = 0; p < this->L; p++)
+    {
+        const auto r_mask = r_src == mipp::Reg<R>((R)p);
+        if (mipp::testz(r_mask)) continue;
+
+        const auto in = buf[p].data();
+        for (auto i = first * n_frames; i < last * n_frames; i += n_frames)
+        {
+            const auto r_out = mipp::blend(mipp::Reg<T>(in + i), mipp::Reg<T>(dst + i), r_mask);
+            r_out.store(dst + i);
+        }
+    }
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::select_best_paths(const size_t frame_id)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+
+    mipp::Reg<R> r_best = (R)0;
+    mipp::Reg<R> r_best_met = this->metrics.data();
+    for (auto p = 1; p < this->n_active_paths; p++)
+    {
+        const mipp::Reg<R> r_met = this->metrics.data() + p * n_frames;
+        const auto m_better = r_met < r_best_met;
+        r_best = mipp::blend(mipp::Reg<R>((R)p), r_best, m_better);
+        r_best_met = mipp::blend(r_met, r_best_met, m_better);
+    }
+
+    R best[n_frames];
+    r_best.storeu(best);
+    for (auto f = 0; f < n_frames; f++)
+        this->best_path[f] = (int)best[f];
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::gather_best_paths()
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+
+    R best[n_frames];
+    for (auto f = 0; f < n_frames; f++)
+        best[f] = (R)this->best_path[f];
+    mipp::Reg<R> r_best;
+    r_best.loadu(best);
+
+    this->blend_lanes(this->s, r_best, this->s_bis.data(), 0, this->N);
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::_store(B* V_K)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+
+    this->gather_best_paths();
+    tools::fb_extract<B, n_frames>(
+      this->polar_patterns.get_leaves_pattern_types(), this->s_bis.data(), this->s_ext.data());
+
+    std::vector<B*> frames(n_frames);
+    for (auto f = 0; f < n_frames; f++)
+        frames[f] = V_K + f * this->K;
+    tools::Reorderer_static<B, n_frames>::apply_rev(this->s_ext.data(), frames, this->K);
+}
+
+template<typename B, typename R, class API_polar>
+void
+Decoder_polar_SCL_inter_sys<B, R, API_polar>::_store_cw(B* V_N)
+{
+    constexpr int n_frames = API_polar::get_n_frames();
+
+    this->gather_best_paths();
+
+    std::vector<B*> frames(n_frames);
+    for (auto f = 0; f < n_frames; f++)
+        frames[f] = V_N + f * this->N;
+    tools::Reorderer_static<B, n_frames>::apply_rev(this->s_bis.data(), frames, this->N);
+}
+}
+}
@@ -0,0 +1,100 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_polar_MK_SC_fast.
+ */
+#ifndef DECODER_POLAR_MK_SC_FAST_
+#define DECODER_POLAR_MK_SC_FAST_
+
+#include <cstdint>
+#include <vector>
+
+#include "Module/Decoder/Decoder_SIHO.hpp"
+#include "Tools/Code/Polar/Polar_code.hpp"
+#include "Tools/Interface/Interface_get_set_frozen_bits.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_polar_MK_SC_fast
+ *
+ * \brief Successive Cancellation (SC) decoder of multi-kernel polar codes on flat arrays.
+ *
+ * The LLRs and the partial sums of the nodes of each depth of the tree are stored in flat arrays. Each kernel of the
+ * code (see tools::Polar_code::get_kernel_matrices) is compiled at construction into min-sum (max-log) update tables:
+ * for each input bit, the list of the codewords generated by the next bits of the kernel. The tables are evaluated by
+ * functions unrolled for the kernels up to a size of 8, without the type-erased lambdas of the naive decoder. The
+ * partial sums are re-encoded after each child, the LLRs of the next child are directly computed from the partial
+ * sums of the current node.
+ */
+template<typename B = int, typename R = float>
+class Decoder_polar_MK_SC_fast
+  : public Decoder_SIHO<B, R>
+  , public tools::Interface_get_set_frozen_bits
+{
+  protected:
+    using kernel_t = void (*)(const R* l,
+                              const B* s,
+                              R* l_child,
+                              const int n_kernels,
+                              const int kernel_size,
+                              const uint32_t* codewords,
+                              const int n_codewords,
+                              const uint32_t row);
+
+    std::vector<bool> frozen_bits;
+
+    std::vector<int> kernel_ids;   // kernel of the nodes of each depth
+    std::vector<int> node_sizes;   // size of the nodes of each depth
+    std::vector<size_t> offsets;   // offsets of the nodes of each depth in 'l' and 's'
+    std::vector<int> kernel_sizes; // size of each kernel
+    std::vector<kernel_t> updates; // update function of each kernel
+
+    // 'rows[k][i]' is the row 'i' of the kernel 'k' as a bit mask, 'codewords[k][i]' are the codewords generated by
+    // the rows after 'i' (the codewords with 'u_i = 1' are obtained with a xor of 'rows[k][i]')
+    std::vector<std::vector<uint32_t>> rows;
+    std::vector<std::vector<std::vector<uint32_t>>> codewords;
+
+    std::vector<R> l; // lambdas of the nodes of each depth
+    std::vector<B> s; // partial sums of the nodes of each depth
+    std::vector<B> u; // decoded bits
+    int leaf;
+
+  public:
+    Decoder_polar_MK_SC_fast(const int& K,
+                             const int& N,
+                             const tools::Polar_code& code,
+                             const std::vector<bool>& frozen_bits);
+
+    virtual ~Decoder_polar_MK_SC_fast() = default;
+
+    virtual Decoder_polar_MK_SC_fast<B, R>* clone() const;
+
+    virtual void set_frozen_bits(const std::vector<bool>& frozen_bits);
+    virtual const std::vector<bool>& get_frozen_bits() const;
+
+  protected:
+    void _load(const R* Y_N);
+    void _decode();
+    int _decode_siho(const R* Y_N, B* V_K, const size_t frame_id);
+    int _decode_siho_cw(const R* Y_N, B* V_N, const size_t frame_id);
+    virtual void _store(B* V, bool coded = false) const;
+
+  private:
+    void recursive_decode(const int depth);
+
+    template<int KS>
+    static void update(const R* l,
+                       const B* s,
+                       R* l_child,
+                       const int n_kernels,
+                       const int kernel_size,
+                       const uint32_t* codewords,
+                       const int n_codewords,
+                       const uint32_t row);
+};
+}
+}
+
+#endif /* DECODER_POLAR_MK_SC_FAST_ */
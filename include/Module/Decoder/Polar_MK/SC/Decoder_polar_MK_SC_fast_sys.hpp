@@ -0,0 +1,34 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_polar_MK_SC_fast_sys.
+ */
+#ifndef DECODER_POLAR_MK_SC_FAST_SYS_
+#define DECODER_POLAR_MK_SC_FAST_SYS_
+
+#include <vector>
+
+#include "Module/Decoder/Polar_MK/SC/Decoder_polar_MK_SC_fast.hpp"
+#include "Tools/Code/Polar/Polar_code.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template<typename B = int, typename R = float>
+class Decoder_polar_MK_SC_fast_sys : public Decoder_polar_MK_SC_fast<B, R>
+{
+  public:
+    Decoder_polar_MK_SC_fast_sys(const int& K,
+                                 const int& N,
+                                 const tools::Polar_code& code,
+                                 const std::vector<bool>& frozen_bits);
+    virtual ~Decoder_polar_MK_SC_fast_sys() = default;
+    virtual Decoder_polar_MK_SC_fast_sys<B, R>* clone() const;
+
+  protected:
+    void _store(B* V, bool coded = false) const;
+};
+}
+}
+
+#endif /* DECODER_POLAR_MK_SC_FAST_SYS_ */
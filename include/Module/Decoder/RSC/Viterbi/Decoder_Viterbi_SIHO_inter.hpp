@@ -0,0 +1,77 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_Viterbi_SIHO_inter.
+ */
+#ifndef DECODER_VITERBI_SIHO_INTER_HPP_
+#define DECODER_VITERBI_SIHO_INTER_HPP_
+
+#include <mipp.h>
+#include <vector>
+
+#include "Module/Decoder/Decoder_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_Viterbi_SIHO_inter
+ *
+ * \brief Viterbi algorithm on a convolutional code, several frames are decoded in parallel in the SIMD registers.
+ *
+ * Each SIMD register holds the metric of a state for 'mipp::N<R>()' frames. The add-compare-select operations are
+ * grouped by butterflies (two previous states leading to the same two next states), the decisions are stored in
+ * bit-packed survivors (one bit per state, per step and per frame). Any trellis given by
+ * 'tools::Interface_get_trellis' made of butterflies (feed-forward and recursive codes) is supported.
+ *
+ * The decisions are the same as the 'Decoder_Viterbi_SIHO' ones, the metrics are stored on the 'R' type: the
+ * fixed-point metrics are normalized at each step and the LLRs are saturated lower than in 'Decoder_Viterbi_SIHO'
+ * (depending on the number of memories) to prevent the metrics from overflowing.
+ */
+template<typename B = int, typename R = float>
+class Decoder_Viterbi_SIHO_inter : public Decoder_SIHO<B, R>
+{
+    static_assert(sizeof(B) == sizeof(R), "The survivors are stored on 'B' words, as large as the 'R' metrics.");
+
+  protected:
+    const int n_states;
+    const int n_memories;
+    const bool is_closed;
+    const int n_steps;
+    const int n_bits;  // number of survivor bits in a 'B' word (the sign bit is not used)
+    const int n_words; // number of survivor words per step and per frame
+    const R llr_sat;   // saturation of the LLRs, the fixed-point metrics cannot overflow below it
+
+    std::vector<int> in_prev;   // the two transitions leading to a state 's' come from 'in_prev[2 * s + {0,1}]'
+    std::vector<int> in_bits;   // input bits of the two transitions leading to a state 's'
+    std::vector<int> in_out;    // output symbols ('2 * sys + par') of the two transitions leading to a state 's'
+    std::vector<bool> in_valid; // valid transitions at the first and at the closing steps
+    std::vector<bool> in_ties;  // the second transition wins the ties (closing steps only)
+    std::vector<int> bf_prev;   // the two previous states of each butterfly
+    std::vector<int> bf_next;   // the two next states of each butterfly
+    std::vector<int> bf_from;   // 'bf_prev' index of the first transition leading to each next state
+    mipp::vector<R> Y_N_inter;  // LLRs of the frames, interleaved
+    mipp::vector<R> metrics[2]; // state metrics of the current and of the next steps
+    mipp::vector<B> survivors;  // bit-packed decisions (index of the surviving transition)
+
+  public:
+    Decoder_Viterbi_SIHO_inter(const int K, const std::vector<std::vector<int>>& trellis, const bool is_closed);
+    virtual ~Decoder_Viterbi_SIHO_inter() = default;
+    virtual Decoder_Viterbi_SIHO_inter<B, R>* clone() const;
+
+  protected:
+    virtual int _decode_siho(const R* Y_N, B* V_K, const size_t frame_id);
+
+    void _load(const R* Y_N);
+    void _forward_pass();
+    void _backwards_pass(B* V_K);
+
+  private:
+    template<bool MASKED>
+    void _acs(const int t);
+    int valid_idx(const int t) const;
+};
+}
+}
+
+#endif /* DECODER_VITERBI_SIHO_INTER_HPP_ */
@@ -0,0 +1,87 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_Viterbi_list_parallel_inter.
+ */
+#ifndef DECODER_VITERBI_LIST_PARALLEL_INTER_HPP_
+#define DECODER_VITERBI_LIST_PARALLEL_INTER_HPP_
+
+#include <memory>
+#include <mipp.h>
+#include <vector>
+
+#include "Module/CRC/CRC.hpp"
+#include "Module/Decoder/Decoder_SIHO.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Decoder_Viterbi_list_parallel_inter
+ *
+ * \brief Parallel List Viterbi Algorithm (PLVA) on a closed convolutional code, several frames are decoded in parallel
+ *        in the SIMD registers.
+ *
+ * Each SIMD register holds the metric of a state and of a rank for 'mipp::N<R>()' frames. The 'L' best paths of a
+ * state are the 'L' first ones of the merge of the sorted lists of its two previous states: the lists are merged by a
+ * bitonic network, the ties are broken by the rank and then by the previous state. The survivors (index of the rank
+ * and of the transition) are bit-packed in 'B' words. The paths are traced back from the state 0 in the order of the
+ * ranks until the CRC is verified.
+ *
+ * The decisions are the same as the 'Decoder_Viterbi_list_parallel' ones on the floating-point types. The
+ * fixed-point metrics are normalized at each step and the LLRs are saturated (depending on the number of memories and
+ * on 'L') to prevent the metrics from overflowing.
+ */
+template<typename B = int, typename R = float>
+class Decoder_Viterbi_list_parallel_inter : public Decoder_SIHO<B, R>
+{
+    static_assert(sizeof(B) == sizeof(R), "The survivors are stored on 'B' words, as large as the 'R' metrics.");
+
+  protected:
+    const int n_states;
+    const int n_memories;
+    const int L;
+    const int n_steps;
+    const int n_sorted; // 'L' rounded up to a power of 2 (size of the merge network)
+    const int n_bits;   // number of survivor bits in a 'B' word (the sign bit is not used)
+    const int w_idx;    // number of bits of a survivor index ('2 * rank + transition')
+    const int n_fields; // number of survivor indexes in a 'B' word
+    const int n_words;  // number of survivor words per step, per state and per frame
+    const R llr_sat;    // saturation of the fixed-point LLRs, the metrics cannot overflow below it
+
+    std::vector<int> in_prev;    // the two transitions leading to a state 's' come from 'in_prev[2 * s + {0,1}]'
+    std::vector<int> in_bits;    // input bits of the two transitions leading to a state 's'
+    std::vector<int> in_out;     // output symbols ('2 * sys + par') of the two transitions leading to a state 's'
+    mipp::vector<R> Y_N_inter;   // LLRs of the frames, interleaved
+    mipp::vector<R> metrics[2];  // sorted metrics of the 'L' paths of each state, at the current and at the next steps
+    mipp::vector<R> net_metrics; // metrics in the merge network
+    mipp::vector<B> net_idx;     // survivor indexes in the merge network
+    mipp::vector<B> survivors;   // bit-packed survivor indexes
+    std::vector<B> path;         // decoded bits of a path
+    std::shared_ptr<CRC<B>> crc;
+
+  public:
+    Decoder_Viterbi_list_parallel_inter(const int K,
+                                        const int L,
+                                        const CRC<B>& crc,
+                                        const std::vector<std::vector<int>>& trellis);
+    virtual ~Decoder_Viterbi_list_parallel_inter() = default;
+    virtual Decoder_Viterbi_list_parallel_inter<B, R>* clone() const;
+
+  protected:
+    void deep_copy(const Decoder_Viterbi_list_parallel_inter<B, R>& m);
+    virtual int _decode_siho(const R* Y_N, B* V_K, const size_t frame_id);
+
+    void _load(const R* Y_N);
+    void _forward_pass();
+    void _backwards_pass(B* V_K);
+
+  private:
+    void _acs(const int t);
+    void _merge(const int t, const int s, const mipp::Reg<R> r_bm[4]);
+    void _trace(const int f, const int l);
+};
+}
+}
+
+#endif /* DECODER_VITERBI_LIST_PARALLEL_INTER_HPP_ */
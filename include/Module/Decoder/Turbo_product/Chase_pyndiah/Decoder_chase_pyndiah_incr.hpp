@@ -0,0 +1,73 @@
+/*!
+ * \file
+ * \brief Class module::Decoder_chase_pyndiah_incr.
+ */
+#ifndef DECODER_CHASE_PYNDIAH_INCR_HPP_
+#define DECODER_CHASE_PYNDIAH_INCR_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include "Module/Decoder/BCH/Decoder_BCH.hpp"
+#include "Module/Decoder/BCH/Standard/Decoder_BCH_std.hpp"
+#include "Module/Decoder/Turbo_product/Chase_pyndiah/Decoder_chase_pyndiah_fast.hpp"
+#include "Module/Encoder/Encoder.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*
+ * Incremental Chase :
+ *   - the syndromes of the hard decision H are computed once, the test patterns are walked in Gray code order (when all
+ *     the 2^p patterns are used) so the syndromes of a test vector are updated from the previous one by flipping the
+ *     contribution of a single position
+ *   - the BCH decoder works directly on the syndromes and returns the positions of the errors, a competitor is
+ *     represented by the positions where it differs from H (the flipped positions xor the corrected positions): its
+ *     metric is only summed on these positions
+ *   - the duplicated competitors are removed with a small hash set and the 'n_competitors' best competitors are
+ *     selected with a partial sort, only them are written in 'test_vect'
+ * The Pyndiah step is the same as in Decoder_chase_pyndiah_fast. The sub-decoder has to be a Decoder_BCH_std.
+ */
+template<typename B = int, typename R = float>
+class Decoder_chase_pyndiah_incr : public Decoder_chase_pyndiah_fast<B, R>
+{
+  protected:
+    Decoder_BCH_std<B, R>* dec_std; // 'dec' seen as a standard BCH decoder
+
+    const int max_diff;           // maximum number of positions where a competitor differs from the hard decision
+    std::vector<int> patterns;    // the test patterns as bit masks of the least reliable positions
+    std::vector<int> syndromes;   // the syndromes of the current test vector
+    std::vector<int> diff_pos;    // the sorted positions where each competitor differs from the hard decision
+    std::vector<int> n_diff;      // the number of positions in 'diff_pos' for each competitor
+    std::vector<uint64_t> hashes; // the hash of 'diff_pos' for each competitor
+    std::vector<int> hash_set;    // open addressing hash set of the competitors ('-1' for an empty slot)
+
+  public:
+    Decoder_chase_pyndiah_incr(const int K,
+                               const int N, // N with the parity bit if any
+                               const Decoder_BCH<B, R>& dec,
+                               const Encoder<B>& enc,
+                               const int n_least_reliable_positions = 2,
+                               const int n_test_vectors = 0,
+                               const int n_competitors = 0,
+                               const std::vector<float>& cp_coef = { 1, 1, 1, 1, 0 }); // the a b c d and e coef
+
+    virtual ~Decoder_chase_pyndiah_incr() = default;
+
+    virtual Decoder_chase_pyndiah_incr<B, R>* clone() const;
+
+  protected:
+    virtual void deep_copy(const Decoder_chase_pyndiah<B, R>& m);
+    virtual void compute_test_vectors(const size_t frame_id);
+    virtual void compute_metrics(const R* Y_N);
+
+  private:
+    bool insert_competitor(const int c);
+    void write_competitor(const int c, B* test_vect) const;
+};
+
+}
+}
+
+#endif /* DECODER_CHASE_PYNDIAH_INCR_HPP_ */
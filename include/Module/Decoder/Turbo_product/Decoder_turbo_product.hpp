@@ -5,12 +5,14 @@
 #ifndef DECODER_TURBO_PRODUCT_HPP_
 #define DECODER_TURBO_PRODUCT_HPP_
 
+#include <functional>
 #include <memory>
 #include <vector>
 
 #include "Module/Decoder/Decoder_SISO.hpp"
 #include "Module/Decoder/Turbo_product/Chase_pyndiah/Decoder_chase_pyndiah.hpp"
 #include "Module/Interleaver/Interleaver.hpp"
+#include "Tools/Algo/Thread_pool/Thread_pool.hpp"
 
 namespace aff3ct
 {
@@ -29,6 +31,8 @@ namespace module
  *     with Wi the results of the Chase Pyndiah decoder 'cp_r' on R(i-1) and C the input LLR from the demodulator
  *     when 'beta' vector is given then set the beta value of 'cp_c' to beta[2 * i + 1]
  *
+ * The columns (and the rows) of a half-iteration are independent: when 'n_threads' > 1, they are decoded concurrently
+ * by a pool of threads, each thread working with its own copies of 'cp_c' and 'cp_r'.
  */
 template<typename B = int, typename R = float>
 class Decoder_turbo_product : public Decoder_SISO<B, R>
@@ -42,6 +46,11 @@ class Decoder_turbo_product : public Decoder_SISO<B, R>
     std::shared_ptr<Decoder_chase_pyndiah<B, R>> cp_r; // row decoder
     std::shared_ptr<Decoder_chase_pyndiah<B, R>> cp_c; // col decoder
 
+    const int n_threads; // number of threads decoding the rows and the cols of a frame
+    std::vector<std::shared_ptr<Decoder_chase_pyndiah<B, R>>> cp_r_t; // row decoder of each thread
+    std::vector<std::shared_ptr<Decoder_chase_pyndiah<B, R>>> cp_c_t; // col decoder of each thread
+    std::shared_ptr<tools::Thread_pool> pool;                         // nullptr when 'n_threads' == 1
+
     std::vector<R> Y_N_i;
     std::vector<R> Y_N_pi;
     std::vector<B> V_K_i;
@@ -55,7 +64,8 @@ class Decoder_turbo_product : public Decoder_SISO<B, R>
                           const Decoder_chase_pyndiah<B, R>& cp_r,
                           const Decoder_chase_pyndiah<B, R>& cp_c,
                           const Interleaver<R>& pi,
-                          const std::vector<float>& beta = {});
+                          const std::vector<float>& beta = {},
+                          const int n_threads = 1);
     virtual ~Decoder_turbo_product() = default;
 
     virtual Decoder_turbo_product<B, R>* clone() const;
@@ -72,6 +82,15 @@ class Decoder_turbo_product : public Decoder_SISO<B, R>
     // else if = 1 then hard decode and fill V_H_i
     // else soft decode and fill Y_N_i
     virtual int _decode(const R* Y_N, const size_t frame_id, int return_K_siso);
+
+  private:
+    void init_threads();
+
+    // call 'decode(cp_r, cp_c, j)' for each 'j' in [0; n_words[, with the decoders of the calling thread
+    void for_each_word(const int n_words,
+                       const std::function<void(Decoder_chase_pyndiah<B, R>& cp_r,
+                                                Decoder_chase_pyndiah<B, R>& cp_c,
+                                                const int j)>& decode);
 };
 
 }
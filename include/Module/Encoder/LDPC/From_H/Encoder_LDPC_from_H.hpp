@@ -28,7 +28,8 @@ class Encoder_LDPC_from_H : public Encoder_LDPC<B>
                         const tools::Sparse_matrix& H,
                         const std::string& G_method = "IDENTITY",
                         const std::string& G_save_path = "",
-                        const bool G_save_path_single_thread = true);
+                        const bool G_save_path_single_thread = true,
+                        const std::string& cache_path = "");
     virtual ~Encoder_LDPC_from_H() = default;
 
     virtual Encoder_LDPC_from_H<B>* clone() const;
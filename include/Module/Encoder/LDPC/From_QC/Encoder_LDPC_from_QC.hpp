@@ -5,30 +5,93 @@
 #ifndef ENCODER_LDPC_FROM_QC_HPP_
 #define ENCODER_LDPC_FROM_QC_HPP_
 
+#include <cstdint>
+#include <mipp.h>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include "Module/Encoder/LDPC/Encoder_LDPC.hpp"
+#include "Tools/Algo/Matrix/GF2_matrix/GF2_matrix.hpp"
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
 #include "Tools/Code/LDPC/Matrix_handler/LDPC_matrix_handler.hpp"
+#include "Tools/Code/LDPC/QC/QC.hpp"
 
 namespace aff3ct
 {
 namespace module
 {
 
+/*!
+ * \class Encoder_LDPC_from_QC
+ *
+ * \brief Encodes a QC-LDPC code directly on its circulant blocks.
+ *
+ * The parity blocks are solved by back-substitution on the base matrix (dual-diagonal and block triangular parity
+ * parts, like in the 802.11n, 802.16e and 5G base graphs). The circulant blocks are bit-packed in 32-bit words.
+ * When the parity part of H has no such structure (or when the back-substitution does not give codewords, for a rank
+ * deficient parity part), the encoder falls back on the dense inv(H2) product.
+ *
+ * \tparam B: type of the bits in the encoder.
+ */
 template<typename B = int>
 class Encoder_LDPC_from_QC : public Encoder_LDPC<B>
 {
   protected:
-    tools::LDPC_matrix_handler::LDPC_matrix invH2;
+    // the parity block 'col' is the sum of the 'rows' block rows (info part) and of the already known 'parities'
+    // blocks (pairs of parity block column and circulant shift), rotated by 'inv_shift'
+    struct Step
+    {
+        unsigned col;
+        unsigned inv_shift;
+        std::vector<unsigned> rows;
+        std::vector<std::pair<unsigned, unsigned>> parities;
+    };
+
+    const int n_info; // number of information bits not zero padded ('dec_granularity')
+
+    tools::QC::Base_matrix base;
+    bool structured;
+    unsigned K_red;
+    unsigned n_words;    // number of 32-bit words to pack one circulant block
+    unsigned n_words_al; // 'n_words' rounded up to a multiple of the SIMD register size
+    uint32_t last_mask;
+    std::vector<std::vector<std::pair<unsigned, unsigned>>> info_blocks; // per block row: (block column, shift)
+    std::vector<Step> steps;
+
+    mipp::vector<uint32_t> U_packed; // info blocks, each one is packed twice in a row to make the rotations cheap
+    mipp::vector<uint32_t> P_packed; // parity blocks, same layout as 'U_packed'
+    mipp::vector<uint32_t> lambda;   // info part contribution to each block row
+    mipp::vector<uint32_t> acc;
+    mipp::vector<uint32_t> acc_packed;
+
+    tools::GF2_matrix invH2; // only built when the QC structure can't be used
+    std::vector<tools::GF2_matrix::word_t> parity; // bit-packed H1 x u
 
   public:
-    Encoder_LDPC_from_QC(const int K, const int N, const tools::Sparse_matrix& H);
+    Encoder_LDPC_from_QC(const int K,
+                         const int N,
+                         const tools::Sparse_matrix& H,
+                         const int dec_granularity = 0,
+                         const std::string& cache_path = "");
     virtual ~Encoder_LDPC_from_QC() = default;
 
     virtual Encoder_LDPC_from_QC<B>* clone() const;
 
+    bool is_structured() const;
+
   protected:
     void _encode(const B* U_K, B* X_N, const size_t frame_id);
+    void _encode_structured(const B* U_K, B* X_N);
+    void _encode_dense(const B* U_K, B* X_N);
     void _check_H_dimensions();
+
+  private:
+    bool build_schedule();
+    bool check_schedule();
+    void pack(const B* in, const unsigned n_bits, uint32_t* out) const;
+    void rotate_xor(const uint32_t* in_packed, const unsigned shift, uint32_t* out) const;
+    void duplicate(const uint32_t* in, uint32_t* out_packed) const;
 };
 
 }
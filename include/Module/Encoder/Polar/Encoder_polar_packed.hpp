@@ -0,0 +1,55 @@
+/*!
+ * \file
+ * \brief Class module::Encoder_polar_packed.
+ */
+#ifndef ENCODER_POLAR_PACKED_HPP_
+#define ENCODER_POLAR_PACKED_HPP_
+
+#include <cstdint>
+#include <vector>
+
+#include "Module/Encoder/Polar/Encoder_polar.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+/*!
+ * \class Encoder_polar_packed
+ *
+ * \brief Polar encoder working on bits packed in 64-bit words.
+ *
+ * The bits are packed at the beginning of the encoding and unpacked at the end. The stages of the polar transform
+ * between two bits of the same word (distance < 64) are computed with shifts and masks, the other stages are XORs of
+ * whole words.
+ */
+template<typename B = int>
+class Encoder_polar_packed : public Encoder_polar<B>
+{
+  protected:
+    const int n_words;
+    std::vector<uint64_t> frozen_mask; // bit set to 1 when the bit is frozen
+    std::vector<uint64_t> X_N_packed;
+
+  public:
+    Encoder_polar_packed(const int& K, const int& N, const std::vector<bool>& frozen_bits);
+    virtual ~Encoder_polar_packed() = default;
+
+    virtual Encoder_polar_packed<B>* clone() const;
+
+    bool is_codeword(const B* X_N);
+
+    virtual void set_frozen_bits(const std::vector<bool>& frozen_bits);
+
+  protected:
+    virtual void _encode(const B* U_K, B* X_N, const size_t frame_id);
+
+    void pack_info_bits(const B* U_K, uint64_t* words) const;
+    void pack(const B* X_N, uint64_t* words) const;
+    void unpack(const uint64_t* words, B* X_N) const;
+    void light_encode_packed(uint64_t* words) const;
+};
+}
+}
+
+#endif // ENCODER_POLAR_PACKED_HPP_
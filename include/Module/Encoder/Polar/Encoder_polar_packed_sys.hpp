@@ -0,0 +1,31 @@
+/*!
+ * \file
+ * \brief Class module::Encoder_polar_packed_sys.
+ */
+#ifndef ENCODER_POLAR_PACKED_SYS_HPP_
+#define ENCODER_POLAR_PACKED_SYS_HPP_
+
+#include <vector>
+
+#include "Module/Encoder/Polar/Encoder_polar_packed.hpp"
+
+namespace aff3ct
+{
+namespace module
+{
+template<typename B = int>
+class Encoder_polar_packed_sys : public Encoder_polar_packed<B>
+{
+  public:
+    Encoder_polar_packed_sys(const int& K, const int& N, const std::vector<bool>& frozen_bits);
+    virtual ~Encoder_polar_packed_sys() = default;
+
+    virtual Encoder_polar_packed_sys<B>* clone() const;
+
+  protected:
+    void _encode(const B* U_K, B* X_N, const size_t frame_id);
+};
+}
+}
+
+#endif // ENCODER_POLAR_PACKED_SYS_HPP_
@@ -121,6 +121,9 @@ class Modem : public spu::module::Stateful
     bool enable_demodulator;
     float last_channel_param;
 
+    int dec_granularity = 0;
+    int parity_size = 0;
+
   public:
     /*!
      * \brief Constructor.
@@ -165,6 +168,16 @@ class Modem : public spu::module::Stateful
 
     bool is_demodulator() const;
 
+    /*!
+     * \brief Sets the zero padding of the frames (see 'Channel::set_params'): the bits in ['dec_granularity',
+     *        'N' - 'parity_size') are zero padded and known by the receiver. The modems with one symbol per bit do not
+     *        modulate them.
+     *
+     * \param dec_granularity: number of information bits at the beginning of the frame.
+     * \param parity_size:     number of parity bits at the end of the frame.
+     */
+    void set_padding(const int dec_granularity, const int parity_size);
+
     /*!
      * \brief Task method that modulates a vector of bits or symbols.
      *
@@ -341,6 +354,10 @@ class Modem : public spu::module::Stateful
                                                const bool complex);
 
   protected:
+    // the zero padded positions of a frame are ['get_padding_begin()', 'get_padding_end()'), empty range if no padding
+    int get_padding_begin() const;
+    int get_padding_end() const;
+
     virtual void _modulate(const B* X_N1, R* X_N2, const size_t frame_id);
 
     virtual void _tmodulate(const Q* X_N1, R* X_N2, const size_t frame_id);
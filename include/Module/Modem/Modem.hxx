@@ -3,6 +3,7 @@
 #include <string>
 
 #include "Module/Modem/Modem.hpp"
+#include "Tools/Code/LDPC/Zero_padding/zero_padding.h"
 
 namespace aff3ct
 {
@@ -343,6 +344,28 @@ Modem<B, R, Q>::is_demodulator() const
     return this->enable_demodulator;
 }
 
+template<typename B, typename R, typename Q>
+void
+Modem<B, R, Q>::set_padding(const int dec_granularity, const int parity_size)
+{
+    this->dec_granularity = dec_granularity;
+    this->parity_size = parity_size;
+}
+
+template<typename B, typename R, typename Q>
+int
+Modem<B, R, Q>::get_padding_begin() const
+{
+    return tools::zero_padding_begin(this->N, this->dec_granularity, this->parity_size);
+}
+
+template<typename B, typename R, typename Q>
+int
+Modem<B, R, Q>::get_padding_end() const
+{
+    return tools::zero_padding_end(this->N, this->dec_granularity, this->parity_size);
+}
+
 template<typename B, typename R, typename Q>
 template<class AB, class AR>
 void
@@ -13,6 +13,7 @@
 #include "Module/Monitor/Monitor.hpp"
 #include "Tools/Algo/Callback/Callback.hpp"
 #include "Tools/Algo/Histogram.hpp"
+#include "Tools/Monitor/Monitor_BFER_counters.hpp"
 
 namespace aff3ct
 {
@@ -26,6 +27,7 @@ class Monitor_BFER : public Monitor
     inline spu::runtime::Task& operator[](const mnt::tsk t);
     inline spu::runtime::Socket& operator[](const mnt::sck::check_errors s);
     inline spu::runtime::Socket& operator[](const mnt::sck::check_errors2 s);
+    inline spu::runtime::Socket& operator[](const mnt::sck::check_errors_w s);
 
   protected:
     struct Attributes
@@ -33,6 +35,10 @@ class Monitor_BFER : public Monitor
         unsigned long long n_fra; // the number of checked frames
         unsigned long long n_be;  // the number of wrong bits
         unsigned long long n_fe;  // the number of wrong frames
+        double w_fe;              // the sum of the weights of the wrong frames (importance sampling)
+        double w2_fe;             // the sum of the squared weights of the wrong frames
+        double w_be;              // the sum of the weighted numbers of wrong bits
+        double w2_be;             // the sum of the squared weighted numbers of wrong bits
 
         Attributes();
         void reset();
@@ -41,6 +47,7 @@ class Monitor_BFER : public Monitor
 
   private:
     const int K;                 // Number of source bits
+    const int n_info;            // Number of checked source bits (the zero padded source bits are not checked)
     const unsigned max_fe;       // max number of wrong frames to get then fe_limit_achieved() returns true else if 0
     const unsigned max_n_frames; // max number of frames to check then frame_limit_achieved() returns true else if 0
     const bool
@@ -51,6 +58,9 @@ class Monitor_BFER : public Monitor
     tools::Histogram<int> err_hist; // the error histogram record
     bool err_hist_activated;
 
+    std::shared_ptr<tools::Monitor_BFER_counters> counters; // counters shared with the monitors of the other threads
+    size_t shard;                                           // shard of this monitor in the 'counters' (0 = none)
+
     tools::Callback<unsigned, int> callback_fe;
     tools::Callback<> callback_check;
     tools::Callback<> callback_fe_limit_achieved;
@@ -59,7 +69,8 @@ class Monitor_BFER : public Monitor
     Monitor_BFER(const int K,
                  const unsigned max_fe,
                  const unsigned max_n_frames = 0,
-                 const bool count_unknown_values = false);
+                 const bool count_unknown_values = false,
+                 const int dec_granularity = 0);
 
     virtual ~Monitor_BFER() = default;
 
@@ -93,6 +104,21 @@ class Monitor_BFER : public Monitor
                       const int frame_id = -1,
                       const bool managed_memory = true);
 
+    /*!
+     * \brief Compares two messages and counts the number of frame errors and bit errors, each frame error is also
+     *        weighted by the likelihood ratio of its frame (importance sampling).
+     *
+     * \param U: the original message (from the Source or the CRC).
+     * \param V: the decoded message (from the Decoder).
+     * \param W: the likelihood ratio of each frame (from the Channel).
+     */
+    template<class A = std::allocator<B>>
+    int check_errors_w(const std::vector<B, A>& U,
+                       const std::vector<B, A>& V,
+                       const std::vector<double>& W,
+                       const int frame_id = -1,
+                       const bool managed_memory = true);
+
     int check_errors(const B* U, const B* V, const int frame_id = -1, const bool managed_memory = true);
 
     int check_errors2(const B* U,
@@ -105,11 +131,18 @@ class Monitor_BFER : public Monitor
                       const int frame_id = -1,
                       const bool managed_memory = true);
 
+    int check_errors_w(const B* U,
+                       const B* V,
+                       const double* W,
+                       const int frame_id = -1,
+                       const bool managed_memory = true);
+
     bool fe_limit_achieved() const;
     bool frame_limit_achieved() const;
     virtual bool is_done() const;
 
     int get_K() const;
+    int get_n_info() const;
     bool get_count_unknown_values() const;
     unsigned get_max_fe() const;
     unsigned get_max_n_frames() const;
@@ -119,9 +152,26 @@ class Monitor_BFER : public Monitor
     float get_fer() const;
     float get_ber() const;
 
+    /*
+     * importance sampling estimates of the FER and of the BER (only filled by the 'check_errors_w' task) and half
+     * width of their 95% confidence intervals
+     */
+    double get_weighted_fer() const;
+    double get_weighted_ber() const;
+    double get_weighted_fer_ci() const;
+    double get_weighted_ber_ci() const;
+
     const tools::Histogram<int>& get_err_hist() const;
     void activate_err_histogram(bool val);
 
+    /*
+     * add previously computed values to the values of this monitor (for instance to resume a simulation)
+     */
+    void add_values(const unsigned long long n_fra,
+                    const unsigned long long n_be,
+                    const unsigned long long n_fe,
+                    const tools::Histogram<int>& err_hist);
+
     virtual uint32_t record_callback_fe(std::function<void(unsigned, int)> callback);
     virtual uint32_t record_callback_check(std::function<void(void)> callback);
     virtual uint32_t record_callback_fe_limit_achieved(std::function<void(void)> callback);
@@ -147,9 +197,18 @@ class Monitor_BFER : public Monitor
 
     void disable_is_done(const bool no_is_done);
 
+    /*
+     * share counters with the monitors of the other threads: the frame error and frame limits are checked on the
+     * values of all the monitors sharing these counters (and not only on the values of this monitor)
+     */
+    void set_counters(std::shared_ptr<tools::Monitor_BFER_counters> counters);
+    const std::shared_ptr<tools::Monitor_BFER_counters>& get_counters() const;
+
   protected:
     const Attributes& get_attributes() const;
 
+    virtual void deep_copy(const Monitor_BFER<B>& m);
+
     virtual int _check_errors(const B* U, const B* V, const size_t frame_id);
 
     virtual int _check_errors2(const B* U,
@@ -161,6 +220,8 @@ class Monitor_BFER : public Monitor
                                float* FER,
                                const size_t frame_id);
 
+    virtual int _check_errors_w(const B* U, const B* V, const double* W, const size_t frame_id);
+
     virtual int __check_errors(const B* U, const B* V, const size_t frame_id);
 };
 }
@@ -29,6 +29,13 @@ Monitor_BFER<B>::operator[](const mnt::sck::check_errors2 s)
     return spu::module::Module::operator[]((size_t)mnt::tsk::check_errors2)[(size_t)s];
 }
 
+template<typename B>
+spu::runtime::Socket&
+Monitor_BFER<B>::operator[](const mnt::sck::check_errors_w s)
+{
+    return spu::module::Module::operator[]((size_t)mnt::tsk::check_errors_w)[(size_t)s];
+}
+
 template<typename B>
 template<class A>
 int
@@ -68,5 +75,22 @@ Monitor_BFER<B>::check_errors2(const std::vector<B, A>& U,
 
     return status[0];
 }
+
+template<typename B>
+template<class A>
+int
+Monitor_BFER<B>::check_errors_w(const std::vector<B, A>& U,
+                                const std::vector<B, A>& V,
+                                const std::vector<double>& W,
+                                const int frame_id,
+                                const bool managed_memory)
+{
+    (*this)[mnt::sck::check_errors_w::U].bind(U);
+    (*this)[mnt::sck::check_errors_w::V].bind(V);
+    (*this)[mnt::sck::check_errors_w::W].bind(W);
+    const auto& status = (*this)[mnt::tsk::check_errors_w].exec(frame_id, managed_memory);
+
+    return status[0];
+}
 }
 }
@@ -19,6 +19,7 @@ enum class tsk : size_t
 {
     check_errors,
     check_errors2,
+    check_errors_w,
     get_mutual_info,
     check_mutual_info,
     SIZE
@@ -43,6 +44,13 @@ enum class check_errors2 : size_t
     FER,
     status
 };
+enum class check_errors_w : size_t
+{
+    U,
+    V,
+    W,
+    status
+};
 enum class get_mutual_info : size_t
 {
     X,
@@ -97,6 +97,11 @@ class Histogram : public spu::tools::Interface_reset
 
     inline size_t get_n_values() const;
 
+    /*
+     * return the number of occurrences of each calibrated value (see 'calibrate_val()')
+     */
+    inline const std::map<int, size_t>& get_hist() const;
+
   private:
     inline int dump_all_values(std::ofstream& hist_file, R hist_min, R hist_max) const;
 
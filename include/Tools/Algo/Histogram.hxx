@@ -263,6 +263,13 @@ Histogram<R>::get_n_values() const
     return n_values;
 }
 
+template<typename R>
+const std::map<int, size_t>&
+Histogram<R>::get_hist() const
+{
+    return hist;
+}
+
 template<typename R>
 int
 Histogram<R>::dump_all_values(std::ofstream& hist_file, R hist_min, R hist_max) const
@@ -0,0 +1,125 @@
+/*!
+ * \file
+ * \brief Class tools::GF2_matrix.
+ */
+#ifndef GF2_MATRIX_HPP_
+#define GF2_MATRIX_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Tools/Algo/Matrix/Full_matrix/Full_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class GF2_matrix
+ *
+ * \brief Dense binary matrix, each row is packed in 64-bit words (the bit 'c % 64' of the word 'c / 64' is the column
+ *        'c').
+ *
+ * The inversion and the multiplication use the Method of the Four Russians (M4RI and M4RM): the rows are processed by
+ * groups of 8 pivots, the 256 combinations of the group are precomputed once and each other row is then reduced with a
+ * single row XOR, instead of up to 8.
+ */
+class GF2_matrix
+{
+  public:
+    using word_t = uint64_t;
+    static constexpr size_t word_size = 64;
+
+  protected:
+    static constexpr size_t k_m4r = 8; // number of rows combined by the Four Russians tables, divides 'word_size'
+
+    size_t n_rows;
+    size_t n_cols;
+    size_t n_words; // number of words per row
+    std::vector<word_t> data;
+
+  public:
+    explicit GF2_matrix(const size_t n_rows = 0, const size_t n_cols = 0);
+
+    virtual ~GF2_matrix() = default;
+
+    /*
+     * build a packed copy of the 'mat' columns from 'col_begin' to 'col_end' (excluded), 'col_end = 0' means the
+     * last column of 'mat'
+     */
+    static GF2_matrix from_sparse(const Sparse_matrix& mat, const size_t col_begin = 0, const size_t col_end = 0);
+    static GF2_matrix from_full(const Full_matrix<int8_t>& mat);
+
+    Full_matrix<int8_t> to_full() const;
+    Sparse_matrix to_sparse() const;
+
+    inline size_t get_n_rows() const;
+    inline size_t get_n_cols() const;
+    inline size_t get_n_words() const;
+
+    inline bool at(const size_t row_index, const size_t col_index) const;
+    inline void set(const size_t row_index, const size_t col_index, const bool val = true);
+    inline void flip(const size_t row_index, const size_t col_index);
+
+    inline word_t* get_row(const size_t row_index);
+    inline const word_t* get_row(const size_t row_index) const;
+
+    /*
+     * \brief parity of the number of ones in the bitwise AND of the row and of 'vec' (packed on 'n_words' words)
+     */
+    inline bool dot(const size_t row_index, const word_t* vec) const;
+
+    void swap_rows(const size_t row_index1, const size_t row_index2);
+
+    /*
+     * \brief row 'dst' ^= row 'src', from the word 'first_word'
+     */
+    void xor_rows(const size_t dst, const size_t src, const size_t first_word = 0);
+
+    GF2_matrix transpose() const;
+
+    /*
+     * \brief compute the inverse of the (square) matrix with a Gauss-Jordan elimination (M4RI)
+     * throw a runtime_error when the matrix is singular
+     */
+    GF2_matrix inverse() const;
+
+    /*
+     * \brief compute 'this' * 'mat' (M4RM)
+     */
+    GF2_matrix mul(const GF2_matrix& mat) const;
+
+    /*
+     * \brief write the matrix in a binary file, 'key' identifies the matrix (for instance a hash of its source)
+     */
+    void save(const std::string& path, const uint64_t key) const;
+
+    /*
+     * \brief read a matrix written by 'save'
+     * \return false if the file does not exist, can't be read or does not match the 'key'
+     */
+    bool load(const std::string& path, const uint64_t key);
+
+  protected:
+    inline unsigned get_window(const size_t row_index, const size_t col_index) const;
+
+    /*
+     * \brief fill 'table' with the combinations of the 'rows' (of 'n_words' words) from the word 'first_word', the
+     *        combination 'i' is the XOR of the rows 'j' with the bit 'j' of 'i' set
+     */
+    static void build_m4r_table(const std::vector<const word_t*>& rows,
+                                const size_t n_words,
+                                const size_t first_word,
+                                std::vector<word_t>& table);
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Tools/Algo/Matrix/GF2_matrix/GF2_matrix.hxx"
+#endif
+
+#endif /* GF2_MATRIX_HPP_ */
@@ -0,0 +1,83 @@
+#include "Tools/Algo/Matrix/GF2_matrix/GF2_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+size_t
+GF2_matrix ::get_n_rows() const
+{
+    return this->n_rows;
+}
+
+size_t
+GF2_matrix ::get_n_cols() const
+{
+    return this->n_cols;
+}
+
+size_t
+GF2_matrix ::get_n_words() const
+{
+    return this->n_words;
+}
+
+bool
+GF2_matrix ::at(const size_t row_index, const size_t col_index) const
+{
+    return (this->data[row_index * this->n_words + col_index / word_size] >> (col_index % word_size)) & (word_t)1;
+}
+
+void
+GF2_matrix ::set(const size_t row_index, const size_t col_index, const bool val)
+{
+    auto& w = this->data[row_index * this->n_words + col_index / word_size];
+    const auto mask = (word_t)1 << (col_index % word_size);
+    w = val ? (w | mask) : (w & ~mask);
+}
+
+void
+GF2_matrix ::flip(const size_t row_index, const size_t col_index)
+{
+    this->data[row_index * this->n_words + col_index / word_size] ^= (word_t)1 << (col_index % word_size);
+}
+
+GF2_matrix::word_t*
+GF2_matrix ::get_row(const size_t row_index)
+{
+    return this->data.data() + row_index * this->n_words;
+}
+
+const GF2_matrix::word_t*
+GF2_matrix ::get_row(const size_t row_index) const
+{
+    return this->data.data() + row_index * this->n_words;
+}
+
+bool
+GF2_matrix ::dot(const size_t row_index, const word_t* vec) const
+{
+    auto row = this->get_row(row_index);
+    word_t acc = 0;
+    for (size_t w = 0; w < this->n_words; w++)
+        acc ^= row[w] & vec[w];
+
+    // parity of the accumulated word
+    acc ^= acc >> 32;
+    acc ^= acc >> 16;
+    acc ^= acc >> 8;
+    acc ^= acc >> 4;
+    acc ^= acc >> 2;
+    acc ^= acc >> 1;
+    return acc & (word_t)1;
+}
+
+unsigned
+GF2_matrix ::get_window(const size_t row_index, const size_t col_index) const
+{
+    // 'col_index' is a multiple of 'k_m4r' which divides 'word_size': the window never spans two words
+    return (unsigned)(this->data[row_index * this->n_words + col_index / word_size] >> (col_index % word_size)) &
+           ((1u << k_m4r) - 1);
+}
+}
+}
@@ -0,0 +1,92 @@
+/*!
+ * \file
+ * \brief Class tools::Sparse_matrix_CSR.
+ */
+#ifndef SPARSE_MATRIX_CSR_HPP_
+#define SPARSE_MATRIX_CSR_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <mipp.h>
+#include <vector>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Sparse_matrix_CSR
+ *
+ * \brief Read-only compressed view of the connections of a Sparse_matrix.
+ *
+ * The 'i'-th list of indexes is stored in the range ['offsets[i]', 'offsets[i + 1]') of a flat and aligned array of
+ * indexes. The indexes are stored on 16 bits when the range allows it (and when 'compact' is true), on 32 bits
+ * otherwise. The hot loops should dispatch once on 'is_compact()' and then use 'get_indexes<uint16_t>()' or
+ * 'get_indexes<uint32_t>()'.
+ */
+class Sparse_matrix_CSR
+{
+  private:
+    size_t n_indexes;
+    size_t max_degree;
+    bool compact;
+    std::vector<uint32_t> offsets;
+    mipp::vector<uint16_t> indexes_16;
+    mipp::vector<uint32_t> indexes_32;
+
+  public:
+    /*
+     * build the compressed view of the 'lists' of indexes, all the indexes have to be lower than 'n_indexes'
+     */
+    explicit Sparse_matrix_CSR(const std::vector<std::vector<Sparse_matrix::Idx_t>>& lists = {},
+                               const size_t n_indexes = 0,
+                               const bool compact = true);
+
+    virtual ~Sparse_matrix_CSR() = default;
+
+    /*
+     * compressed row view (CSR): the columns connected to each row of the matrix
+     */
+    static Sparse_matrix_CSR from_rows(const Sparse_matrix& matrix, const bool compact = true);
+
+    /*
+     * compressed column view (CSC): the rows connected to each column of the matrix
+     */
+    static Sparse_matrix_CSR from_cols(const Sparse_matrix& matrix, const bool compact = true);
+
+    /*
+     * return true if both the rows and the columns indexes of the matrix fit on 16 bits, so the CSR and the CSC views
+     * of the matrix can share the same width of indexes
+     */
+    static bool fits_compact(const Sparse_matrix& matrix);
+
+    inline size_t size() const;
+
+    inline size_t get_n_indexes() const;
+
+    inline size_t get_max_degree() const;
+
+    inline size_t get_n_connections() const;
+
+    inline bool is_compact() const;
+
+    inline uint32_t get_degree(const size_t i) const;
+
+    inline const std::vector<uint32_t>& get_offsets() const;
+
+    /*
+     * return the flat array of indexes, 'I' has to be 'uint16_t' when the view is compact and 'uint32_t' otherwise
+     */
+    template<typename I>
+    inline const I* get_indexes() const;
+};
+}
+}
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_CSR.hxx"
+#endif
+
+#endif /* SPARSE_MATRIX_CSR_HPP_ */
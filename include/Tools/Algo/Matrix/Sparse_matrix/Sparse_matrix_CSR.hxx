@@ -0,0 +1,63 @@
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_CSR.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+size_t
+Sparse_matrix_CSR ::size() const
+{
+    return this->offsets.size() - 1;
+}
+
+size_t
+Sparse_matrix_CSR ::get_n_indexes() const
+{
+    return this->n_indexes;
+}
+
+size_t
+Sparse_matrix_CSR ::get_max_degree() const
+{
+    return this->max_degree;
+}
+
+size_t
+Sparse_matrix_CSR ::get_n_connections() const
+{
+    return (size_t)this->offsets.back();
+}
+
+bool
+Sparse_matrix_CSR ::is_compact() const
+{
+    return this->compact;
+}
+
+uint32_t
+Sparse_matrix_CSR ::get_degree(const size_t i) const
+{
+    return this->offsets[i + 1] - this->offsets[i];
+}
+
+const std::vector<uint32_t>&
+Sparse_matrix_CSR ::get_offsets() const
+{
+    return this->offsets;
+}
+
+template<>
+inline const uint16_t*
+Sparse_matrix_CSR ::get_indexes<uint16_t>() const
+{
+    return this->indexes_16.data();
+}
+
+template<>
+inline const uint32_t*
+Sparse_matrix_CSR ::get_indexes<uint32_t>() const
+{
+    return this->indexes_32.data();
+}
+}
+}
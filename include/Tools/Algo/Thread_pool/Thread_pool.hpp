@@ -0,0 +1,68 @@
+/*!
+ * \file
+ * \brief Class tools::Thread_pool.
+ */
+#ifndef THREAD_POOL_HPP_
+#define THREAD_POOL_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Thread_pool
+ *
+ * \brief Persistent pool of threads running the same task in parallel.
+ *
+ * The calling thread takes part in each run as the thread 0, so only 'n_threads' - 1 threads are spawned. The threads
+ * are created once and are sleeping between two runs, it makes the pool suited for short tasks repeated many times
+ * (like the half-iterations of an iterative decoder).
+ */
+class Thread_pool
+{
+  protected:
+    const size_t n_threads;
+
+    std::vector<std::thread> threads;
+    std::mutex mtx;
+    std::condition_variable cv_run;
+    std::condition_variable cv_done;
+
+    std::function<void(const size_t)> task;
+    std::exception_ptr exception;
+    size_t generation;
+    size_t n_running;
+    bool stop;
+
+  public:
+    explicit Thread_pool(const size_t n_threads);
+    Thread_pool(const Thread_pool&) = delete;
+    Thread_pool& operator=(const Thread_pool&) = delete;
+    virtual ~Thread_pool();
+
+    size_t get_n_threads() const;
+
+    /*!
+     * \brief Runs 'task(tid)' on each thread of the pool and waits for the end of all of them.
+     *
+     * The first exception thrown by a task (if any) is re-thrown in the calling thread.
+     *
+     * \param task: the task to run, 'tid' is the identifier of the thread in [0; n_threads[.
+     */
+    void run(const std::function<void(const size_t tid)>& task);
+
+  private:
+    void worker(const size_t tid);
+};
+}
+}
+
+#endif /* THREAD_POOL_HPP_ */
@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "Tools/Algo/Matrix/Full_matrix/Full_matrix.hpp"
+#include "Tools/Algo/Matrix/GF2_matrix/GF2_matrix.hpp"
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
 
 namespace aff3ct
@@ -82,8 +83,11 @@ struct LDPC_matrix_handler
      * \return G horizontal with a guarantee to have the identity on the left part.
      * \param info_bits_pos is filled with the positions (that are 0 to K-1) of the information bits.
      * \param H (in Horizontal way) is the parity matrix from which G is built.
+     * \param cache_path is the folder where the parity part of G and inv(H2) are cached (no cache if empty).
      */
-    static Sparse_matrix transform_H_to_G_decomp_LU(const Sparse_matrix& H, Positions_vector& info_bits_pos);
+    static Sparse_matrix transform_H_to_G_decomp_LU(const Sparse_matrix& H,
+                                                    Positions_vector& info_bits_pos,
+                                                    const std::string& cache_path = "");
     static LDPC_matrix transform_H_to_G_decomp_LU(const LDPC_matrix& H, Positions_vector& info_bits_pos);
 
     /*
@@ -112,12 +116,34 @@ struct LDPC_matrix_handler
     static Positions_vector interleave_info_bits_pos(const Positions_vector& info_bits_pos,
                                                      Positions_vector& old_cols_pos);
 
+    /*
+     * shorten the code (H in the vertical way): the info bits 'info_bits_pos[k]' with k >= 'n_info' are known to be
+     * zero (zero padding), so their variable nodes are removed from H with the check nodes left without connection.
+     * 'info_bits_pos' is updated with the positions of the 'n_info' remaining info bits in the shortened matrix and
+     * 'kept_pos' gives the old position of each remaining variable node.
+     */
+    static Sparse_matrix shorten(const Sparse_matrix& H,
+                                 Positions_vector& info_bits_pos,
+                                 const size_t n_info,
+                                 Positions_vector& kept_pos);
+
     /*
      * inverse H2 (H = [H1 H2] with size(H2) = M x M) to allow encoding with p = H1 x inv(H2) x u
      */
     static LDPC_matrix LU_decomposition(const Sparse_matrix& H);
     static LDPC_matrix LU_decomposition(const LDPC_matrix& H);
 
+    /*
+     * inverse H2 (H = [H1 H2] with size(H2) = M x M) in a bit-packed matrix, 'cache_path' is the folder where
+     * inv(H2) is cached (no cache if empty): a cached inverse is read instead of being computed again
+     */
+    static GF2_matrix inverse_H2(const Sparse_matrix& H, const std::string& cache_path = "");
+
+    /*
+     * \brief Compute a 64-bit hash (FNV-1a) of the connections of the matrix, used as key of the cached matrices
+     */
+    static uint64_t hash(const Sparse_matrix& H);
+
     /*
      * \brief Compute a G.H to check if result is a null vector
      *        H and G can be permuted except both vertical, the function handle their order
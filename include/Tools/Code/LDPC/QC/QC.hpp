@@ -5,6 +5,7 @@
 #ifndef QC_HPP_
 #define QC_HPP_
 
+#include <cstdint>
 #include <iostream>
 #include <vector>
 
@@ -17,7 +18,21 @@ namespace tools
 struct QC
 {
   public:
+    /*
+     * base (or protograph) representation of a QC matrix
+     * @shifts[i][j] is the circulant shift of the block at the i-th block row (check nodes) and the j-th block column
+     * (variable nodes), -1 stands for a null block
+     */
+    struct Base_matrix
+    {
+        unsigned N_red = 0;
+        unsigned M_red = 0;
+        unsigned Z = 0;
+        std::vector<std::vector<int16_t>> shifts;
+    };
+
     static Sparse_matrix read(std::istream& stream);
+    static Base_matrix read_base(std::istream& stream);
     static std::vector<bool> read_pct_pattern(std::istream& stream, int N_red = -1);
     static void write(const Sparse_matrix& matrix, std::ostream& stream);
 
@@ -28,8 +43,21 @@ struct QC
      */
     static void read_matrix_size(std::istream& stream, int& H, int& N);
 
+    /*
+     * expand the base matrix into the sparse format (vertical way, same as 'read')
+     */
+    static Sparse_matrix expand(const Base_matrix& base);
+
+    /*
+     * try to recover the base matrix from an expanded sparse matrix (vertical way), the largest valid lifting size Z is
+     * selected, return false if the matrix has no QC structure with Z >= 2 (for instance after a check nodes
+     * reordering)
+     */
+    static bool extract_base(const Sparse_matrix& H, Base_matrix& base);
+
   private:
-    static Sparse_matrix _read(std::istream& stream);
+    static Base_matrix _read_base(std::istream& stream);
+    static bool _extract_base(const Sparse_matrix& H, const unsigned Z, Base_matrix& base);
 };
 }
 }
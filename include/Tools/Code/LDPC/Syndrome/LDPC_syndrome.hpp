@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp"
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_CSR.hpp"
 
 namespace aff3ct
 {
@@ -27,6 +28,22 @@ struct LDPC_syndrome
 
     template<typename R>
     static inline bool check_soft(const R* Y_N, const Sparse_matrix& H);
+
+    /*
+     * same checks on the compressed view of the check nodes ('chk_to_var' lists the variable nodes of each check node)
+     */
+    template<typename B>
+    static inline bool check_hard(const B* X_N, const Sparse_matrix_CSR& chk_to_var);
+
+    template<typename R>
+    static inline bool check_soft(const R* Y_N, const Sparse_matrix_CSR& chk_to_var);
+
+  private:
+    template<typename B, typename I>
+    static inline bool _check_hard(const B* X_N, const Sparse_matrix_CSR& chk_to_var);
+
+    template<typename R, typename I>
+    static inline bool _check_soft(const R* Y_N, const Sparse_matrix_CSR& chk_to_var);
 };
 }
 }
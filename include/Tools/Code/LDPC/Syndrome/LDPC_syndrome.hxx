@@ -75,5 +75,65 @@ LDPC_syndrome ::check_soft(const std::vector<R>& Y_N, const Sparse_matrix& H)
     return LDPC_syndrome::check_soft<R>(Y_N.data(), H);
 }
 
+template<typename B, typename I>
+bool
+LDPC_syndrome ::_check_hard(const B* X_N, const Sparse_matrix_CSR& chk_to_var)
+{
+    const auto offsets = chk_to_var.get_offsets().data();
+    const auto var_ids = chk_to_var.get_indexes<I>();
+
+    const auto n_chk_nodes = chk_to_var.size();
+    for (size_t c = 0; c < n_chk_nodes; c++)
+    {
+        auto sign = 0;
+        for (auto e = offsets[c]; e < offsets[c + 1]; e++)
+            sign ^= X_N[var_ids[e]] ? 1 : 0;
+
+        if (sign) return false;
+    }
+
+    return true;
+}
+
+template<typename B>
+bool
+LDPC_syndrome ::check_hard(const B* X_N, const Sparse_matrix_CSR& chk_to_var)
+{
+    if (chk_to_var.is_compact())
+        return LDPC_syndrome::_check_hard<B, uint16_t>(X_N, chk_to_var);
+    else
+        return LDPC_syndrome::_check_hard<B, uint32_t>(X_N, chk_to_var);
+}
+
+template<typename R, typename I>
+bool
+LDPC_syndrome ::_check_soft(const R* Y_N, const Sparse_matrix_CSR& chk_to_var)
+{
+    const auto offsets = chk_to_var.get_offsets().data();
+    const auto var_ids = chk_to_var.get_indexes<I>();
+
+    const auto n_chk_nodes = chk_to_var.size();
+    for (size_t c = 0; c < n_chk_nodes; c++)
+    {
+        auto sign = 0;
+        for (auto e = offsets[c]; e < offsets[c + 1]; e++)
+            sign ^= (Y_N[var_ids[e]] < 0) ? 1 : 0;
+
+        if (sign) return false;
+    }
+
+    return true;
+}
+
+template<typename R>
+bool
+LDPC_syndrome ::check_soft(const R* Y_N, const Sparse_matrix_CSR& chk_to_var)
+{
+    if (chk_to_var.is_compact())
+        return LDPC_syndrome::_check_soft<R, uint16_t>(Y_N, chk_to_var);
+    else
+        return LDPC_syndrome::_check_soft<R, uint32_t>(Y_N, chk_to_var);
+}
+
 }
 }
@@ -0,0 +1,29 @@
+/*!
+ * \file
+ * \brief Functions to locate the zero padded bits of a shortened LDPC frame.
+ */
+#ifndef ZERO_PADDING_H_
+#define ZERO_PADDING_H_
+
+namespace aff3ct
+{
+namespace tools
+{
+/*
+ * Return the first zero padded position of a frame of 'N' bits: the 'dec_granularity' first bits are the information
+ * bits, the 'parity_size' last bits are the parity bits and the bits in between are zero padded. Return 'N' if there
+ * is no padding.
+ */
+int
+zero_padding_begin(const int N, const int dec_granularity, const int parity_size);
+
+/*
+ * Return the position following the last zero padded bit of a frame of 'N' bits (see 'zero_padding_begin'). Return
+ * 'N' if there is no padding.
+ */
+int
+zero_padding_end(const int N, const int dec_granularity, const int parity_size);
+}
+}
+
+#endif /* ZERO_PADDING_H_ */
@@ -6,7 +6,10 @@
 #define FROZENBITS_GENERATOR_HPP_
 
 #include <cstdint>
+#include <deque>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <streampu.hpp>
 #include <string>
 #include <thread>
@@ -31,6 +34,12 @@ class Frozenbits_generator
     static std::thread::id master_thread_id;
     const std::string dump_channels_path;
     const bool dump_channels_single_thread;
+    std::string cache_path;
+
+    static std::mutex cache_mutex;
+    static std::map<std::string, std::vector<uint32_t>> cache;
+    static std::deque<std::string> cache_keys; // keys of the cache, from the oldest to the newest
+    static const size_t cache_max_size;
 
   protected:
     const int K; /*!< Number of information bits in the frame. */
@@ -71,6 +80,18 @@ class Frozenbits_generator
 
     const tools::Noise<>& get_noise() const;
 
+    /*!
+     * \brief Sets the folder where the best channels are cached between the simulations.
+     *
+     * The best channels are always cached in memory (shared by all the generators of the process) when the construction
+     * can be cached (see Frozenbits_generator::get_construction).
+     *
+     * \param cache_path: path of the folder, no file cache if empty.
+     */
+    void set_cache_path(const std::string& cache_path);
+
+    const std::string& get_cache_path() const;
+
     /*!
      * \brief Generates the frozen bits vector.
      *
@@ -96,10 +117,22 @@ class Frozenbits_generator
      */
     virtual void evaluate() = 0;
 
+    /*!
+     * \brief Gets the name of the construction, with all its parameters but the frame sizes and the noise.
+     *
+     * \return the name of the construction, an empty name disables the cache of the best channels.
+     */
+    virtual std::string get_construction() const;
+
     /*!
      * \brief Check that the noise has the expected type
      */
     virtual void check_noise();
+
+  private:
+    std::string get_cache_key() const;
+    bool load_best_channels(const std::string& key);
+    void save_best_channels(const std::string& key);
 };
 }
 }
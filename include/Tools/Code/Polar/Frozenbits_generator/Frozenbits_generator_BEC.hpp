@@ -32,6 +32,7 @@ class Frozenbits_generator_BEC : public Frozenbits_generator
 
   protected:
     void evaluate();
+    virtual std::string get_construction() const;
     double phi(double t);
     double phi_inv(double t);
     virtual void check_noise();
@@ -36,6 +36,7 @@ class Frozenbits_generator_GA : public Frozenbits_generator
     static constexpr double bisection_max = std::numeric_limits<double>::max();
 
     std::vector<bool> fake_frozen_bits;
+    std::string construction;
     module::Decoder_polar_MK_SC_naive<int64_t, double> decoder_sc;
 
   public:
@@ -51,6 +52,7 @@ class Frozenbits_generator_GA : public Frozenbits_generator
 
   protected:
     void evaluate();
+    virtual std::string get_construction() const;
     static double phi(double t);
     static double phi_inv(double t);
     virtual void check_noise();
@@ -46,6 +46,7 @@ class Frozenbits_generator_GA_Arikan : public Frozenbits_generator
 
   protected:
     void evaluate();
+    virtual std::string get_construction() const;
     double phi(double t);
     double phi_inv(double t);
     virtual void check_noise();
@@ -0,0 +1,77 @@
+/*!
+ * \file
+ * \brief Class tools::Frozenbits_generator_TV_merge.
+ */
+#ifndef FROZENBITS_GENERATOR_TV_MERGE_HPP_
+#define FROZENBITS_GENERATOR_TV_MERGE_HPP_
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Frozenbits_generator_TV_merge
+ *
+ * \brief Tal & Vardy construction of the polar codes, computed without the external polar bounds generator.
+ *
+ * Each bit channel is approximated by a degraded channel of at most 'mu' output symbols: after each polarization
+ * transform, the pairs of conjugated symbols are merged by bins of their conditional entropy. The channels are ranked
+ * by their error probability. The sub-trees of the channels are evaluated in parallel, depth first, so the memory does
+ * not depend on the codeword size.
+ */
+class Frozenbits_generator_TV_merge : public Frozenbits_generator
+{
+  private:
+    using channel_t = std::vector<std::pair<double, double>>; // pairs of conjugated symbols (W(y|0), W(y|1))
+
+    const int m;
+    const int mu;
+    const bool bsc;
+    const int n_threads;
+
+    std::vector<double> pe;         // error probability of each bit channel
+    std::vector<double> thresholds; // ratios W(y|1) / W(y|0) on the edges of the conditional entropy bins
+
+  public:
+    /*!
+     * \brief Constructor.
+     *
+     * \param mu:        maximum number of output symbols of the approximated channels (even number).
+     * \param bsc:       the event probability noise is the crossover probability of a binary symmetric channel instead
+     *                   of the erasure probability of a binary erasure channel.
+     * \param n_threads: number of threads of the evaluation, 0 to use all the hardware threads.
+     */
+    Frozenbits_generator_TV_merge(const int K,
+                                  const int N,
+                                  const int mu = 32,
+                                  const bool bsc = false,
+                                  const int n_threads = 0,
+                                  const std::string& dump_channels_path = "",
+                                  const bool dump_channels_single_thread = true);
+
+    virtual ~Frozenbits_generator_TV_merge() = default;
+
+    virtual Frozenbits_generator_TV_merge* clone() const;
+
+  protected:
+    void evaluate();
+    virtual std::string get_construction() const;
+    virtual void check_noise();
+
+  private:
+    void init_channel(channel_t& W) const;
+    void init_thresholds();
+    void transform(const channel_t& W, channel_t& W_child, const bool plus, std::vector<double>& bins) const;
+    static double error_probability(const channel_t& W, const bool plus);
+    void recursive_evaluate(const int lvl, const int idx, std::vector<channel_t>& W, std::vector<double>& bins);
+};
+}
+}
+
+#endif /* FROZENBITS_GENERATOR_TV_MERGE_HPP_ */
@@ -0,0 +1,115 @@
+/*!
+ * \file
+ * \brief Class tools::Polar_program.
+ */
+#ifndef POLAR_PROGRAM_HPP_
+#define POLAR_PROGRAM_HPP_
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Tools/Code/Polar/Pattern_polar_parser.hpp"
+#include "Tools/Code/Polar/Patterns/Pattern_polar_i.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+enum class polar_op_t : uint8_t
+{
+    F = 0, // l_c = f(l_a, l_b)
+    G,     // l_c = g(l_a, l_b, s_a)
+    G0,    // l_c = g0(l_a, l_b)
+    GR,    // l_c = gr(l_a, l_b, s_a)
+    H,     // s_a = h(l_a)
+    H0,    // s_a = 0
+    REP,   // s_a = rep(l_a)
+    SPC,   // s_a = spc(l_a)
+    XO,    // s_c = s_a ^ s_b
+    XO0    // s_c = s_b
+};
+
+struct polar_instr_t
+{
+    polar_op_t op;
+    int32_t n_elmts;
+    int32_t off[4]; // the 'l' offsets first and the 's' offsets after, in the order of the comments of 'polar_op_t'
+};
+
+/*!
+ * \class Polar_program
+ * \brief Flat list of instructions of the fast systematic SC decoder, compiled once from a simplified polar tree.
+ *
+ * The instructions are the calls of the fast SC decoder in the order of its recursion, the offsets are given for one
+ * frame. The program does not depend on the SIMD strategy and can be saved in a file to skip the tree parsing in the
+ * next simulations.
+ */
+class Polar_program
+{
+  protected:
+    int N;
+    std::vector<polar_instr_t> instructions;
+    std::vector<std::pair<unsigned char, int>> leaves_pattern_types;
+
+  public:
+    Polar_program();
+
+    /*!
+     * \brief Compiles the tree of a pattern parser.
+     *
+     * \param polar_patterns: the parser of the frozen bits.
+     */
+    explicit Polar_program(const Pattern_polar_parser& polar_patterns);
+
+    virtual ~Polar_program() = default;
+
+    int get_N() const;
+    const std::vector<polar_instr_t>& get_instructions() const;
+    const std::vector<std::pair<unsigned char, int>>& get_leaves_pattern_types() const;
+
+    /*!
+     * \brief Writes the program in a temporary file (unique to the thread and to the process) which replaces the
+     *        'path' file when it is complete.
+     *
+     * \param path: path of the file.
+     * \param key:  key of the program (see Polar_program::hash), checked by Polar_program::load.
+     *
+     * \return false if the file could not be written, the cache is simply not updated then.
+     */
+    bool save(const std::string& path, const uint64_t key) const;
+
+    /*!
+     * \brief Reads a program saved by Polar_program::save.
+     *
+     * \return false if the file does not exist, does not match the key or has out of bounds offsets, the program is
+     *         unchanged then.
+     */
+    bool load(const std::string& path, const uint64_t key);
+
+    /*!
+     * \brief Computes the key of the program compiled from the given parser parameters (FNV-1a hash).
+     */
+    static uint64_t hash(const std::vector<bool>& frozen_bits,
+                         const std::vector<Pattern_polar_i*>& patterns,
+                         const size_t pattern_rate0_id,
+                         const size_t pattern_rate1_id);
+
+  private:
+    void recursive_compile(const Pattern_polar_parser& polar_patterns,
+                           const int off_l,
+                           const int off_s,
+                           const int reverse_depth,
+                           int& node_id);
+    void emit(const polar_op_t op,
+              const int n_elmts,
+              const int off0,
+              const int off1 = 0,
+              const int off2 = 0,
+              const int off3 = 0);
+};
+}
+}
+
+#endif /* POLAR_PROGRAM_HPP_ */
@@ -0,0 +1,80 @@
+/*!
+ * \file
+ * \brief Class tools::Monitor_BFER_counters.
+ */
+#ifndef MONITOR_BFER_COUNTERS_HPP_
+#define MONITOR_BFER_COUNTERS_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Monitor_BFER_counters
+ *
+ * \brief Frame and error counters shared by the BFER monitors of all the threads of a simulation.
+ *
+ * Each monitor counts its frames and its bit errors in its own shard (a cache line, so the threads never write in the
+ * same line) and any thread can sum the shards without synchronization. The frame errors are counted in a single
+ * counter: they are much less frequent than the frames and the global number of frame errors is then exactly known as
+ * soon as a thread finds a new error.
+ *
+ * The counters are only reset and read for the final results when the threads are stopped.
+ */
+class Monitor_BFER_counters
+{
+  public:
+    static constexpr size_t cache_line = 64;
+
+  protected:
+    struct alignas(cache_line) Shard
+    {
+        std::atomic<unsigned long long> n_fra;
+        std::atomic<unsigned long long> n_be;
+        std::atomic<unsigned long long> n_fe;
+    };
+
+    const size_t n_shards;
+    std::vector<uint8_t> buffer; // raw storage of the shards ('new' does not honor 'alignas' before C++17)
+    Shard* shards;               // the first shard counts the frame errors and the added values
+    std::atomic<size_t> n_claimed;
+
+  public:
+    /*
+     * \param n_shards: number of shards, should be the number of threads (the shards are shared when more monitors
+     *                  claim one)
+     */
+    explicit Monitor_BFER_counters(const size_t n_shards);
+
+    virtual ~Monitor_BFER_counters() = default;
+
+    /*
+     * \brief return the shard id of a new monitor
+     */
+    size_t claim_shard();
+
+    /*
+     * \brief count a checked frame of the monitor owning the 'shard'
+     */
+    void add_frame(const size_t shard, const unsigned n_be);
+
+    /*
+     * \brief add previously computed values (for instance to resume a simulation)
+     */
+    void add_values(const unsigned long long n_fra, const unsigned long long n_be, const unsigned long long n_fe);
+
+    unsigned long long get_n_analyzed_fra() const;
+    unsigned long long get_n_be() const;
+    unsigned long long get_n_fe() const;
+
+    void reset();
+};
+}
+}
+
+#endif /* MONITOR_BFER_COUNTERS_HPP_ */
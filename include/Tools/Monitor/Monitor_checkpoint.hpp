@@ -0,0 +1,88 @@
+/*!
+ * \file
+ * \brief Class tools::Monitor_checkpoint.
+ */
+#ifndef MONITOR_CHECKPOINT_HPP_
+#define MONITOR_CHECKPOINT_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "Module/Monitor/BFER/Monitor_BFER.hpp"
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Monitor_checkpoint
+ *
+ * \brief Saves the values of the BFER monitors of each noise point in a binary file and restores them to resume a
+ *        simulation.
+ *
+ * The whole file is rewritten at each save in a temporary file which then replaces the previous checkpoint, a killed
+ * simulation always leaves a complete checkpoint. The checkpoint also counts the number of runs that used it: a resumed
+ * simulation has to seed its PRNGs differently to not replay the frames of the previous runs.
+ */
+class Monitor_checkpoint
+{
+  protected:
+    struct Point
+    {
+        unsigned long long n_fra;
+        unsigned long long n_be;
+        unsigned long long n_fe;
+        std::vector<std::pair<int32_t, uint64_t>> err_hist; // (number of bit errors, number of frames)
+    };
+
+    const std::string path;
+    const int n_info;
+    uint32_t n_runs;
+    std::map<float, Point> points; // the saved noise points, indexed by noise value
+    std::mutex mtx;
+
+  public:
+    /*
+     * \param path: path of the checkpoint file
+     * \param n_info: number of checked bits per frame, a checkpoint can only be restored with the same value
+     */
+    Monitor_checkpoint(const std::string& path, const int n_info);
+
+    virtual ~Monitor_checkpoint() = default;
+
+    /*
+     * \brief read the checkpoint file, throw if it can't be read or if it has been written by another code
+     */
+    void load();
+
+    /*
+     * \brief save the values of the (reduced) monitor for the given noise value and rewrite the checkpoint file
+     */
+    template<typename B>
+    void save(const float noise_val, const module::Monitor_BFER<B>& monitor);
+
+    /*
+     * \brief add the saved values of the given noise value to the monitor
+     * \return false if the noise value has not been saved
+     */
+    template<typename B>
+    bool restore(const float noise_val, module::Monitor_BFER<B>& monitor);
+
+    /*
+     * \brief return the number of runs that have loaded this checkpoint before
+     */
+    uint32_t get_n_runs() const;
+
+    const std::string& get_path() const;
+
+  protected:
+    void write();
+};
+}
+}
+
+#endif /* MONITOR_CHECKPOINT_HPP_ */
@@ -6,6 +6,8 @@
 #define MONITOR_REDUCTION_HPP_
 
 #include <chrono>
+#include <cstddef>
+#include <map>
 #include <memory>
 #include <thread>
 #include <type_traits>
@@ -18,50 +20,71 @@ namespace aff3ct
 namespace tools
 {
 
+/*
+ * The monitors are reduced by groups: all the monitors of a group are reduced, stopped and reset together and
+ * independently of the other groups. This allows several simulation loops (for instance several noise points) to run
+ * at the same time. The groups have to be created (by constructing their monitors) before the simulation loops start.
+ */
 class Monitor_reduction_static
 {
   protected:
-    static bool stop_loop;
-    static std::vector<Monitor_reduction_static*> monitors;
-    static std::thread::id master_thread_id;
+    struct Group
+    {
+        bool stop_loop;
+        std::vector<Monitor_reduction_static*> monitors;
+        std::thread::id master_thread_id;
+        std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds> t_last_reduction;
+
+        Group();
+    };
+
+    static std::map<size_t, Group> groups;
     static std::chrono::nanoseconds d_reduce_frequency;
 
-    static std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds> t_last_reduction;
+    const size_t group_id;
+    Group& group_state;
 
   public:
     /*
-     * \brief check if any recorded monitor reduction has done after having done a reduction
+     * \brief check if any recorded monitor reduction of the 'group' has done after having done a reduction
      *        if any monitor is done then call 'set_stop_loop()'
      * \param final is true then call 'last_reduce_all()' else 'reduce_all()'
      * \param fully call the reduction functions with this parameter
      * \return 'get_stop_loop()' result
      */
-    static bool is_done_all(bool fully = false);
+    static bool is_done_all(bool fully = false, const size_t group = 0);
 
     /*
      * \brief call _reduce with 'fully' and 'force' arguments
      */
-    static void reduce_all(bool fully = false, bool force = false);
+    static void reduce_all(bool fully = false, bool force = false, const size_t group = 0);
 
     /*
      * \brief loop on a forced reduction until '_reduce' call return 'true' after having call 'set_stop_loop()'
      */
-    static void last_reduce_all(bool fully = true);
+    static void last_reduce_all(bool fully = true, const size_t group = 0);
 
     /*
      * \brief throw if all process do not have the same number of monitors to reduce
      */
-    static void check_reducible();
+    static void check_reducible(const size_t group = 0);
+
+    /*
+     * reset 't_last_mpi_comm', clear 'stop_loop' and call 'reset_mr' on each monitor of the 'group'
+     */
+    static void reset_all(const size_t group = 0);
 
     /*
-     * reset 't_last_mpi_comm', clear 'stop_loop' and call 'reset_mr' on each monitor
+     * clear 'stop_loop' without resetting the monitors of the 'group', the simulation loop can then be continued
      */
-    static void reset_all();
+    static void resume_all(const size_t group = 0);
 
-    static void set_master_thread_id(std::thread::id t);
+    static void set_master_thread_id(std::thread::id t, const size_t group = 0);
 
     static void set_reduce_frequency(std::chrono::nanoseconds d);
 
+    size_t get_group() const;
+
     /*
      * \brief reset this monitor
      */
@@ -79,7 +102,7 @@ class Monitor_reduction_static
     virtual void reduce(bool fully = true) = 0;
 
   protected:
-    Monitor_reduction_static();
+    explicit Monitor_reduction_static(const size_t group = 0);
 
     virtual ~Monitor_reduction_static();
 
@@ -87,37 +110,42 @@ class Monitor_reduction_static
 
   private:
     /*
-     * \brief get if the current simulation loop must be stopped or not
+     * \brief return the 'group', throw if it does not exist
+     */
+    static Group& get_group(const size_t group);
+
+    /*
+     * \brief get if the current simulation loop of the 'group' must be stopped or not
      * \return true if loop must be stopped
      */
-    static bool get_stop_loop();
+    static bool get_stop_loop(const size_t group);
 
     /*
-     * \brief set that the current simulation loop must be stopped
+     * \brief set that the current simulation loop of the 'group' must be stopped
      */
-    static void set_stop_loop();
+    static void set_stop_loop(const size_t group);
 
     /*
-     * \brief add the monitor in the 'monitors' list
+     * \brief add the monitor in the 'monitors' list of its group (the group is created if it does not exist)
      */
-    static void add_monitor(Monitor_reduction_static*);
+    static Group& add_monitor(Monitor_reduction_static*, const size_t group);
 
-    static void remove_monitor(Monitor_reduction_static*);
+    static void remove_monitor(Monitor_reduction_static*, const size_t group);
 
     /*
      * \brief do a reduction of the number of process that are at the final reduce step
      * \return true if all process are at the final reduce step (always true without MPI)
      */
-    static bool reduce_stop_loop();
+    static bool reduce_stop_loop(const size_t group);
 
     /*
-     * \brief do the reductions of all 'monitors' if the thread calling it is the master thread and if the
-     *        'd_reduce_frequency' criteria is reached.
+     * \brief do the reductions of all 'monitors' of the 'group' if the thread calling it is the master thread of the
+     *        group and if the 'd_reduce_frequency' criteria is reached.
      * \param force if set, do the reduction anyway
      * \param fully if set, do a full reduction of all attributes
      * \return the result of the 'reduce_stop_loop()' call after the reductions. If there were not, then return false.
      */
-    static bool _reduce(bool fully, bool force);
+    static bool _reduce(bool fully, bool force, const size_t group);
 };
 
 template<class M> // M is the monitor on which must be applied the reduction
@@ -135,10 +163,11 @@ class Monitor_reduction
     /*
      * \brief do reductions upon a monitor list to merge data in this monitor
      * \param monitors is the list of monitors on which the reductions are done
+     * \param group is the reduction group of this monitor
      */
-    explicit Monitor_reduction(const std::vector<M*>& monitors);
-    explicit Monitor_reduction(const std::vector<std::unique_ptr<M>>& monitors);
-    explicit Monitor_reduction(const std::vector<std::shared_ptr<M>>& monitors);
+    explicit Monitor_reduction(const std::vector<M*>& monitors, const size_t group = 0);
+    explicit Monitor_reduction(const std::vector<std::unique_ptr<M>>& monitors, const size_t group = 0);
+    explicit Monitor_reduction(const std::vector<std::shared_ptr<M>>& monitors, const size_t group = 0);
     virtual ~Monitor_reduction() = default;
 
     virtual void reset();
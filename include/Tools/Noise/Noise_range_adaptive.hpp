@@ -0,0 +1,86 @@
+/*!
+ * \file
+ * \brief Class tools::Noise_range_adaptive.
+ */
+#ifndef NOISE_RANGE_ADAPTIVE_HPP_
+#define NOISE_RANGE_ADAPTIVE_HPP_
+
+#include <cstddef>
+#include <vector>
+
+namespace aff3ct
+{
+namespace tools
+{
+/*!
+ * \class Noise_range_adaptive
+ *
+ * \brief Schedules the noise points of an adaptive sweep from the results of the already simulated noise points.
+ *
+ * The sweep starts with the points of the coarse range, in the simulation order (the FER is expected to decrease along
+ * this order). The coarse phase stops as soon as a point reaches the target FER (the target is then bracketed) or when
+ * a point stopped on the frame or time limit. Then, the sweep inserts a point in the middle of the interval where the
+ * FER changes the most, until the FER varies by less than 'max_dec' decades between two consecutive points or until
+ * the points are closer than 'min_step'.
+ */
+class Noise_range_adaptive
+{
+  protected:
+    struct Point
+    {
+        float value;
+        unsigned long long n_fe;
+        unsigned long long n_fra;
+    };
+
+    const std::vector<float> coarse_range; // the coarse points in the simulation order
+    const double target_fer;
+    const float min_step;
+    const float max_dec;
+    const float direction; // 1 if the noise value increases along the simulation order, -1 otherwise
+
+    size_t n_coarse_sched; // number of coarse points already scheduled
+    bool coarse_done;
+    std::vector<Point> points; // the simulated points sorted in the simulation order
+
+  public:
+    Noise_range_adaptive(const std::vector<float>& coarse_range,
+                         const double target_fer,
+                         const float min_step = 0.05f,
+                         const float max_dec = 0.5f);
+
+    virtual ~Noise_range_adaptive() = default;
+
+    /*
+     * \brief record the result of a simulated noise point
+     * \param limit_reached: true if the noise point stopped on the frame or time limit before reaching the FE limit
+     */
+    void add_result(const float value,
+                    const unsigned long long n_fe,
+                    const unsigned long long n_fra,
+                    const bool limit_reached = false);
+
+    /*
+     * \brief get the next noise point to simulate
+     * \return false if the sweep is done
+     */
+    bool next(float& value);
+
+    /*
+     * \brief return true if two consecutive simulated points are on both sides of the target FER
+     */
+    bool is_bracketed() const;
+
+    size_t get_n_points() const;
+
+  protected:
+    /*
+     * return the FER of a point, a point without any frame error is given half an error to be comparable with the
+     * others on a logarithmic scale
+     */
+    static double get_fer(const Point& p);
+};
+}
+}
+
+#endif /* NOISE_RANGE_ADAPTIVE_HPP_ */
@@ -19,8 +19,14 @@ class Reporter_BFER : public Reporter_monitor<module::Monitor_BFER<B>>
     using Rm = Reporter_monitor<module::Monitor_BFER<B>>;
     using typename Rm::M;
     using typename Rm::report_t;
+    using typename Rm::group_t;
 
-    explicit Reporter_BFER(const M& monitor);
+  protected:
+    const bool weighted; // display the importance sampling estimates
+    group_t weighted_group;
+
+  public:
+    explicit Reporter_BFER(const M& monitor, const bool weighted = false);
 
     virtual ~Reporter_BFER() = default;
 
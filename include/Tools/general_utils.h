@@ -25,6 +25,10 @@ split(const std::string& s);
 void
 getline(std::istream& file, std::string& line);
 
+// path of a temporary file next to 'path', unique to the calling thread and process (to write 'path' atomically)
+std::string
+unique_tmp_path(const std::string& path);
+
 template<typename R = float>
 R
 sigma_to_esn0(const R sigma, const int upsample_factor = 1);
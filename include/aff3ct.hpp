@@ -276,6 +276,9 @@
 #ifndef CRC_NO_HPP_
 #include <Module/CRC/NO/CRC_NO.hpp>
 #endif
+#ifndef CRC_POLYNOMIAL_CLMUL_HPP_
+#include <Module/CRC/Polynomial/CRC_polynomial_clmul.hpp>
+#endif
 #ifndef CRC_POLYNOMIAL_FAST_HPP_
 #include <Module/CRC/Polynomial/CRC_polynomial_fast.hpp>
 #endif
@@ -363,6 +366,9 @@
 #ifndef DECODER_LDPC_BP_HORIZONTAL_LAYERED_ONMS_INTER_HPP_
 #include <Module/Decoder/LDPC/BP/Horizontal_layered/ONMS/Decoder_LDPC_BP_horizontal_layered_ONMS_inter.hpp>
 #endif
+#ifndef DECODER_LDPC_BP_HORIZONTAL_LAYERED_QC_HPP_
+#include <Module/Decoder/LDPC/BP/Horizontal_layered/QC/Decoder_LDPC_BP_horizontal_layered_QC.hpp>
+#endif
 #ifndef DECODER_LDPC_BP_PEELING_HPP
 #include <Module/Decoder/LDPC/BP/Peeling/Decoder_LDPC_BP_peeling.hpp>
 #endif
@@ -372,6 +378,9 @@
 #ifndef DECODER_LDPC_BP_VERTICAL_LAYERED_INTER_HPP_
 #include <Module/Decoder/LDPC/BP/Vertical_layered/Decoder_LDPC_BP_vertical_layered_inter.hpp>
 #endif
+#ifndef DECODER_LDPC_ZERO_PADDING_HPP_
+#include <Module/Decoder/LDPC/Zero_padding/Decoder_LDPC_zero_padding.hpp>
+#endif
 #ifndef DECODER_NO_HPP_
 #include <Module/Decoder/NO/Decoder_NO.hpp>
 #endif
@@ -387,6 +396,12 @@
 #ifndef DECODER_POLAR_MK_ASCL_NAIVE_CA_SYS
 #include <Module/Decoder/Polar_MK/ASCL/Decoder_polar_MK_ASCL_naive_CA_sys.hpp>
 #endif
+#ifndef DECODER_POLAR_MK_SC_FAST_
+#include <Module/Decoder/Polar_MK/SC/Decoder_polar_MK_SC_fast.hpp>
+#endif
+#ifndef DECODER_POLAR_MK_SC_FAST_SYS_
+#include <Module/Decoder/Polar_MK/SC/Decoder_polar_MK_SC_fast_sys.hpp>
+#endif
 #ifndef DECODER_POLAR_MK_SC_NAIVE_
 #include <Module/Decoder/Polar_MK/SC/Decoder_polar_MK_SC_naive.hpp>
 #endif
@@ -405,12 +420,18 @@
 #ifndef DECODER_POLAR_MK_SCL_NAIVE_SYS
 #include <Module/Decoder/Polar_MK/SCL/Decoder_polar_MK_SCL_naive_sys.hpp>
 #endif
+#ifndef DECODER_POLAR_SCAN_FAST_SYS_
+#include <Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp>
+#endif
 #ifndef DECODER_POLAR_SCAN_NAIVE_H_
 #include <Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive.hpp>
 #endif
 #ifndef DECODER_POLAR_SCAN_NAIVE_SYS_
 #include <Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive_sys.hpp>
 #endif
+#ifndef DECODER_POLAR_SC_COMPILED_SYS_
+#include <Module/Decoder/Polar/SC/Decoder_polar_SC_compiled_sys.hpp>
+#endif
 #ifndef DECODER_POLAR_SC_FAST_SYS_
 #include <Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp>
 #endif
@@ -420,6 +441,9 @@
 #ifndef DECODER_POLAR_SC_NAIVE_SYS_
 #include <Module/Decoder/Polar/SC/Decoder_polar_SC_naive_sys.hpp>
 #endif
+#ifndef DECODER_POLAR_SCF_FAST_SYS_
+#include <Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hpp>
+#endif
 #ifndef DECODER_POLAR_SCF_NAIVE_
 #include <Module/Decoder/Polar/SCF/Decoder_polar_SCF_naive.hpp>
 #endif
@@ -429,6 +453,9 @@
 #ifndef DECODER_POLAR_SCL_FAST_SYS_CA
 #include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys.hpp>
 #endif
+#ifndef DECODER_POLAR_SCL_INTER_CA_SYS
+#include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_inter_CA_sys.hpp>
+#endif
 #ifndef DECODER_POLAR_SCL_MEM_FAST_SYS_CA
 #include <Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_MEM_fast_CA_sys.hpp>
 #endif
@@ -441,6 +468,9 @@
 #ifndef DECODER_POLAR_SCL_FAST_SYS
 #include <Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys.hpp>
 #endif
+#ifndef DECODER_POLAR_SCL_INTER_SYS
+#include <Module/Decoder/Polar/SCL/Decoder_polar_SCL_inter_sys.hpp>
+#endif
 #ifndef DECODER_POLAR_SCL_MEM_FAST_SYS
 #include <Module/Decoder/Polar/SCL/Decoder_polar_SCL_MEM_fast_sys.hpp>
 #endif
@@ -537,9 +567,15 @@
 #ifndef DECODER_VITERBI_SIHO_HPP_
 #include <Module/Decoder/RSC/Viterbi/Decoder_Viterbi_SIHO.hpp>
 #endif
+#ifndef DECODER_VITERBI_SIHO_INTER_HPP_
+#include <Module/Decoder/RSC/Viterbi/Decoder_Viterbi_SIHO_inter.hpp>
+#endif
 #ifndef DECODER_VITERBI_LIST_PARALLEL_HPP_
 #include <Module/Decoder/RSC/Viterbi_list/Decoder_Viterbi_list_parallel.hpp>
 #endif
+#ifndef DECODER_VITERBI_LIST_PARALLEL_INTER_HPP_
+#include <Module/Decoder/RSC/Viterbi_list/Decoder_Viterbi_list_parallel_inter.hpp>
+#endif
 #ifndef DECODER_RS
 #include <Module/Decoder/RS/Decoder_RS.hpp>
 #endif
@@ -567,6 +603,9 @@
 #ifndef DECODER_CHASE_PYNDIAH_HPP_
 #include <Module/Decoder/Turbo_product/Chase_pyndiah/Decoder_chase_pyndiah.hpp>
 #endif
+#ifndef DECODER_CHASE_PYNDIAH_INCR_HPP_
+#include <Module/Decoder/Turbo_product/Chase_pyndiah/Decoder_chase_pyndiah_incr.hpp>
+#endif
 #ifndef DECODER_TURBO_PRODUCT_HPP_
 #include <Module/Decoder/Turbo_product/Decoder_turbo_product.hpp>
 #endif
@@ -606,6 +645,12 @@
 #ifndef ENCODER_POLAR_HPP_
 #include <Module/Encoder/Polar/Encoder_polar.hpp>
 #endif
+#ifndef ENCODER_POLAR_PACKED_HPP_
+#include <Module/Encoder/Polar/Encoder_polar_packed.hpp>
+#endif
+#ifndef ENCODER_POLAR_PACKED_SYS_HPP_
+#include <Module/Encoder/Polar/Encoder_polar_packed_sys.hpp>
+#endif
 #ifndef ENCODER_POLAR_SYS_HPP_
 #include <Module/Encoder/Polar/Encoder_polar_sys.hpp>
 #endif
@@ -816,12 +861,18 @@
 #ifndef FULL_MATRIX_HPP_
 #include <Tools/Algo/Matrix/Full_matrix/Full_matrix.hpp>
 #endif
+#ifndef GF2_MATRIX_HPP_
+#include <Tools/Algo/Matrix/GF2_matrix/GF2_matrix.hpp>
+#endif
 #ifndef MATRIX_HPP_
 #include <Tools/Algo/Matrix/Matrix.hpp>
 #endif
 #ifndef MATRIX_UTILS_H__
 #include <Tools/Algo/Matrix/matrix_utils.h>
 #endif
+#ifndef SPARSE_MATRIX_CSR_HPP_
+#include <Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_CSR.hpp>
+#endif
 #ifndef SPARSE_MATRIX_HPP_
 #include <Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix.hpp>
 #endif
@@ -846,6 +897,9 @@
 #ifndef LC_SORTER_SIMD_HPP
 #include <Tools/Algo/Sort/LC_sorter_simd.hpp>
 #endif
+#ifndef THREAD_POOL_HPP_
+#include <Tools/Algo/Thread_pool/Thread_pool.hpp>
+#endif
 #ifndef BINARY_NODE_HPP_
 #include <Tools/Algo/Tree/Binary/Binary_node.hpp>
 #endif
@@ -990,6 +1044,9 @@
 #ifndef UPDATE_RULE_SPA_SIMD_HPP
 #include <Tools/Code/LDPC/Update_rule/SPA/Update_rule_SPA_simd.hpp>
 #endif
+#ifndef ZERO_PADDING_H_
+#include <Tools/Code/LDPC/Zero_padding/zero_padding.h>
+#endif
 #ifndef API_POLAR_DYNAMIC_INTER_8BIT_BITPACKING_HPP_
 #include <Tools/Code/Polar/API/API_polar_dynamic_inter_8bit_bitpacking.hpp>
 #endif
@@ -1050,6 +1107,9 @@
 #ifndef FROZENBITS_GENERATOR_TV_HPP_
 #include <Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_TV.hpp>
 #endif
+#ifndef FROZENBITS_GENERATOR_TV_MERGE_HPP_
+#include <Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_TV_merge.hpp>
+#endif
 #ifndef NODES_PARSER_HPP
 #include <Tools/Code/Polar/Nodes_parser.hpp>
 #endif
@@ -1083,6 +1143,9 @@
 #ifndef POLAR_CODE_HPP_
 #include <Tools/Code/Polar/Polar_code.hpp>
 #endif
+#ifndef POLAR_PROGRAM_HPP_
+#include <Tools/Code/Polar/Polar_program.hpp>
+#endif
 #ifndef RS_POLYNOMIAL_GENERATOR_HPP
 #include <Tools/Code/RS/RS_polynomial_generator.hpp>
 #endif
@@ -1233,6 +1296,12 @@
 #ifndef NUMERICAL_INTEGRATION_H_
 #include <Tools/Math/numerical_integration.h>
 #endif
+#ifndef MONITOR_BFER_COUNTERS_HPP_
+#include <Tools/Monitor/Monitor_BFER_counters.hpp>
+#endif
+#ifndef MONITOR_CHECKPOINT_HPP_
+#include <Tools/Monitor/Monitor_checkpoint.hpp>
+#endif
 #ifndef MONITOR_REDUCTION_HPP_
 #include <Tools/Monitor/Monitor_reduction.hpp>
 #endif
@@ -1245,6 +1314,9 @@
 #ifndef NOISE_HPP__
 #include <Tools/Noise/Noise.hpp>
 #endif
+#ifndef NOISE_RANGE_ADAPTIVE_HPP_
+#include <Tools/Noise/Noise_range_adaptive.hpp>
+#endif
 #ifndef NOISE_UTILS_HPP__
 #include <Tools/Noise/noise_utils.h>
 #endif
@@ -5,6 +5,7 @@
 #include "Factory/Module/CRC/CRC.hpp"
 #include "Module/CRC/NO/CRC_NO.hpp"
 #include "Module/CRC/Polynomial/CRC_polynomial.hpp"
+#include "Module/CRC/Polynomial/CRC_polynomial_clmul.hpp"
 #include "Module/CRC/Polynomial/CRC_polynomial_fast.hpp"
 #include "Module/CRC/Polynomial/CRC_polynomial_inter.hpp"
 #include "Tools/Documentation/documentation.h"
@@ -40,7 +41,7 @@ CRC ::get_description(cli::Argument_map_info& args) const
 
     tools::add_arg(args, p, class_name + "p+type,p+poly", cli::Text());
 
-    tools::add_arg(args, p, class_name + "p+implem", cli::Text(cli::Including_set("STD", "FAST", "INTER")));
+    tools::add_arg(args, p, class_name + "p+implem", cli::Text(cli::Including_set("STD", "FAST", "INTER", "CLMUL")));
 
     tools::add_arg(args, p, class_name + "p+size", cli::Integer(cli::Positive()));
 }
@@ -101,6 +102,7 @@ CRC ::build() const
         if (this->implem == "STD") return new module::CRC_polynomial<B>(K, poly, size);
         if (this->implem == "FAST") return new module::CRC_polynomial_fast<B>(K, poly, size);
         if (this->implem == "INTER") return new module::CRC_polynomial_inter<B>(K, poly, size);
+        if (this->implem == "CLMUL") return new module::CRC_polynomial_clmul<B>(K, poly, size);
     }
     else
         return new module::CRC_NO<B>(K);
@@ -83,6 +83,8 @@ Channel ::get_description(cli::Argument_map_info& args) const
     tools::add_arg(args, p, class_name + "p+complex", cli::None());
 
     tools::add_arg(args, p, class_name + "p+gain-occur", cli::Integer(cli::Positive(), cli::Non_zero()));
+
+    tools::add_arg(args, p, class_name + "p+is-scale", cli::Real(cli::Positive(), cli::Non_zero()), cli::arg_rank::ADV);
 }
 
 void
@@ -99,6 +101,7 @@ Channel ::store(const cli::Argument_map_value& vals)
     if (vals.exist({ p + "-blk-fad" })) this->block_fading = vals.at({ p + "-blk-fad" });
     if (vals.exist({ p + "-add-users" })) this->add_users = true;
     if (vals.exist({ p + "-complex" })) this->complex = true;
+    if (vals.exist({ p + "-is-scale" })) this->is_scale = vals.to_float({ p + "-is-scale" });
     if (vals.exist({ p + "-dec-granularity" })) this->dec_granularity = vals.to_int({ p + "-dec-granularity"});
     if (vals.exist({ p + "-parity-size" })) this->parity_size = vals.to_int({ p + "-parity-size"});
 }
@@ -127,6 +130,9 @@ Channel ::get_headers(std::map<std::string, tools::header_list>& headers, const
 
     headers[p].push_back(std::make_pair("Complex", this->complex ? "on" : "off"));
     headers[p].push_back(std::make_pair("Add users", this->add_users ? "on" : "off"));
+
+    if (this->is_scale != 1.f)
+        headers[p].push_back(std::make_pair("Importance sampling scale", std::to_string(this->is_scale)));
 }
 
 template<typename R>
@@ -175,7 +181,8 @@ Channel ::build_gaussian() const
     else
         throw spu::tools::cannot_allocate(__FILE__, __LINE__, __func__);
 
-    if (type == "AWGN") return new module::Channel_AWGN_LLR<R>(this->N, impl, this->seed, this->add_users);
+    if (type == "AWGN")
+        return new module::Channel_AWGN_LLR<R>(this->N, impl, this->seed, this->add_users, this->is_scale);
     if (type == "RAYLEIGH")
         return new module::Channel_Rayleigh_LLR<R>(this->N, this->complex, impl, this->seed, this->add_users);
     if (type == "RAYLEIGH_USER")
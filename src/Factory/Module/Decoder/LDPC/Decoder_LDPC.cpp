@@ -1,3 +1,4 @@
+#include <memory>
 #include <streampu.hpp>
 #include <utility>
 
@@ -33,7 +34,9 @@
 #include "Module/Decoder/LDPC/BP/Flooding/Gallager/Decoder_LDPC_BP_flooding_Gallager_E.hpp"
 #include "Module/Decoder/LDPC/BP/Flooding/SPA/Decoder_LDPC_BP_flooding_SPA.hpp"
 #include "Module/Decoder/LDPC/BP/Horizontal_layered/ONMS/Decoder_LDPC_BP_horizontal_layered_ONMS_inter.hpp"
+#include "Module/Decoder/LDPC/BP/Horizontal_layered/QC/Decoder_LDPC_BP_horizontal_layered_QC.hpp"
 #include "Module/Decoder/LDPC/BP/Peeling/Decoder_LDPC_BP_peeling.hpp"
+#include "Module/Decoder/LDPC/Zero_padding/Decoder_LDPC_zero_padding.hpp"
 
 using namespace aff3ct;
 using namespace aff3ct::factory;
@@ -103,7 +106,10 @@ Decoder_LDPC ::get_description(cli::Argument_map_info& args) const
                      "GALE",
                      "WBF",
                      "MWBF",
-                     "PPBF");
+                     "PPBF",
+                     "QC_MS",
+                     "QC_NMS",
+                     "QC_OMS");
 
     tools::add_arg(args, p, class_name + "p+ite,i", cli::Integer(cli::Positive()));
 
@@ -124,6 +130,8 @@ Decoder_LDPC ::get_description(cli::Argument_map_info& args) const
     tools::add_arg(args, p, class_name + "p+h-reorder", cli::Text(cli::Including_set("NONE", "ASC", "DSC")));
 
     tools::add_arg(args, p, class_name + "p+ppbf-proba", cli::List<float, Real_splitter>(cli::Real(), cli::Length(1)));
+
+    tools::add_arg(args, p, class_name + "p+dec-granularity", cli::Integer(cli::Positive(), cli::Non_zero()));
 }
 
 void
@@ -142,6 +150,7 @@ Decoder_LDPC ::store(const cli::Argument_map_value& vals)
     if (vals.exist({ p + "-norm" })) this->norm_factor = vals.to_float({ p + "-norm" });
     if (vals.exist({ p + "-ppbf-proba" })) this->ppbf_proba = vals.to_list<float>({ p + "-ppbf-proba" });
     if (vals.exist({ p + "-no-synd" })) this->enable_syndrome = false;
+    if (vals.exist({ p + "-dec-granularity" })) this->dec_granularity = vals.to_int({ p + "-dec-granularity" });
 
     if (!this->H_path.empty())
     {
@@ -172,10 +181,11 @@ Decoder_LDPC ::get_headers(std::map<std::string, tools::header_list>& headers, c
 
         headers[p].push_back(std::make_pair("Num. of iterations (i)", std::to_string(this->n_ite)));
 
-        if (this->implem == "NMS")
+        if (this->implem == "NMS" || this->implem == "QC_NMS")
             headers[p].push_back(std::make_pair("Normalize factor", std::to_string(this->norm_factor)));
 
-        if (this->implem == "OMS") headers[p].push_back(std::make_pair("Offset", std::to_string(this->offset)));
+        if (this->implem == "OMS" || this->implem == "QC_OMS")
+            headers[p].push_back(std::make_pair("Offset", std::to_string(this->offset)));
 
         std::string syndrome = this->enable_syndrome ? "on" : "off";
         headers[p].push_back(std::make_pair("Stop criterion (syndrome)", syndrome));
@@ -198,15 +208,44 @@ Decoder_LDPC ::get_headers(std::map<std::string, tools::header_list>& headers, c
 
         if (this->implem == "MWBF")
             headers[p].push_back(std::make_pair("Weighting factor", std::to_string(this->mwbf_factor)));
+
+        if (this->dec_granularity > 0 && this->dec_granularity < this->K)
+            headers[p].push_back(
+              std::make_pair("Zero padding (dec. granularity)", std::to_string(this->dec_granularity)));
     }
 }
 
+template<typename B, typename Q, class D>
+module::Decoder_SISO<B, Q>*
+Decoder_LDPC ::build_zero_padding(const tools::Sparse_matrix& H,
+                                  const std::vector<unsigned>& info_bits_pos,
+                                  D* (Decoder_LDPC::*build_dec)(const tools::Sparse_matrix&,
+                                                                const std::vector<unsigned>&,
+                                                                module::Encoder<B>*) const) const
+{
+    std::vector<uint32_t> kept_pos;
+    auto info_bits_pos_short = info_bits_pos;
+    const auto H_short = tools::LDPC_matrix_handler::shorten(H, info_bits_pos_short, this->dec_granularity, kept_pos);
+
+    std::unique_ptr<Decoder_LDPC> params_short(this->clone());
+    params_short->K = this->dec_granularity;
+    params_short->N_cw = (int)H_short.get_n_rows();
+    params_short->dec_granularity = 0;
+
+    std::unique_ptr<D> dec(((*params_short).*build_dec)(H_short, info_bits_pos_short, nullptr));
+    return new module::Decoder_LDPC_zero_padding<B, Q>(this->K, this->N_cw, *dec, kept_pos);
+}
+
 template<typename B, typename Q>
 module::Decoder_SISO<B, Q>*
 Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                           const std::vector<unsigned>& info_bits_pos,
                           module::Encoder<B>* encoder) const
 {
+    // the QC decoders rely on the circulant structure of H which is broken by the shortening
+    if (this->dec_granularity > 0 && this->dec_granularity < this->K && this->implem.find("QC_") != 0)
+        return this->template build_zero_padding<B, Q>(H, info_bits_pos, &Decoder_LDPC::build_siso<B, Q>);
+
     if (this->type == "BP_FLOODING" && this->simd_strategy.empty())
     {
         const auto max_CN_degree = (unsigned int)H.get_cols_max_degree();
@@ -384,6 +423,36 @@ Decoder_LDPC ::build_siso(const tools::Sparse_matrix& H,
                     this->enable_syndrome,
                     this->syndrome_depth);
         }
+        if (this->implem == "QC_MS")
+            return new module::Decoder_LDPC_BP_horizontal_layered_QC<B, Q>(this->K,
+                                                                           this->N_cw,
+                                                                           this->n_ite,
+                                                                           H,
+                                                                           info_bits_pos,
+                                                                           1.f,
+                                                                           (Q)0,
+                                                                           this->enable_syndrome,
+                                                                           this->syndrome_depth);
+        if (this->implem == "QC_NMS")
+            return new module::Decoder_LDPC_BP_horizontal_layered_QC<B, Q>(this->K,
+                                                                           this->N_cw,
+                                                                           this->n_ite,
+                                                                           H,
+                                                                           info_bits_pos,
+                                                                           this->norm_factor,
+                                                                           (Q)0,
+                                                                           this->enable_syndrome,
+                                                                           this->syndrome_depth);
+        if (this->implem == "QC_OMS")
+            return new module::Decoder_LDPC_BP_horizontal_layered_QC<B, Q>(this->K,
+                                                                           this->N_cw,
+                                                                           this->n_ite,
+                                                                           H,
+                                                                           info_bits_pos,
+                                                                           1.f,
+                                                                           (Q)this->offset,
+                                                                           this->enable_syndrome,
+                                                                           this->syndrome_depth);
     }
     else if (this->type == "BP_VERTICAL_LAYERED" && this->simd_strategy.empty())
     {
@@ -1122,6 +1191,10 @@ Decoder_LDPC ::build(const tools::Sparse_matrix& H,
                      const std::vector<unsigned>& info_bits_pos,
                      module::Encoder<B>* encoder) const
 {
+    if (this->dec_granularity > 0 && this->dec_granularity < this->K && this->implem.find("QC_") != 0 &&
+        this->type != "ML" && this->type != "CHASE")
+        return this->template build_zero_padding<B, Q>(H, info_bits_pos, &Decoder_LDPC::build<B, Q>);
+
     try
     {
         return Decoder::build<B, Q>(encoder);
@@ -5,19 +5,24 @@
 
 #include "Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_MEM_fast_CA_sys.hpp"
 #include "Module/Decoder/Polar/ASCL/Decoder_polar_ASCL_fast_CA_sys.hpp"
+#include "Module/Decoder/Polar/SC/Decoder_polar_SC_compiled_sys.hpp"
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_fast_sys.hpp"
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_naive.hpp"
 #include "Module/Decoder/Polar/SC/Decoder_polar_SC_naive_sys.hpp"
+#include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive.hpp"
 #include "Module/Decoder/Polar/SCAN/Decoder_polar_SCAN_naive_sys.hpp"
+#include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_naive.hpp"
 #include "Module/Decoder/Polar/SCF/Decoder_polar_SCF_naive_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_MEM_fast_CA_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_fast_CA_sys.hpp"
+#include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_inter_CA_sys.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA.hpp"
 #include "Module/Decoder/Polar/SCL/CRC/Decoder_polar_SCL_naive_CA_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_MEM_fast_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_fast_sys.hpp"
+#include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_inter_sys.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive.hpp"
 #include "Module/Decoder/Polar/SCL/Decoder_polar_SCL_naive_sys.hpp"
 #include "Tools/Documentation/documentation.h"
@@ -72,18 +77,25 @@ Decoder_polar ::get_description(cli::Argument_map_info& args) const
     auto p = this->get_prefix();
     const std::string class_name = "factory::Decoder_polar::";
 
-    cli::add_options(args.at({ p + "-type", "D" }), 0, "SC", "SCL", "SCL_MEM", "ASCL", "ASCL_MEM", "SCAN", "SCF");
+    cli::add_options(
+      args.at({ p + "-type", "D" }), 0, "SC", "SCL", "SCL_MEM", "ASCL", "ASCL_MEM", "SCAN", "SCF", "DSCF");
 
-    args.at({ p + "-implem" })->change_type(cli::Text(cli::Example_set("FAST", "NAIVE")));
+    args.at({ p + "-implem" })->change_type(cli::Text(cli::Example_set("FAST", "NAIVE", "COMPILED")));
 
     tools::add_arg(args, p, class_name + "p+ite,i", cli::Integer(cli::Positive(), cli::Non_zero()));
 
     tools::add_arg(args, p, class_name + "p+lists,L", cli::Integer(cli::Positive(), cli::Non_zero()));
 
+    tools::add_arg(args, p, class_name + "p+dscf-order", cli::Integer(cli::Positive(), cli::Non_zero()));
+
+    tools::add_arg(args, p, class_name + "p+dscf-alpha", cli::Real(cli::Positive()));
+
     tools::add_arg(args, p, class_name + "p+simd", cli::Text(cli::Including_set("INTRA", "INTER")));
 
     tools::add_arg(args, p, class_name + "p+polar-nodes", cli::Text());
 
+    tools::add_arg(args, p, class_name + "p+cache-path", cli::Folder(cli::openmode::read_write), cli::arg_rank::ADV);
+
     tools::add_arg(args, p, class_name + "p+partial-adaptive", cli::None());
 
     tools::add_arg(args, p, class_name + "p+no-sys", cli::None());
@@ -98,8 +110,11 @@ Decoder_polar ::store(const cli::Argument_map_value& vals)
 
     if (vals.exist({ p + "-ite", "i" })) this->n_ite = vals.to_int({ p + "-ite", "i" });
     if (vals.exist({ p + "-lists", "L" })) this->L = vals.to_int({ p + "-lists", "L" });
+    if (vals.exist({ p + "-dscf-order" })) this->dscf_order = vals.to_int({ p + "-dscf-order" });
+    if (vals.exist({ p + "-dscf-alpha" })) this->dscf_alpha = vals.to_float({ p + "-dscf-alpha" });
     if (vals.exist({ p + "-simd" })) this->simd_strategy = vals.at({ p + "-simd" });
     if (vals.exist({ p + "-polar-nodes" })) this->polar_nodes = vals.at({ p + "-polar-nodes" });
+    if (vals.exist({ p + "-cache-path" })) this->cache_path = vals.to_folder({ p + "-cache-path" });
     if (vals.exist({ p + "-partial-adaptive" })) this->full_adaptive = false;
 
     // force 1 iteration max if not SCAN (and polar code)
@@ -120,7 +135,14 @@ Decoder_polar ::get_headers(std::map<std::string, tools::header_list>& headers,
         if (this->type == "SCAN")
             headers[p].push_back(std::make_pair("Num. of iterations (i)", std::to_string(this->n_ite)));
 
-        if (this->type == "SCF") headers[p].push_back(std::make_pair("Num. of flips", std::to_string(this->flips)));
+        if (this->type == "SCF" || this->type == "DSCF")
+            headers[p].push_back(std::make_pair("Num. of flips", std::to_string(this->flips)));
+
+        if (this->type == "DSCF")
+        {
+            headers[p].push_back(std::make_pair("DSCF order", std::to_string(this->dscf_order)));
+            headers[p].push_back(std::make_pair("DSCF alpha", std::to_string(this->dscf_alpha)));
+        }
 
         if (this->type == "SCL" || this->type == "SCL_MEM")
             headers[p].push_back(std::make_pair("Num. of lists (L)", std::to_string(this->L)));
@@ -132,10 +154,17 @@ Decoder_polar ::get_headers(std::map<std::string, tools::header_list>& headers,
             headers[p].push_back(std::make_pair("Adaptative mode", adaptative_mode));
         }
 
-        if ((this->type == "SC" || this->type == "SCL" || this->type == "ASCL" || this->type == "SCL_MEM" ||
-             this->type == "ASCL_MEM") &&
-            this->implem == "FAST")
+        if ((this->type == "SC" || this->type == "SCF" || this->type == "DSCF" || this->type == "SCL" ||
+             this->type == "ASCL" || this->type == "SCL_MEM" || this->type == "ASCL_MEM") &&
+            this->implem == "FAST" && !(this->type == "SCL" && this->simd_strategy == "INTER"))
+            headers[p].push_back(std::make_pair("Polar node types", this->polar_nodes));
+
+        if (this->type == "SC" && this->implem == "COMPILED")
+        {
             headers[p].push_back(std::make_pair("Polar node types", this->polar_nodes));
+            if (!this->cache_path.empty())
+                headers[p].push_back(std::make_pair("Programs cache path", this->cache_path));
+        }
     }
 }
 
@@ -148,6 +177,18 @@ Decoder_polar ::build_siso(const std::vector<bool>& frozen_bits, module::Encoder
         if (this->implem == "NAIVE")
             return new module::Decoder_polar_SCAN_naive_sys<B, Q, tools::f_LLR<Q>, tools::v_LLR<Q>, tools::h_LLR<B, Q>>(
               this->K, this->N_cw, this->n_ite, frozen_bits);
+        if (this->implem == "FAST")
+        {
+            if (this->simd_strategy == "INTER")
+                return new module::Decoder_polar_SCAN_fast_sys<B, Q, tools::API_polar_dynamic_inter<B, Q>>(
+                  this->K, this->N_cw, this->n_ite, frozen_bits);
+            if (this->simd_strategy == "INTRA")
+                return new module::Decoder_polar_SCAN_fast_sys<B, Q, tools::API_polar_dynamic_intra<B, Q>>(
+                  this->K, this->N_cw, this->n_ite, frozen_bits);
+            if (this->simd_strategy.empty())
+                return new module::Decoder_polar_SCAN_fast_sys<B, Q, tools::API_polar_dynamic_seq<B, Q>>(
+                  this->K, this->N_cw, this->n_ite, frozen_bits);
+        }
     }
     else if (this->type == "SCAN" && !this->systematic)
     {
@@ -227,6 +268,36 @@ Decoder_polar ::_build(const std::vector<bool>& frozen_bits,
             if (this->type == "SC")
                 decoder = new module::Decoder_polar_SC_fast_sys<B, Q, API_polar>(
                   this->K, this->N_cw, frozen_bits, polar_patterns, idx_r0, idx_r1);
+            if (crc != nullptr && std::unique_ptr<module::CRC<B>>(crc->clone())->get_size() > 0)
+            {
+                if (this->type == "SCF")
+                    decoder = new module::Decoder_polar_SCF_fast_sys<B, Q, API_polar>(
+                      this->K, this->N_cw, frozen_bits, polar_patterns, idx_r0, idx_r1, *crc, this->flips);
+                if (this->type == "DSCF")
+                    decoder = new module::Decoder_polar_SCF_fast_sys<B, Q, API_polar>(this->K,
+                                                                                       this->N_cw,
+                                                                                       frozen_bits,
+                                                                                       polar_patterns,
+                                                                                       idx_r0,
+                                                                                       idx_r1,
+                                                                                       *crc,
+                                                                                       this->flips,
+                                                                                       this->dscf_order,
+                                                                                       this->dscf_alpha);
+            }
+
+            for (auto p : polar_patterns)
+                delete p;
+            if (decoder != nullptr) return decoder;
+        }
+        else if (this->implem == "COMPILED")
+        {
+            int idx_r0, idx_r1;
+            auto polar_patterns = tools::Nodes_parser<>::parse_ptr(this->polar_nodes, idx_r0, idx_r1);
+            module::Decoder_SIHO<B, Q>* decoder = nullptr;
+            if (this->type == "SC")
+                decoder = new module::Decoder_polar_SC_compiled_sys<B, Q, API_polar>(
+                  this->K, this->N_cw, frozen_bits, polar_patterns, idx_r0, idx_r1, this->cache_path);
 
             for (auto p : polar_patterns)
                 delete p;
@@ -294,6 +365,8 @@ Decoder_polar ::build(const std::vector<bool>& frozen_bits,
     }
     catch (spu::tools::cannot_allocate const&)
     {
+        if (this->type == "SCAN" && this->implem == "FAST") return this->build_siso<B, Q>(frozen_bits, encoder);
+
         if (this->type.find("SCL") != std::string::npos && this->implem == "FAST")
         {
             if (this->simd_strategy == "INTRA")
@@ -311,13 +384,25 @@ Decoder_polar ::build(const std::vector<bool>& frozen_bits,
                     return _build_scl_fast<B, Q, tools::API_polar_dynamic_intra<B, Q>>(frozen_bits, crc, encoder);
                 }
             }
+            else if (this->simd_strategy == "INTER" && this->type == "SCL" && this->systematic)
+            {
+                // one frame per SIMD lane, the tree is only pruned with the rate 0 nodes (the polar nodes are ignored)
+                using API_polar = tools::API_polar_dynamic_inter<B, Q>;
+                if (crc != nullptr && std::unique_ptr<module::CRC<B>>(crc->clone())->get_size() > 0)
+                    return new module::Decoder_polar_SCL_inter_CA_sys<B, Q, API_polar>(
+                      this->K, this->N_cw, this->L, frozen_bits, *crc);
+                else
+                    return new module::Decoder_polar_SCL_inter_sys<B, Q, API_polar>(
+                      this->K, this->N_cw, this->L, frozen_bits);
+            }
             else if (this->simd_strategy.empty())
             {
                 return _build_scl_fast<B, Q, tools::API_polar_dynamic_seq<B, Q>>(frozen_bits, crc, encoder);
             }
         }
 
-        if (this->simd_strategy == "INTER" && this->type == "SC" && this->implem == "FAST")
+        if (this->simd_strategy == "INTER" && this->type == "SC" &&
+            (this->implem == "FAST" || this->implem == "COMPILED"))
         {
             if (typeid(B) == typeid(signed char))
             {
@@ -346,7 +431,7 @@ Decoder_polar ::build(const std::vector<bool>& frozen_bits,
                 return _build<B, Q, API_polar>(frozen_bits, crc, encoder);
             }
         }
-        else if (this->simd_strategy == "INTRA" && this->implem == "FAST")
+        else if (this->simd_strategy == "INTRA" && (this->implem == "FAST" || this->implem == "COMPILED"))
         {
             if (typeid(B) == typeid(signed char))
             {
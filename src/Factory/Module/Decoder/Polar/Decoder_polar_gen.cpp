@@ -8,6 +8,8 @@
 
 // before to uncomment these next lines, make sure to run the script to generate the decoders
 // (see "scripts/generate_polar_decoders.sh")
+// the "COMPILED" implementation of the SC decoder (see "Decoder_polar_SC_compiled_sys") gives close performances for
+// any code without having to generate and to build the decoders
 
 // RATE 1/2
 // #define ENABLE_DECODER_SC_FAST_N4_K2_SNR25
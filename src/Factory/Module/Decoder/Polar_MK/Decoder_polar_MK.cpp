@@ -4,6 +4,8 @@
 #include "Factory/Module/Decoder/Polar_MK/Decoder_polar_MK.hpp"
 #include "Module/Decoder/Polar_MK/ASCL/Decoder_polar_MK_ASCL_naive_CA.hpp"
 #include "Module/Decoder/Polar_MK/ASCL/Decoder_polar_MK_ASCL_naive_CA_sys.hpp"
+#include "Module/Decoder/Polar_MK/SC/Decoder_polar_MK_SC_fast.hpp"
+#include "Module/Decoder/Polar_MK/SC/Decoder_polar_MK_SC_fast_sys.hpp"
 #include "Module/Decoder/Polar_MK/SC/Decoder_polar_MK_SC_naive.hpp"
 #include "Module/Decoder/Polar_MK/SC/Decoder_polar_MK_SC_naive_sys.hpp"
 #include "Module/Decoder/Polar_MK/SCL/CRC/Decoder_polar_MK_SCL_naive_CA.hpp"
@@ -49,7 +51,7 @@ Decoder_polar_MK ::get_description(cli::Argument_map_info& args) const
 
     cli::add_options(args.at({ p + "-type", "D" }), 0, "SC", "SCL", "ASCL");
 
-    args.at({ p + "-implem" })->change_type(cli::Text(cli::Example_set("NAIVE")));
+    args.at({ p + "-implem" })->change_type(cli::Text(cli::Example_set("NAIVE", "FAST")));
 
     tools::add_arg(args, p, class_name + "p+lists,L", cli::Integer(cli::Positive(), cli::Non_zero()));
 
@@ -91,6 +93,15 @@ Decoder_polar_MK ::build(const tools::Polar_code& code,
     }
     catch (spu::tools::cannot_allocate const&)
     {
+        // the fast decoder compiles its own min-sum update tables from the kernel matrices
+        if (this->implem == "FAST" && this->type == "SC" && this->node_type == "MS")
+        {
+            if (!this->systematic)
+                return new module::Decoder_polar_MK_SC_fast<B, Q>(this->K, this->N_cw, code, frozen_bits);
+            else
+                return new module::Decoder_polar_MK_SC_fast_sys<B, Q>(this->K, this->N_cw, code, frozen_bits);
+        }
+
         std::vector<std::vector<std::function<Q(const std::vector<Q>& LLRs, const std::vector<B>& bits)>>> lambdas(
           code.get_kernel_matrices().size());
 
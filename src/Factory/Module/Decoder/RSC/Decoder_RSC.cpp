@@ -21,7 +21,9 @@
 #include "Module/Decoder/RSC/BCJR/Seq_generic/Decoder_RSC_BCJR_seq_generic_std.hpp"
 #include "Module/Decoder/RSC/BCJR/Seq_generic/Decoder_RSC_BCJR_seq_generic_std_json.hpp"
 #include "Module/Decoder/RSC/Viterbi/Decoder_Viterbi_SIHO.hpp"
+#include "Module/Decoder/RSC/Viterbi/Decoder_Viterbi_SIHO_inter.hpp"
 #include "Module/Decoder/RSC/Viterbi_list/Decoder_Viterbi_list_parallel.hpp"
+#include "Module/Decoder/RSC/Viterbi_list/Decoder_Viterbi_list_parallel_inter.hpp"
 #include "Tools/Documentation/documentation.h"
 
 using namespace aff3ct;
@@ -269,6 +271,9 @@ Decoder_RSC ::build_viterbi(const std::vector<std::vector<int>>& trellis) const
         throw spu::tools::invalid_argument("Viterbi decoder is incompatible with buffered encoding. "
                                            "Please add --enc-no-buff or choose another decoder.");
     }
+    if (this->simd_strategy == "INTER")
+        return new module::Decoder_Viterbi_SIHO_inter<B, Q>(this->K, trellis, true);
+
     return new module::Decoder_Viterbi_SIHO<B, Q>(this->K, trellis, true);
 }
 
@@ -281,6 +286,9 @@ Decoder_RSC ::build_viterbi_list(const std::vector<std::vector<int>>& trellis, c
         throw spu::tools::invalid_argument("Parallel list Viterbi decoder is incompatible with buffered encoding. "
                                            "Please add --enc-no-buff or choose another decoder.");
     }
+    if (this->simd_strategy == "INTER")
+        return new module::Decoder_Viterbi_list_parallel_inter<B, Q>(this->K, this->L, *crc, trellis);
+
     return new module::Decoder_Viterbi_list_parallel<B, Q>(this->K, this->N_cw, this->L, *crc, trellis, true);
 }
 
@@ -118,7 +118,7 @@ Decoder_turbo_product ::get_description(cli::Argument_map_info& args) const
     }
 
     cli::add_options(args.at({ p + "-type", "D" }), 0, "CP");
-    cli::add_options(args.at({ p + "-implem" }), 0, "FAST");
+    cli::add_options(args.at({ p + "-implem" }), 0, "FAST", "INCR");
 
     tools::add_arg(args, p, class_name + "p+ite,i", cli::Integer(cli::Positive(), cli::Non_zero()));
 
@@ -137,6 +137,12 @@ Decoder_turbo_product ::get_description(cli::Argument_map_info& args) const
 
     tools::add_arg(args, p, class_name + "p+cp-coef", cli::List<float, Real_splitter>(cli::Real(), cli::Length(5, 5)));
 
+    tools::add_arg(args,
+                   p,
+                   class_name + "p+threads",
+                   cli::Integer(cli::Positive(), cli::Non_zero()),
+                   cli::arg_rank::ADV);
+
     sub->get_description(args);
 
     auto ps = sub->get_prefix();
@@ -163,6 +169,7 @@ Decoder_turbo_product ::store(const cli::Argument_map_value& vals)
         this->n_competitors = this->n_test_vectors;
 
     if (vals.exist({ p + "-ext" })) this->parity_extended = true;
+    if (vals.exist({ p + "-threads" })) this->n_threads = vals.to_int({ p + "-threads" });
 
     if (vals.exist({ p + "-alpha" }))
     {
@@ -264,6 +271,9 @@ Decoder_turbo_product ::get_headers(std::map<std::string, tools::header_list>& h
 
         headers[p].push_back(std::make_pair("Parity extended", (this->parity_extended ? "yes" : "no")));
 
+        if (full || this->n_threads > 1)
+            headers[p].push_back(std::make_pair("Num. of threads", std::to_string(this->n_threads)));
+
         sub->get_headers(headers, full);
     }
 }
@@ -284,7 +294,7 @@ Decoder_turbo_product ::build(const module::Decoder_chase_pyndiah<B, Q>& cp_r,
         if (this->type == "CP")
         {
             if (this->implem == "STD")
-                return new module::Decoder_turbo_product<B, Q>(n_ite, alpha, cp_r, cp_c, itl, beta);
+                return new module::Decoder_turbo_product<B, Q>(n_ite, alpha, cp_r, cp_c, itl, beta, n_threads);
         }
     }
 
@@ -56,6 +56,8 @@ Encoder_LDPC ::get_description(cli::Argument_map_info& args) const
 
     tools::add_arg(args, p, class_name + "p+g-save-path", cli::File(cli::openmode::write));
 
+    tools::add_arg(args, p, class_name + "p+cache-path", cli::Folder(cli::openmode::read_write), cli::arg_rank::ADV);
+
     tools::add_arg(args, p, class_name + "p+dec-granularity", cli::Integer(cli::Positive(), cli::Non_zero()), cli::arg_rank::REQ);
 }
 
@@ -69,6 +71,7 @@ Encoder_LDPC ::store(const cli::Argument_map_value& vals)
     if (vals.exist({ p + "-h-reorder" })) this->H_reorder = vals.at({ p + "-h-reorder" });
     if (vals.exist({ p + "-g-method" })) this->G_method = vals.at({ p + "-g-method" });
     if (vals.exist({ p + "-g-save-path" })) this->G_save_path = vals.at({ p + "-g-save-path" });
+    if (vals.exist({ p + "-cache-path" })) this->cache_path = vals.to_folder({ p + "-cache-path" });
     if (vals.exist({ p + "-dec-granularity" })) this->dec_granularity = vals.to_int({ p + "-dec-granularity"});
 
     if (!this->G_path.empty())
@@ -105,6 +108,9 @@ Encoder_LDPC ::get_headers(std::map<std::string, tools::header_list>& headers, c
         headers[p].push_back(std::make_pair("G build method", this->G_method));
         if (this->G_save_path != "") headers[p].push_back(std::make_pair("G save path", this->G_save_path));
     }
+
+    if ((this->type == "LDPC_H" && this->G_method == "LU_DEC") || this->type == "LDPC_QC")
+        if (this->cache_path != "") headers[p].push_back(std::make_pair("Matrices cache path", this->cache_path));
 }
 
 template<typename B>
@@ -113,8 +119,10 @@ Encoder_LDPC ::build(const tools::Sparse_matrix& G, const tools::Sparse_matrix&
 {
     if (this->type == "LDPC") return new module::Encoder_LDPC<B>(this->K, this->N_cw, G);
     if (this->type == "LDPC_H")
-        return new module::Encoder_LDPC_from_H<B>(this->K, this->N_cw, H, this->G_method, this->G_save_path, true);
-    if (this->type == "LDPC_QC") return new module::Encoder_LDPC_from_QC<B>(this->K, this->N_cw, H);
+        return new module::Encoder_LDPC_from_H<B>(
+          this->K, this->N_cw, H, this->G_method, this->G_save_path, true, this->cache_path);
+    if (this->type == "LDPC_QC")
+        return new module::Encoder_LDPC_from_QC<B>(this->K, this->N_cw, H, this->dec_granularity, this->cache_path);
     if (this->type == "LDPC_IRA") return new module::Encoder_LDPC_from_IRA<B>(this->K, this->N_cw, H);
 
     throw spu::tools::cannot_allocate(__FILE__, __LINE__, __func__);
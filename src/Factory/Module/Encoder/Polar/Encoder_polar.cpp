@@ -2,6 +2,8 @@
 
 #include "Factory/Module/Encoder/Polar/Encoder_polar.hpp"
 #include "Module/Encoder/Polar/Encoder_polar.hpp"
+#include "Module/Encoder/Polar/Encoder_polar_packed.hpp"
+#include "Module/Encoder/Polar/Encoder_polar_packed_sys.hpp"
 #include "Module/Encoder/Polar/Encoder_polar_sys.hpp"
 #include "Tools/Documentation/documentation.h"
 
@@ -31,7 +33,7 @@ Encoder_polar ::get_description(cli::Argument_map_info& args) const
     auto p = this->get_prefix();
     const std::string class_name = "factory::Encoder_polar::";
 
-    cli::add_options(args.at({ p + "-type" }), 0, "POLAR");
+    cli::add_options(args.at({ p + "-type" }), 0, "POLAR", "POLAR_PACKED");
 
     tools::add_arg(args, p, class_name + "p+no-sys", cli::None());
 }
@@ -56,6 +58,10 @@ Encoder_polar ::build(const std::vector<bool>& frozen_bits) const
         return new module::Encoder_polar<B>(this->K, this->N_cw, frozen_bits);
     if (this->type == "POLAR" && this->systematic)
         return new module::Encoder_polar_sys<B>(this->K, this->N_cw, frozen_bits);
+    if (this->type == "POLAR_PACKED" && !this->systematic)
+        return new module::Encoder_polar_packed<B>(this->K, this->N_cw, frozen_bits);
+    if (this->type == "POLAR_PACKED" && this->systematic)
+        return new module::Encoder_polar_packed_sys<B>(this->K, this->N_cw, frozen_bits);
 
     throw spu::tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
@@ -40,6 +40,8 @@ Monitor_BFER ::get_description(cli::Argument_map_info& args) const
     tools::add_arg(args, p, class_name + "p+err-hist", cli::Integer(cli::Positive()));
 
     tools::add_arg(args, p, class_name + "p+err-hist-path", cli::File(cli::openmode::write));
+
+    tools::add_arg(args, p, class_name + "p+dec-granularity", cli::Integer(cli::Positive(), cli::Non_zero()));
 }
 
 void
@@ -54,6 +56,7 @@ Monitor_BFER ::store(const cli::Argument_map_value& vals)
     if (vals.exist({ p + "-err-hist" })) this->err_hist = vals.to_int({ p + "-err-hist" });
     if (vals.exist({ p + "-err-hist-path" })) this->err_hist_path = vals.at({ p + "-err-hist-path" });
     if (vals.exist({ p + "-max-fra", "n" })) this->max_frame = vals.to_int({ p + "-max-fra", "n" });
+    if (vals.exist({ p + "-dec-granularity" })) this->dec_granularity = vals.to_int({ p + "-dec-granularity" });
 }
 
 void
@@ -65,6 +68,8 @@ Monitor_BFER ::get_headers(std::map<std::string, tools::header_list>& headers, c
 
     headers[p].push_back(std::make_pair("Frame error count (e)", std::to_string(this->n_frame_errors)));
     if (full) headers[p].push_back(std::make_pair("Size (K)", std::to_string(this->K)));
+    if (this->dec_granularity > 0 && this->dec_granularity < this->K)
+        headers[p].push_back(std::make_pair("Checked bits (dec. granularity)", std::to_string(this->dec_granularity)));
 
     if (this->err_hist >= 0) headers[p].push_back(std::make_pair("Error histogram path", this->err_hist_path));
 }
@@ -74,7 +79,8 @@ module::Monitor_BFER<B>*
 Monitor_BFER ::build(bool count_unknown_values) const
 {
     if (this->type == "STD")
-        return new module::Monitor_BFER<B>(this->K, this->n_frame_errors, this->max_frame, count_unknown_values);
+        return new module::Monitor_BFER<B>(
+          this->K, this->n_frame_errors, this->max_frame, count_unknown_values, this->dec_granularity);
 
     throw spu::tools::cannot_allocate(__FILE__, __LINE__, __func__);
 }
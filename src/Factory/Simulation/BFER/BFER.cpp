@@ -241,9 +241,24 @@ BFER ::get_description(cli::Argument_map_info& args) const
     tools::add_arg(args, pmnt, class_name + "p+red-lazy", cli::None());
 
     tools::add_arg(args, pmnt, class_name + "p+red-lazy-freq", cli::Integer(cli::Positive(), cli::Non_zero()));
+
+    tools::add_arg(args, pmnt, class_name + "p+red-atomic", cli::None());
 #endif
 
     tools::add_arg(args, p, class_name + "p+sequence-path", cli::File(cli::openmode::write), cli::arg_rank::ADV);
+
+#ifndef AFF3CT_MPI
+    tools::add_arg(
+      args, p, class_name + "p+noise-par", cli::Integer(cli::Positive(), cli::Non_zero()), cli::arg_rank::ADV);
+
+    tools::add_arg(args, p, class_name + "p+chkpt", cli::None(), cli::arg_rank::ADV);
+
+    tools::add_arg(args, p, class_name + "p+chkpt-path", cli::File(cli::openmode::read_write), cli::arg_rank::ADV);
+
+    tools::add_arg(args, p, class_name + "p+chkpt-freq", cli::Integer(cli::Positive()), cli::arg_rank::ADV);
+
+    tools::add_arg(args, p, class_name + "p+resume", cli::None(), cli::arg_rank::ADV);
+#endif
 }
 
 void
@@ -267,11 +282,25 @@ BFER ::store(const cli::Argument_map_value& vals)
         this->coded_monitoring = true;
 
     if (vals.exist({ p + "-sequence-path" })) this->sequence_path = vals.at({ p + "-sequence-path" });
+#ifndef AFF3CT_MPI
+    if (vals.exist({ p + "-noise-par" })) this->noise_par = vals.to_int({ p + "-noise-par" });
+    if (vals.exist({ p + "-chkpt" })) this->chkpt_enable = true;
+    if (vals.exist({ p + "-chkpt-path" })) this->chkpt_path = vals.at({ p + "-chkpt-path" });
+    if (vals.exist({ p + "-chkpt-freq" })) this->chkpt_freq = seconds(vals.to_int({ p + "-chkpt-freq" }));
+    if (vals.exist({ p + "-resume" }))
+    {
+        this->chkpt_enable = true;
+        this->chkpt_resume = true;
+    }
+#endif
 
     if (this->err_track_revert)
     {
         this->err_track_enable = false;
         this->n_threads = 1;
+        this->noise_par = 1;
+        this->chkpt_enable = false;
+        this->chkpt_resume = false;
     }
 
     auto pter = ter->get_prefix();
@@ -292,6 +321,7 @@ BFER ::store(const cli::Argument_map_value& vals)
         this->mnt_red_lazy = true;
         this->mnt_red_lazy_freq = milliseconds(vals.to_int({ pmnt + "-red-lazy-freq" }));
     }
+    if (vals.exist({ pmnt + "-red-atomic" })) this->mnt_red_atomic = true;
 #endif
 }
 
@@ -316,6 +346,7 @@ BFER ::get_headers(std::map<std::string, tools::header_list>& headers, const boo
     if (this->mnt_red_lazy)
         headers[pmnt].push_back(
           std::make_pair("Lazy reduction freq. (ms)", std::to_string(this->mnt_red_lazy_freq.count())));
+    headers[pmnt].push_back(std::make_pair("Atomic counters", this->mnt_red_atomic ? "on" : "off"));
 #endif
 
     headers[p].push_back(std::make_pair("Coset approach (c)", this->coset ? "yes" : "no"));
@@ -333,6 +364,19 @@ BFER ::get_headers(std::map<std::string, tools::header_list>& headers, const boo
     if (this->err_track_threshold)
         headers[p].push_back(std::make_pair("Bad frames threshold", std::to_string(this->err_track_threshold)));
 
+#ifndef AFF3CT_MPI
+    if (this->noise_par > 1)
+        headers[p].push_back(std::make_pair("Concurrent noise points", std::to_string(this->noise_par)));
+
+    headers[p].push_back(std::make_pair("Checkpoint", this->chkpt_enable ? "on" : "off"));
+    if (this->chkpt_enable)
+    {
+        headers[p].push_back(std::make_pair("Checkpoint path", this->chkpt_path));
+        headers[p].push_back(std::make_pair("Checkpoint freq. (s)", std::to_string(this->chkpt_freq.count())));
+        headers[p].push_back(std::make_pair("Resume from checkpoint", this->chkpt_resume ? "yes" : "no"));
+    }
+#endif
+
     if (this->err_track_enable || this->err_track_revert)
     {
         std::string path = this->err_track_path + std::string("_$noise.[src,enc,chn]");
@@ -33,6 +33,11 @@ class BFER : public Simulation
     std::string err_track_path = "error_tracker";
     std::string sequence_path = "";
     int err_track_threshold = 0;
+    int noise_par = 1;
+    std::string chkpt_path = "checkpoint.bin";
+    std::chrono::seconds chkpt_freq = std::chrono::seconds(300);
+    bool chkpt_enable = false;
+    bool chkpt_resume = false;
     bool err_track_revert = false;
     bool err_track_enable = false;
     bool coset = false;
@@ -45,6 +50,7 @@ class BFER : public Simulation
 #else
     std::chrono::milliseconds mnt_red_lazy_freq = std::chrono::milliseconds(0);
     bool mnt_red_lazy = false;
+    bool mnt_red_atomic = false;
 #endif
 
     // module parameters
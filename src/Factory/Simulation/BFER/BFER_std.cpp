@@ -1,5 +1,11 @@
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+#include <vector>
+
 #include "Factory/Simulation/BFER/BFER_std.hpp"
 #include "Simulation/BFER/Standard/Simulation_BFER_std.hpp"
+#include "Tools/Documentation/documentation.h"
 
 using namespace aff3ct;
 using namespace aff3ct::factory;
@@ -18,22 +24,84 @@ BFER_std ::clone() const
     return new BFER_std(*this);
 }
 
+struct Integer_splitter
+{
+    static std::vector<std::string> split(const std::string& val)
+    {
+        const std::string head = "{([";
+        const std::string queue = "})]";
+        const std::string separator = ",";
+
+        return cli::Splitter::split(val, head, queue, separator);
+    }
+};
+
 void
 BFER_std ::get_description(cli::Argument_map_info& args) const
 {
     BFER::get_description(args);
+
+#ifndef AFF3CT_MPI
+    auto p = this->get_prefix();
+    const std::string class_name = "factory::BFER_std::";
+
+    tools::add_arg(args,
+                   p,
+                   class_name + "p+pl-threads",
+                   cli::List<int, Integer_splitter>(cli::Integer(cli::Positive(), cli::Non_zero()), cli::Length(3, 3)));
+
+    tools::add_arg(args, p, class_name + "p+pl-split", cli::Text(cli::Including_set("DEC", "DEMOD")));
+
+    tools::add_arg(
+      args, p, class_name + "p+pl-buffer", cli::Integer(cli::Positive(), cli::Non_zero()), cli::arg_rank::ADV);
+#endif
 }
 
 void
 BFER_std ::store(const cli::Argument_map_value& vals)
 {
     BFER::store(vals);
+
+#ifndef AFF3CT_MPI
+    auto p = this->get_prefix();
+
+    if (vals.exist({ p + "-pl-threads" }))
+    {
+        this->pl_threads.clear();
+        for (auto t : vals.to_list<int>({ p + "-pl-threads" }))
+            this->pl_threads.push_back((size_t)t);
+    }
+    if (vals.exist({ p + "-pl-split" })) this->pl_split = vals.at({ p + "-pl-split" });
+    if (vals.exist({ p + "-pl-buffer" })) this->pl_buffer = vals.to_int({ p + "-pl-buffer" });
+
+    if (!this->pl_threads.empty() && this->noise_par > 1)
+    {
+        std::stringstream message;
+        message << "The pipeline ('--" << p << "-pl-threads') can't simulate concurrent noise points ('--" << p
+                << "-noise-par' = " << this->noise_par << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+#endif
 }
 
 void
 BFER_std ::get_headers(std::map<std::string, tools::header_list>& headers, const bool full) const
 {
     BFER::get_headers(headers, full);
+
+#ifndef AFF3CT_MPI
+    auto p = this->get_prefix();
+
+    if (!this->pl_threads.empty())
+    {
+        std::string threads = "";
+        for (auto t : this->pl_threads)
+            threads += (threads.empty() ? "" : ", ") + std::to_string(t);
+        headers[p].push_back(std::make_pair("Pipeline threads (TX, DEC, MNT)", threads));
+        headers[p].push_back(std::make_pair("Pipeline split", this->pl_split));
+        headers[p].push_back(std::make_pair("Pipeline buffer size", std::to_string(this->pl_buffer)));
+    }
+#endif
 }
 
 const Codec_SIHO*
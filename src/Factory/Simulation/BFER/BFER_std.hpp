@@ -2,8 +2,10 @@
 #define FACTORY_SIMULATION_BFER_STD_HPP_
 
 #include <cli.hpp>
+#include <cstddef>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "Factory/Simulation/BFER/BFER.hpp"
 #include "Factory/Tools/Codec/Codec_SIHO.hpp"
@@ -29,6 +31,11 @@ class BFER_std : public BFER
     // module parameters
     // Codec_SIHO *cdc = nullptr;
 
+    // optional parameters
+    std::vector<size_t> pl_threads; // threads of the TX, decoding and monitoring stages, empty when not pipelined
+    std::string pl_split = "DEC";
+    size_t pl_buffer = 16;
+
     // -------------------------------------------------------------------------------------------------------- METHODS
     explicit BFER_std(const std::string& p = BFER_std_prefix);
     virtual ~BFER_std() = default;
@@ -6,6 +6,7 @@
 #include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_BEC.hpp"
 #include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_GA_Arikan.hpp"
 #include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_TV.hpp"
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_TV_merge.hpp"
 #include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_file.hpp"
 #include "Tools/Documentation/documentation.h"
 
@@ -46,12 +47,18 @@ Frozenbits_generator ::get_description(cli::Argument_map_info& args) const
     tools::add_arg(args, p, class_name + "p+noise", cli::Real(cli::Positive(), cli::Non_zero()));
 
     tools::add_arg(
-      args, p, class_name + "p+gen-method", cli::Text(cli::Including_set("GA", "FILE", "5G", "TV", "BEC")));
+      args, p, class_name + "p+gen-method", cli::Text(cli::Including_set("GA", "FILE", "5G", "TV", "TVM", "BEC")));
 
     tools::add_arg(args, p, class_name + "p+awgn-path", cli::Path(cli::openmode::read));
 
     tools::add_arg(args, p, class_name + "p+dump-path", cli::Folder(cli::openmode::write));
 
+    tools::add_arg(args, p, class_name + "p+cache-path", cli::Folder(cli::openmode::read_write), cli::arg_rank::ADV);
+
+    tools::add_arg(args, p, class_name + "p+tv-mu", cli::Integer(cli::Positive(), cli::Non_zero()));
+
+    tools::add_arg(args, p, class_name + "p+tv-channel", cli::Text(cli::Including_set("AWGN", "BEC", "BSC")));
+
 #ifdef AFF3CT_POLAR_BOUNDS
     tools::add_arg(args, p, class_name + "p+pb-path", cli::File(cli::openmode::read));
 #endif
@@ -68,6 +75,9 @@ Frozenbits_generator ::store(const cli::Argument_map_value& vals)
     if (vals.exist({ p + "-awgn-path" })) this->path_fb = vals.to_path({ p + "-awgn-path" });
     if (vals.exist({ p + "-gen-method" })) this->type = vals.at({ p + "-gen-method" });
     if (vals.exist({ p + "-dump-path" })) this->dump_channels_path = vals.to_folder({ p + "-dump-path" });
+    if (vals.exist({ p + "-cache-path" })) this->cache_path = vals.to_folder({ p + "-cache-path" });
+    if (vals.exist({ p + "-tv-mu" })) this->tv_mu = vals.to_int({ p + "-tv-mu" });
+    if (vals.exist({ p + "-tv-channel" })) this->tv_channel = vals.at({ p + "-tv-channel" });
 
 #ifdef AFF3CT_POLAR_BOUNDS
     if (vals.exist({ p + "-pb-path" })) this->path_pb = vals.to_file({ p + "-pb-path" });
@@ -87,20 +97,38 @@ Frozenbits_generator ::get_headers(std::map<std::string, tools::header_list>& he
     if (this->type == "TV") headers[p].push_back(std::make_pair("PB path", this->path_pb));
 #endif
     if (this->type == "TV" || this->type == "FILE") headers[p].push_back(std::make_pair("Path", this->path_fb));
-    if (!this->dump_channels_path.empty() && (this->type == "GA" || this->type == "BEC"))
+    if (this->type == "TVM")
+    {
+        headers[p].push_back(std::make_pair("Channel", this->tv_channel));
+        headers[p].push_back(std::make_pair("Alphabet size (mu)", std::to_string(this->tv_mu)));
+    }
+    if (!this->dump_channels_path.empty() && (this->type == "GA" || this->type == "TVM" || this->type == "BEC"))
         headers[p].push_back(std::make_pair("Dump channels path", this->dump_channels_path));
+    if (!this->cache_path.empty() && (this->type == "GA" || this->type == "TVM" || this->type == "BEC"))
+        headers[p].push_back(std::make_pair("Cache path", this->cache_path));
 }
 
 tools::Frozenbits_generator*
 Frozenbits_generator ::build() const
 {
+    tools::Frozenbits_generator* fbg = nullptr;
+
     if (this->type == "GA")
-        return new tools::Frozenbits_generator_GA_Arikan(this->K, this->N_cw, this->dump_channels_path);
-    if (this->type == "TV")
-        return new tools::Frozenbits_generator_TV(this->K, this->N_cw, this->path_fb, this->path_pb);
-    if (this->type == "FILE") return new tools::Frozenbits_generator_file(this->K, this->N_cw, this->path_fb);
-    if (this->type == "5G") return new tools::Frozenbits_generator_5G(this->K, this->N_cw);
-    if (this->type == "BEC") return new tools::Frozenbits_generator_BEC(this->K, this->N_cw, this->dump_channels_path);
-
-    throw spu::tools::cannot_allocate(__FILE__, __LINE__, __func__);
+        fbg = new tools::Frozenbits_generator_GA_Arikan(this->K, this->N_cw, this->dump_channels_path);
+    else if (this->type == "TV")
+        fbg = new tools::Frozenbits_generator_TV(this->K, this->N_cw, this->path_fb, this->path_pb);
+    else if (this->type == "TVM")
+        fbg = new tools::Frozenbits_generator_TV_merge(
+          this->K, this->N_cw, this->tv_mu, this->tv_channel == "BSC", 0, this->dump_channels_path);
+    else if (this->type == "FILE")
+        fbg = new tools::Frozenbits_generator_file(this->K, this->N_cw, this->path_fb);
+    else if (this->type == "5G")
+        fbg = new tools::Frozenbits_generator_5G(this->K, this->N_cw);
+    else if (this->type == "BEC")
+        fbg = new tools::Frozenbits_generator_BEC(this->K, this->N_cw, this->dump_channels_path);
+
+    if (fbg == nullptr) throw spu::tools::cannot_allocate(__FILE__, __LINE__, __func__);
+
+    fbg->set_cache_path(this->cache_path);
+    return fbg;
 }
\ No newline at end of file
@@ -43,6 +43,8 @@ Frozenbits_generator_MK ::get_description(cli::Argument_map_info& args) const
     tools::add_arg(args, p, class_name + "p+awgn-path", cli::File(cli::openmode::read));
 
     tools::add_arg(args, p, class_name + "p+dump-path", cli::Folder(cli::openmode::write));
+
+    tools::add_arg(args, p, class_name + "p+cache-path", cli::Folder(cli::openmode::read_write), cli::arg_rank::ADV);
 }
 
 void
@@ -56,6 +58,7 @@ Frozenbits_generator_MK ::store(const cli::Argument_map_value& vals)
     if (vals.exist({ p + "-awgn-path" })) this->path_fb = vals.to_file({ p + "-awgn-path" });
     if (vals.exist({ p + "-gen-method" })) this->type = vals.at({ p + "-gen-method" });
     if (vals.exist({ p + "-dump-path" })) this->dump_channels_path = vals.to_folder({ p + "-dump-path" });
+    if (vals.exist({ p + "-cache-path" })) this->cache_path = vals.to_folder({ p + "-cache-path" });
 }
 
 void
@@ -70,16 +73,24 @@ Frozenbits_generator_MK ::get_headers(std::map<std::string, tools::header_list>&
     if (this->type == "FILE") headers[p].push_back(std::make_pair("Path", this->path_fb));
     if (!this->dump_channels_path.empty() && (this->type == "GA" || this->type == "GAA" || this->type == "BEC"))
         headers[p].push_back(std::make_pair("Dump channels path", this->dump_channels_path));
+    if (!this->cache_path.empty() && (this->type == "GA" || this->type == "GAA"))
+        headers[p].push_back(std::make_pair("Cache path", this->cache_path));
 }
 
 tools::Frozenbits_generator*
 Frozenbits_generator_MK ::build(const tools::Polar_code& pc) const
 {
+    tools::Frozenbits_generator* fbg = nullptr;
+
     if (this->type == "GAA" && pc.is_mono_kernel() == 2)
-        return new tools::Frozenbits_generator_GA_Arikan(this->K, this->N_cw, this->dump_channels_path);
-    if (this->type == "GA")
-        return new tools::Frozenbits_generator_GA(this->K, this->N_cw, pc, this->dump_channels_path);
-    if (this->type == "FILE") return new tools::Frozenbits_generator_file(this->K, this->N_cw, this->path_fb);
+        fbg = new tools::Frozenbits_generator_GA_Arikan(this->K, this->N_cw, this->dump_channels_path);
+    else if (this->type == "GA")
+        fbg = new tools::Frozenbits_generator_GA(this->K, this->N_cw, pc, this->dump_channels_path);
+    else if (this->type == "FILE")
+        fbg = new tools::Frozenbits_generator_file(this->K, this->N_cw, this->path_fb);
+
+    if (fbg == nullptr) throw spu::tools::cannot_allocate(__FILE__, __LINE__, __func__);
 
-    throw spu::tools::cannot_allocate(__FILE__, __LINE__, __func__);
+    fbg->set_cache_path(this->cache_path);
+    return fbg;
 }
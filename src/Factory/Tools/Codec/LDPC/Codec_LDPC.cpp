@@ -84,6 +84,9 @@ Codec_LDPC ::store(const cli::Argument_map_value& vals)
 
     if (enc->type == "LDPC_H") enc_ldpc->H_path = dec_ldpc->H_path;
 
+    // the decoder skips the info bits zero padded by the encoder
+    if (dec_ldpc->dec_granularity == 0) dec_ldpc->dec_granularity = enc->dec_granularity;
+
     // if (dec->K == 0 || dec->N_cw == 0 || enc->K == 0 || enc->N_cw == 0)
     // {
     // 	std::stringstream message;
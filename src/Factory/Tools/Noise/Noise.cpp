@@ -55,6 +55,15 @@ Noise ::get_description(cli::Argument_map_info& args) const
     args.add_link({ p + "-pdf-path" }, { p + "-noise-max", "M" });
 
     tools::add_arg(args, p, class_name + "p+noise-type,E", cli::Text(cli::Including_set("ESN0", "EBN0", "ROP", "EP")));
+
+    tools::add_arg(
+      args, p, class_name + "p+noise-adapt-fer", cli::Real(cli::Positive(), cli::Non_zero()), cli::arg_rank::ADV);
+
+    tools::add_arg(
+      args, p, class_name + "p+noise-adapt-step", cli::Real(cli::Positive(), cli::Non_zero()), cli::arg_rank::ADV);
+
+    tools::add_arg(
+      args, p, class_name + "p+noise-adapt-dec", cli::Real(cli::Positive(), cli::Non_zero()), cli::arg_rank::ADV);
 }
 
 void
@@ -123,6 +132,9 @@ Noise ::store(const cli::Argument_map_value& vals)
     }
 
     if (vals.exist({ p + "-noise-type", "E" })) this->type = vals.at({ p + "-noise-type", "E" });
+    if (vals.exist({ p + "-noise-adapt-fer" })) this->adapt_fer = vals.to_float({ p + "-noise-adapt-fer" });
+    if (vals.exist({ p + "-noise-adapt-step" })) this->adapt_step = vals.to_float({ p + "-noise-adapt-step" });
+    if (vals.exist({ p + "-noise-adapt-dec" })) this->adapt_dec = vals.to_float({ p + "-noise-adapt-dec" });
 }
 
 void
@@ -140,6 +152,17 @@ Noise ::get_headers(std::map<std::string, tools::header_list>& headers, const bo
     headers[p].push_back(std::make_pair("Noise type (E)", this->type));
 
     if (!this->pdf_path.empty()) headers[p].push_back(std::make_pair("PDF path", this->pdf_path));
+
+    if (this->adapt_fer > 0.f)
+    {
+        std::stringstream fer_str, step_str, dec_str;
+        fer_str << this->adapt_fer;
+        step_str << this->adapt_step << " dB";
+        dec_str << this->adapt_dec;
+        headers[p].push_back(std::make_pair("Adaptive sweep target FER", fer_str.str()));
+        headers[p].push_back(std::make_pair("Adaptive sweep min. step", step_str.str()));
+        headers[p].push_back(std::make_pair("Adaptive sweep max. decades", dec_str.str()));
+    }
 }
 
 template<typename R>
@@ -65,6 +65,7 @@ BFER_ite<B, R, Q>::get_description_args()
     this->args.erase({ pchn + "-seed", "S" });
     this->args.erase({ pchn + "-add-users" });
     this->args.erase({ pchn + "-complex" });
+    this->args.erase({ pchn + "-is-scale" });
     this->args.erase({ pqnt + "-size", "N" });
     this->args.erase({ pqnt + "-fra", "F" });
     this->args.erase({ pmnt + "-info-bits", "K" });
@@ -120,6 +121,7 @@ BFER_ite<B, R, Q>::store_args()
     if (std::is_integral<Q>()) params.qnt->store(this->arg_vals);
 
     params.mnt_er->K = params.coded_monitoring ? N_cw : params.src->K;
+    params.mnt_er->dec_granularity = params.coded_monitoring ? 0 : params.src->dec_granularity;
 
     params.mnt_er->store(this->arg_vals);
 
@@ -124,6 +124,7 @@ BFER_std<B, R, Q>::store_args()
     if (std::is_integral<Q>()) params.qnt->store(this->arg_vals);
 
     params.mnt_er->K = params.coded_monitoring ? N_cw : params.src->K;
+    params.mnt_er->dec_granularity = params.coded_monitoring ? 0 : params.src->dec_granularity;
     params.mnt_mi->N = N;
 
     params.mnt_er->store(this->arg_vals);
@@ -181,6 +182,15 @@ BFER_std<B, R, Q>::store_args()
         params.chn->path = params.err_track_path + std::string("_$snr.chn");
     }
 
+    // the importance sampling is only implemented in the AWGN channel without the users addition, and the weighted
+    // estimates are not saved in the checkpoints
+    if (params.chn->type != "AWGN" || params.chn->add_users) params.chn->is_scale = 1.f;
+    if (params.chn->is_scale != 1.f)
+    {
+        params.chkpt_enable = false;
+        params.chkpt_resume = false;
+    }
+
     params.cdc->enc->seed = params.local_seed;
 
     if (!this->arg_vals.exist({ psim + "-inter-fra", "F" }) && params.mdm->type == "SCMA") params.n_frames = 6;
@@ -195,6 +205,9 @@ BFER_std<B, R, Q>::store_args()
     auto pter = params.ter->get_prefix();
     auto pmnt = params.mnt_er->get_prefix();
     if (!this->arg_vals.exist({ pmnt + "-red-lazy-freq" })) params.mnt_red_lazy_freq = params.ter->frequency;
+
+    // in a pipeline only the threads of the last stage check the frames, the other stages stop on the atomic counters
+    if (!params.pl_threads.empty()) params.mnt_red_atomic = true;
 #endif
 }
 
@@ -0,0 +1,412 @@
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <streampu.hpp>
+
+#include "Module/CRC/Polynomial/CRC_polynomial_clmul.hpp"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CRC_CLMUL_X86
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+static uint64_t
+reflect_64(uint64_t v)
+{
+    uint64_t r = 0;
+    for (auto i = 0; i < 64; i++)
+    {
+        r = (r << 1) | (v & 1);
+        v >>= 1;
+    }
+    return r;
+}
+
+// reflected 'x^n mod P' where 'P' is a polynomial of degree 64 ('poly' is 'P' without its MSB)
+static uint64_t
+x_pow_mod(int n, const uint64_t poly)
+{
+    uint64_t r = 1;
+    while (n--)
+        r = (r << 1) ^ ((r >> 63) ? poly : (uint64_t)0);
+    return reflect_64(r);
+}
+
+static bool
+cpu_has_clmul()
+{
+#ifdef CRC_CLMUL_X86
+    unsigned eax, ebx, ecx, edx;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return (ecx & (1u << 1)) != 0; // PCLMULQDQ bit
+#endif
+    return false;
+}
+
+#ifdef CRC_CLMUL_X86
+// the 128-bit block 'x' is made of two reflected 64-bit polynomials: 'x.lo' of higher degree and 'x.hi', they are
+// multiplied by 'k.lo' and 'k.hi' to move them a given number of bits forward
+__attribute__((target("pclmul,sse2"))) static inline __m128i
+fold(const __m128i x, const __m128i k)
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+// fold all the blocks of 16 bytes of 'data' in the last one ('out'), returns the number of bytes consumed
+__attribute__((target("pclmul,sse2"))) static size_t
+fold_blocks(const uint8_t* data, const size_t n_bytes, const uint64_t* k_128, const uint64_t* k_512, uint8_t* out)
+{
+    const auto r_k_128 = _mm_set_epi64x((long long)k_128[1], (long long)k_128[0]);
+    const auto r_k_512 = _mm_set_epi64x((long long)k_512[1], (long long)k_512[0]);
+    const auto blocks = (const __m128i*)data;
+    const auto n_blocks = n_bytes / 16;
+
+    size_t b;
+    __m128i x;
+    if (n_blocks >= 8)
+    {
+        // 4 independent accumulators to hide the latency of the multiplications
+        auto a0 = _mm_loadu_si128(blocks + 0);
+        auto a1 = _mm_loadu_si128(blocks + 1);
+        auto a2 = _mm_loadu_si128(blocks + 2);
+        auto a3 = _mm_loadu_si128(blocks + 3);
+        for (b = 4; b + 4 <= n_blocks; b += 4)
+        {
+            a0 = _mm_xor_si128(fold(a0, r_k_512), _mm_loadu_si128(blocks + b + 0));
+            a1 = _mm_xor_si128(fold(a1, r_k_512), _mm_loadu_si128(blocks + b + 1));
+            a2 = _mm_xor_si128(fold(a2, r_k_512), _mm_loadu_si128(blocks + b + 2));
+            a3 = _mm_xor_si128(fold(a3, r_k_512), _mm_loadu_si128(blocks + b + 3));
+        }
+        x = _mm_xor_si128(fold(a0, r_k_128), a1);
+        x = _mm_xor_si128(fold(x, r_k_128), a2);
+        x = _mm_xor_si128(fold(x, r_k_128), a3);
+    }
+    else
+    {
+        x = _mm_loadu_si128(blocks);
+        b = 1;
+    }
+
+    for (; b < n_blocks; b++)
+        x = _mm_xor_si128(fold(x, r_k_128), _mm_loadu_si128(blocks + b));
+
+    _mm_storeu_si128((__m128i*)out, x);
+    return n_blocks * 16;
+}
+
+// fold all the blocks of 16 bytes of 4 frames ('stride' bytes apart) in their last block ('out'), the 4 chains of
+// multiplications are independent, returns the number of bytes consumed in each frame
+__attribute__((target("pclmul,sse2"))) static size_t
+fold_blocks_x4(const uint8_t* data, const size_t stride, const size_t n_bytes, const uint64_t* k_128, uint8_t* out)
+{
+    const auto r_k_128 = _mm_set_epi64x((long long)k_128[1], (long long)k_128[0]);
+    const auto n_folded = (n_bytes / 16) * 16;
+
+    auto x0 = _mm_loadu_si128((const __m128i*)(data + 0 * stride));
+    auto x1 = _mm_loadu_si128((const __m128i*)(data + 1 * stride));
+    auto x2 = _mm_loadu_si128((const __m128i*)(data + 2 * stride));
+    auto x3 = _mm_loadu_si128((const __m128i*)(data + 3 * stride));
+    for (size_t b = 16; b < n_folded; b += 16)
+    {
+        x0 = _mm_xor_si128(fold(x0, r_k_128), _mm_loadu_si128((const __m128i*)(data + 0 * stride + b)));
+        x1 = _mm_xor_si128(fold(x1, r_k_128), _mm_loadu_si128((const __m128i*)(data + 1 * stride + b)));
+        x2 = _mm_xor_si128(fold(x2, r_k_128), _mm_loadu_si128((const __m128i*)(data + 2 * stride + b)));
+        x3 = _mm_xor_si128(fold(x3, r_k_128), _mm_loadu_si128((const __m128i*)(data + 3 * stride + b)));
+    }
+
+    _mm_storeu_si128((__m128i*)(out + 0 * 16), x0);
+    _mm_storeu_si128((__m128i*)(out + 1 * 16), x1);
+    _mm_storeu_si128((__m128i*)(out + 2 * 16), x2);
+    _mm_storeu_si128((__m128i*)(out + 3 * 16), x3);
+    return n_folded;
+}
+
+// packs 16 bits (one bit per element, any non zero element is a 1) from the masks of the comparisons to zero
+template<typename B>
+__attribute__((target("sse2"))) static inline uint16_t
+pack_16_bits(const B* in)
+{
+    const auto zero = _mm_setzero_si128();
+    const auto v = (const __m128i*)in;
+    __m128i is_zero;
+    if (sizeof(B) == 1)
+        is_zero = _mm_cmpeq_epi8(_mm_loadu_si128(v), zero);
+    else if (sizeof(B) == 2)
+        is_zero = _mm_packs_epi16(_mm_cmpeq_epi16(_mm_loadu_si128(v + 0), zero),
+                                  _mm_cmpeq_epi16(_mm_loadu_si128(v + 1), zero));
+    else
+        is_zero = _mm_packs_epi16(_mm_packs_epi32(_mm_cmpeq_epi32(_mm_loadu_si128(v + 0), zero),
+                                                  _mm_cmpeq_epi32(_mm_loadu_si128(v + 1), zero)),
+                                  _mm_packs_epi32(_mm_cmpeq_epi32(_mm_loadu_si128(v + 2), zero),
+                                                  _mm_cmpeq_epi32(_mm_loadu_si128(v + 3), zero)));
+    return (uint16_t)~_mm_movemask_epi8(is_zero);
+}
+#endif
+
+// packs 'n_bits' bits in bytes like 'spu::tools::Bit_packer::pack' (the first bit is the LSB of the first byte)
+template<typename B>
+static void
+pack_bits(const B* in, uint8_t* out, const int n_bits)
+{
+    auto i = 0;
+#ifdef CRC_CLMUL_X86
+    if (sizeof(B) <= 4)
+        for (; i + 16 <= n_bits; i += 16)
+        {
+            const auto bits = pack_16_bits(in + i);
+            out[(i >> 3) + 0] = (uint8_t)(bits >> 0);
+            out[(i >> 3) + 1] = (uint8_t)(bits >> 8);
+        }
+#endif
+    for (; i < n_bits; i += 8)
+    {
+        uint8_t byte = 0;
+        for (auto j = 0; j < 8 && i + j < n_bits; j++)
+            byte |= (uint8_t)((in[i + j] != 0) << j);
+        out[i >> 3] = byte;
+    }
+}
+
+template<typename B>
+CRC_polynomial_clmul<B>::CRC_polynomial_clmul(const int K, const std::string& poly_key, const int size)
+  : CRC_polynomial<B>(K, poly_key, size)
+  , polynomial_packed_rev(0)
+  , lut_crc64(16 * 256)
+  , use_clmul(cpu_has_clmul())
+{
+    const std::string name = "CRC_polynomial_clmul";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    if (this->size > 64)
+    {
+        std::stringstream message;
+        message << "'size' has to be equal or smaller than 64 ('size' = " << this->size << ").";
+        throw spu::tools::length_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+#if __BYTE_ORDER != __LITTLE_ENDIAN
+    throw spu::tools::runtime_error(
+      __FILE__, __LINE__, __func__, "The code of the CLMUL CRC works only on little endian CPUs.");
+#endif
+
+    // the polynomial of degree 'size' is multiplied by x^(64 - size) to work on a 64-bit register
+    const auto poly_mask = this->size == 64 ? ~(uint64_t)0 : (((uint64_t)1 << this->size) - 1);
+    const auto poly_64 = (this->polynomial_packed & poly_mask) << (64 - this->size);
+    this->polynomial_packed_rev = reflect_64(poly_64);
+
+    for (auto i = 0; i < 256; i++)
+    {
+        uint64_t crc = i;
+        for (auto j = 0; j < 8; j++)
+            crc = (crc >> 1) ^ ((crc & 1) ? this->polynomial_packed_rev : (uint64_t)0);
+        this->lut_crc64[i] = crc;
+    }
+    for (auto j = 1; j < 16; j++)
+        for (auto i = 0; i < 256; i++)
+        {
+            const auto prev = this->lut_crc64[(j - 1) * 256 + i];
+            this->lut_crc64[j * 256 + i] = (prev >> 8) ^ this->lut_crc64[prev & 0xFF];
+        }
+
+    // folding a block over 'd' bits: the high degree part is multiplied by x^(d + 64) and the low degree part by x^d,
+    // minus one degree because the product of two reflected 64-bit polynomials is shifted by one bit
+    this->fold_128[0] = x_pow_mod(128 + 64 - 1, poly_64);
+    this->fold_128[1] = x_pow_mod(128 - 1, poly_64);
+    this->fold_512[0] = x_pow_mod(512 + 64 - 1, poly_64);
+    this->fold_512[1] = x_pow_mod(512 - 1, poly_64);
+}
+
+template<typename B>
+CRC_polynomial_clmul<B>*
+CRC_polynomial_clmul<B>::clone() const
+{
+    auto m = new CRC_polynomial_clmul(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B>
+bool
+CRC_polynomial_clmul<B>::is_clmul() const
+{
+    return this->use_clmul;
+}
+
+template<typename B>
+void
+CRC_polynomial_clmul<B>::_build(const B* U_K1, B* U_K2, const size_t frame_id)
+{
+    const auto data = (uint8_t*)this->buff_crc.data();
+    spu::tools::Bit_packer::pack(U_K1, data, this->K);
+
+    const auto crc = this->compute_crc(data, this->K);
+
+    std::copy(U_K1, U_K1 + this->K, U_K2);
+    for (auto i = 0; i < this->size; i++)
+        U_K2[this->K + i] = (B)((crc >> i) & 1);
+}
+
+template<typename B>
+bool
+CRC_polynomial_clmul<B>::_check(const B* V_K, const size_t frame_id)
+{
+    const auto data = (uint8_t*)this->buff_crc.data();
+    spu::tools::Bit_packer::pack(V_K, data, this->K);
+
+    const auto crc = this->compute_crc(data, this->K);
+
+    return this->check_crc_bits(V_K, crc);
+}
+
+template<typename B>
+bool
+CRC_polynomial_clmul<B>::_check_packed(const B* V_K, const size_t frame_id)
+{
+    const auto data = (const uint8_t*)V_K;
+    const auto crc = this->compute_crc(data, this->K);
+
+    uint64_t crc_ref = 0;
+    for (auto i = 0; i < this->size; i++)
+    {
+        const auto pos = this->K + i;
+        crc_ref |= (uint64_t)((data[pos >> 3] >> (pos & 7)) & 1) << i;
+    }
+
+    return crc == crc_ref;
+}
+
+template<typename B>
+size_t
+CRC_polynomial_clmul<B>::check_frames(const B* V_K, const size_t n_frames, bool* is_valid)
+{
+    const auto n_bytes = (size_t)(this->K / 8);
+    const auto stride = (size_t)((this->K + 7) / 8);
+    if (this->buff_frames.size() < n_frames * stride) this->buff_frames.resize(n_frames * stride);
+
+    // the information bits of all the frames are packed in one pass, 16 bits per comparison on x86
+    const auto data = this->buff_frames.data();
+    for (size_t f = 0; f < n_frames; f++)
+        pack_bits(V_K + f * (this->K + this->size), data + f * stride, this->K);
+
+    size_t f = 0;
+#ifdef CRC_CLMUL_X86
+    if (this->use_clmul && n_bytes >= 32)
+        for (; f + 4 <= n_frames; f += 4)
+        {
+            uint8_t folded[4 * 16];
+            const auto n_folded = fold_blocks_x4(data + f * stride, stride, n_bytes, this->fold_128, folded);
+            for (size_t i = 0; i < 4; i++)
+            {
+                auto crc = this->compute_crc_lut(folded + i * 16, 16, 0);
+                crc = this->compute_crc_end(data + (f + i) * stride, this->K, n_folded, crc);
+                is_valid[f + i] = this->check_crc_bits(V_K + (f + i) * (this->K + this->size), crc);
+            }
+        }
+#endif
+    for (; f < n_frames; f++)
+    {
+        const auto crc = this->compute_crc(data + f * stride, this->K);
+        is_valid[f] = this->check_crc_bits(V_K + f * (this->K + this->size), crc);
+    }
+
+    return (size_t)std::count(is_valid, is_valid + n_frames, true);
+}
+
+template<typename B>
+bool
+CRC_polynomial_clmul<B>::check_crc_bits(const B* V_K, const uint64_t crc) const
+{
+    for (auto i = 0; i < this->size; i++)
+        if ((B)((crc >> i) & 1) != (B)(V_K[this->K + i] != 0)) return false;
+
+    return true;
+}
+
+template<typename B>
+uint64_t
+CRC_polynomial_clmul<B>::compute_crc(const uint8_t* data, const int n_bits) const
+{
+    uint64_t crc = 0;
+    size_t n_folded = 0;
+#ifdef CRC_CLMUL_X86
+    const auto n_bytes = (size_t)(n_bits / 8);
+    if (this->use_clmul && n_bytes >= 64)
+    {
+        uint8_t folded[16];
+        n_folded = fold_blocks(data, n_bytes, this->fold_128, this->fold_512, folded);
+        crc = this->compute_crc_lut(folded, 16, crc);
+    }
+#endif
+
+    return this->compute_crc_end(data, n_bits, n_folded, crc);
+}
+
+// the bytes after the first 'n_done' ones and the last bits of 'data' are added to 'crc'
+template<typename B>
+uint64_t
+CRC_polynomial_clmul<B>::compute_crc_end(const uint8_t* data,
+                                         const int n_bits,
+                                         const size_t n_done,
+                                         uint64_t crc) const
+{
+    const auto n_bytes = (size_t)(n_bits / 8);
+    crc = this->compute_crc_lut(data + n_done, n_bytes - n_done, crc);
+
+    const auto rest = n_bits % 8;
+    if (rest != 0)
+    {
+        crc ^= (uint64_t)(data[n_bytes] & ((1 << rest) - 1));
+        for (auto j = 0; j < rest; j++)
+            crc = (crc >> 1) ^ ((crc & 1) ? this->polynomial_packed_rev : (uint64_t)0);
+    }
+
+    return crc;
+}
+
+// slicing-by-16: the CRC register is added to the first 8 bytes of a block of 16 bytes, then the contribution of each
+// byte of the block is read from the table of its distance to the end of the block
+template<typename B>
+uint64_t
+CRC_polynomial_clmul<B>::compute_crc_lut(const uint8_t* data, size_t n_bytes, uint64_t crc) const
+{
+    const auto lut = this->lut_crc64.data();
+    while (n_bytes >= 16)
+    {
+        uint64_t a, b;
+        std::memcpy(&a, data + 0, sizeof(a));
+        std::memcpy(&b, data + 8, sizeof(b));
+        a ^= crc;
+        crc = lut[15 * 256 + ((a >> 0) & 0xFF)] ^ lut[14 * 256 + ((a >> 8) & 0xFF)] ^
+              lut[13 * 256 + ((a >> 16) & 0xFF)] ^ lut[12 * 256 + ((a >> 24) & 0xFF)] ^
+              lut[11 * 256 + ((a >> 32) & 0xFF)] ^ lut[10 * 256 + ((a >> 40) & 0xFF)] ^
+              lut[9 * 256 + ((a >> 48) & 0xFF)] ^ lut[8 * 256 + ((a >> 56) & 0xFF)] ^
+              lut[7 * 256 + ((b >> 0) & 0xFF)] ^ lut[6 * 256 + ((b >> 8) & 0xFF)] ^
+              lut[5 * 256 + ((b >> 16) & 0xFF)] ^ lut[4 * 256 + ((b >> 24) & 0xFF)] ^
+              lut[3 * 256 + ((b >> 32) & 0xFF)] ^ lut[2 * 256 + ((b >> 40) & 0xFF)] ^
+              lut[1 * 256 + ((b >> 48) & 0xFF)] ^ lut[0 * 256 + ((b >> 56) & 0xFF)];
+        data += 16;
+        n_bytes -= 16;
+    }
+
+    while (n_bytes--)
+        crc = (crc >> 8) ^ lut[(crc ^ *data++) & 0xFF];
+
+    return crc;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::CRC_polynomial_clmul<B_8>;
+template class aff3ct::module::CRC_polynomial_clmul<B_16>;
+template class aff3ct::module::CRC_polynomial_clmul<B_32>;
+template class aff3ct::module::CRC_polynomial_clmul<B_64>;
+#else
+template class aff3ct::module::CRC_polynomial_clmul<B>;
+#endif
+// ==================================================================================== explicit template instantiation
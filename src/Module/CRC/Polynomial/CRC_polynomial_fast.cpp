@@ -26,12 +26,11 @@ CRC_polynomial_fast<B>::CRC_polynomial_fast(const int K, const std::string& poly
     }
 
     // reverse the order of the bits in the bitpacked polynomial
-    for (auto i = 0; i < (int)sizeof(this->polynomial_packed) * 8; i++)
+    for (auto i = 0; i < this->size; i++)
     {
         polynomial_packed_rev <<= 1;
-        polynomial_packed_rev |= (this->polynomial_packed >> i) & 1;
+        polynomial_packed_rev |= (unsigned)(this->polynomial_packed >> i) & 1;
     }
-    polynomial_packed_rev >>= (sizeof(this->polynomial_packed) * 8) - (this->size);
 
     // precompute a lookup table pour the v3 implem. of the CRC
     for (auto i = 0; i < 256; i++)
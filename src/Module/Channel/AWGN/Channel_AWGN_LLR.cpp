@@ -1,4 +1,7 @@
 #include <algorithm>
+#include <cmath>
+#include <mipp.h>
+#include <sstream>
 #include <streampu.hpp>
 #include <string>
 
@@ -19,9 +22,11 @@ using namespace aff3ct::module;
 template<typename R>
 Channel_AWGN_LLR<R>::Channel_AWGN_LLR(const int N,
                                       const tools::Gaussian_gen<R>& gaussian_generator,
-                                      const bool add_users)
+                                      const bool add_users,
+                                      const float is_scale)
   : Channel<R>(N)
   , add_users(add_users)
+  , is_scale(is_scale)
   , gaussian_generator(gaussian_generator.clone())
 {
     const std::string name = "Channel_AWGN_LLR";
@@ -30,6 +35,13 @@ Channel_AWGN_LLR<R>::Channel_AWGN_LLR(const int N,
         t->set_replicability(true);
 
     if (add_users) this->set_single_wave(true);
+
+    if (is_scale <= 0.f)
+    {
+        std::stringstream message;
+        message << "'is_scale' has to be greater than 0 ('is_scale' = " << is_scale << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
 }
 
 template<typename R>
@@ -65,9 +77,11 @@ template<typename R>
 Channel_AWGN_LLR<R>::Channel_AWGN_LLR(const int N,
                                       const tools::Gaussian_noise_generator_implem implem,
                                       const int seed,
-                                      const bool add_users)
+                                      const bool add_users,
+                                      const float is_scale)
   : Channel<R>(N)
   , add_users(add_users)
+  , is_scale(is_scale)
   , gaussian_generator(create_gaussian_generator<R>(implem, seed))
 {
     const std::string name = "Channel_AWGN_LLR";
@@ -76,6 +90,13 @@ Channel_AWGN_LLR<R>::Channel_AWGN_LLR(const int N,
         t->set_replicability(true);
 
     if (add_users) this->set_single_wave(true);
+
+    if (is_scale <= 0.f)
+    {
+        std::stringstream message;
+        message << "'is_scale' has to be greater than 0 ('is_scale' = " << is_scale << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
 }
 
 template<typename R>
@@ -102,6 +123,13 @@ Channel_AWGN_LLR<R>::set_seed(const int seed)
     this->gaussian_generator->set_seed(seed);
 }
 
+template<typename R>
+float
+Channel_AWGN_LLR<R>::get_is_scale() const
+{
+    return this->is_scale;
+}
+
 template<typename R>
 void
 Channel_AWGN_LLR<R>::_add_noise(const float* CP, const R* X_N, R* Y_N, const size_t frame_id)
@@ -119,12 +147,77 @@ Channel_AWGN_LLR<R>::_add_noise(const float* CP, const R* X_N, R* Y_N, const siz
             Y_N[i] += this->noised_data[i];
     }
     else // n_frames_per_wave = 1
-    {
-        gaussian_generator->generate(this->noised_data.data() + frame_id * this->N, this->N, (R)*CP);
+        this->add_gaussian_noise((R)*CP, X_N, Y_N, frame_id);
+}
 
-        for (auto n = 0; n < this->N; n++)
-            Y_N[n] = X_N[n] + this->noised_data[frame_id * this->N + n];
+template<typename R>
+void
+Channel_AWGN_LLR<R>::_add_noise_is(const float* CP, const R* X_N, R* Y_N, double* W, const size_t frame_id)
+{
+    if (add_users && this->n_frames > 1)
+    {
+        std::stringstream message;
+        message << "The importance sampling is not supported when the users are added ('add_users' = true).";
+        throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__, message.str());
     }
+
+    const auto sigma = (double)*CP;
+    const auto scale = (double)this->is_scale;
+    this->add_gaussian_noise((R)(sigma * scale), X_N, Y_N, frame_id);
+
+    // likelihood ratio of the drawn noise: product over the noisy symbols of the Gaussian densities of standard
+    // deviations 'sigma' (real channel) and 'scale * sigma' (biased channel)
+    const auto noise = this->noised_data.data() + frame_id * this->N;
+    auto energy = 0.;
+    for (auto i = 0; i < this->N; i++) // the noise of the zero padded symbols is 0
+        energy += (double)noise[i] * (double)noise[i];
+    const auto n_noisy = this->N - (this->get_padding_end() - this->get_padding_begin());
+
+    W[0] = std::exp((double)n_noisy * std::log(scale) - energy * (1. - 1. / (scale * scale)) / (2. * sigma * sigma));
+}
+
+template<typename R>
+void
+Channel_AWGN_LLR<R>::add_gaussian_noise(const R sigma, const R* X_N, R* Y_N, const size_t frame_id)
+{
+    // the zero padded symbols are known by the receiver: no noise is drawn for them
+    const auto pad_beg = this->get_padding_begin();
+    const auto pad_end = this->get_padding_end();
+    auto noise = this->noised_data.data() + frame_id * this->N;
+
+    gaussian_generator->generate(noise, (unsigned)pad_beg, sigma);
+    gaussian_generator->generate(noise + pad_end, (unsigned)(this->N - pad_end), sigma);
+    std::fill(noise + pad_beg, noise + pad_end, (R)0);
+
+    const auto add = [&](const int beg, const int end)
+    {
+        const auto vec_loop_size = beg + ((end - beg) / mipp::nElReg<R>()) * mipp::nElReg<R>();
+        for (auto n = beg; n < vec_loop_size; n += mipp::nElReg<R>())
+        {
+            const mipp::Reg<R> r_x = X_N + n;
+            const mipp::Reg<R> r_noise = noise + n;
+            (r_x + r_noise).store(Y_N + n);
+        }
+
+        // the tail is processed in a full register through zero padded scratch buffers
+        if (vec_loop_size < end)
+        {
+            R X_tail[mipp::N<R>()] = {};
+            R noise_tail[mipp::N<R>()] = {};
+            R Y_tail[mipp::N<R>()];
+
+            std::copy(X_N + vec_loop_size, X_N + end, X_tail);
+            std::copy(noise + vec_loop_size, noise + end, noise_tail);
+            const mipp::Reg<R> r_x = X_tail;
+            const mipp::Reg<R> r_noise = noise_tail;
+            (r_x + r_noise).store(Y_tail);
+            std::copy(Y_tail, Y_tail + (end - vec_loop_size), Y_N + vec_loop_size);
+        }
+    };
+
+    add(0, pad_beg);
+    std::copy(X_N + pad_beg, X_N + pad_end, Y_N + pad_beg);
+    add(pad_end, this->N);
 }
 
 // ==================================================================================== explicit template instantiation
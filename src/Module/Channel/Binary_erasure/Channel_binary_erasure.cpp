@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <mipp.h>
 #include <streampu.hpp>
 #include <string>
 #include <type_traits>
@@ -101,24 +102,49 @@ Channel_binary_erasure<R>::_add_noise(const float* CP, const R* X_N, R* Y_N, con
 {
     auto event_draw = (E*)(this->noised_data.data() + this->N * frame_id);
 
+    // the zero padded bits are known by the receiver: no event is drawn for them
+    const auto pad_beg = this->get_padding_begin();
+    const auto pad_end = this->get_padding_end();
+
     const auto event_probability = (R)*CP;
-    event_generator->generate(event_draw, (unsigned)this->N, event_probability);
+    event_generator->generate(event_draw, (unsigned)pad_beg, event_probability);
+    event_generator->generate(event_draw + pad_end, (unsigned)(this->N - pad_end), event_probability);
+    std::fill(event_draw + pad_beg, event_draw + pad_end, (E) false);
 
     const mipp::Reg<R> r_erased = tools::unknown_symbol_val<R>();
     const mipp::Reg<E> r_false = (E) false;
 
-    const auto vec_loop_size = (this->N / mipp::nElReg<R>()) * mipp::nElReg<R>();
-
-    for (auto i = 0; i < vec_loop_size; i += mipp::nElReg<R>())
+    const auto erase_reg = [&](const R* X, const E* event, R* Y)
     {
-        const mipp::Reg<R> r_in = X_N + i;
-        const mipp::Reg<E> r_event = event_draw + i;
+        const mipp::Reg<R> r_in = X;
+        const mipp::Reg<E> r_event = event;
         const auto r_out = mipp::blend(r_in, r_erased, r_event == r_false);
-        r_out.store(Y_N + i);
-    }
+        r_out.store(Y);
+    };
+
+    const auto erase = [&](const int beg, const int end)
+    {
+        const auto vec_loop_size = beg + ((end - beg) / mipp::nElReg<R>()) * mipp::nElReg<R>();
+        for (auto i = beg; i < vec_loop_size; i += mipp::nElReg<R>())
+            erase_reg(X_N + i, event_draw + i, Y_N + i);
+
+        // the tail is processed in a full register through zero padded scratch buffers
+        if (vec_loop_size < end)
+        {
+            R X_tail[mipp::N<R>()] = {};
+            E E_tail[mipp::N<R>()] = {};
+            R Y_tail[mipp::N<R>()];
+
+            std::copy(X_N + vec_loop_size, X_N + end, X_tail);
+            std::copy(event_draw + vec_loop_size, event_draw + end, E_tail);
+            erase_reg(X_tail, E_tail, Y_tail);
+            std::copy(Y_tail, Y_tail + (end - vec_loop_size), Y_N + vec_loop_size);
+        }
+    };
 
-    for (auto i = vec_loop_size; i < this->N; i++)
-        Y_N[i] = event_draw[i] ? tools::unknown_symbol_val<R>() : X_N[i];
+    erase(0, pad_beg);
+    std::copy(X_N + pad_beg, X_N + pad_end, Y_N + pad_beg);
+    erase(pad_end, this->N);
 }
 
 // ==================================================================================== explicit template instantiation
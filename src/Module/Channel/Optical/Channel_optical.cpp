@@ -100,7 +100,13 @@ template<typename R>
 void
 Channel_optical<R>::_add_noise(const float* CP, const R* X_N, R* Y_N, const size_t frame_id)
 {
-    pdf_noise_generator->generate(X_N, Y_N, this->N, (R)*CP);
+    // the zero padded symbols are known by the receiver: no noise is drawn for them
+    const auto pad_beg = this->get_padding_begin();
+    const auto pad_end = this->get_padding_end();
+
+    pdf_noise_generator->generate(X_N, Y_N, pad_beg, (R)*CP);
+    std::copy(X_N + pad_beg, X_N + pad_end, Y_N + pad_beg);
+    pdf_noise_generator->generate(X_N + pad_end, Y_N + pad_end, this->N - pad_end, (R)*CP);
 }
 
 // ==================================================================================== explicit template instantiation
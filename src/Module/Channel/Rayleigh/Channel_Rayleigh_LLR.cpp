@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <cmath>
+#include <mipp.h>
 #include <sstream>
 #include <streampu.hpp>
 #include <string>
@@ -169,18 +170,21 @@ Channel_Rayleigh_LLR<R>::_add_noise_wg(const float* CP, const R* X_N, R* H_N, R*
     else // n_frames_per_wave = 1
     {
         const auto gains_size = this->complex ? this->N : 2 * this->N;
-        gaussian_generator->generate(this->gains.data() + frame_id * this->N, gains_size, (R)1 / (R)std::sqrt((R)2));
-        gaussian_generator->generate(this->noised_data.data() + frame_id * this->N, this->N, (R)*CP);
+        auto gains = this->gains.data() + frame_id * gains_size;
+        auto noise = this->noised_data.data() + frame_id * this->N;
 
         if (this->complex)
         {
+            gaussian_generator->generate(gains, gains_size, (R)1 / (R)std::sqrt((R)2));
+            gaussian_generator->generate(noise, this->N, (R)*CP);
+
             for (auto n = 0; n < this->N; n += 2)
             {
-                const auto h_re = H_N[n] = this->gains[frame_id * this->N + n];
-                const auto h_im = H_N[n + 1] = this->gains[frame_id * this->N + n + 1];
+                const auto h_re = H_N[n] = gains[n];
+                const auto h_im = H_N[n + 1] = gains[n + 1];
 
-                const auto n_re = this->noised_data[frame_id * this->N + n];
-                const auto n_im = this->noised_data[frame_id * this->N + n + 1];
+                const auto n_re = noise[n];
+                const auto n_im = noise[n + 1];
 
                 Y_N[n] = (X_N[n] * h_re - X_N[n + 1] * h_im) + n_re;
                 Y_N[n + 1] = (X_N[n + 1] * h_re + X_N[n] * h_im) + n_im;
@@ -188,14 +192,56 @@ Channel_Rayleigh_LLR<R>::_add_noise_wg(const float* CP, const R* X_N, R* H_N, R*
         }
         else
         {
-            for (auto n = 0; n < this->N; n++)
+            // the zero padded symbols are known by the receiver: no gain and no noise are drawn for them
+            const auto pad_beg = this->get_padding_begin();
+            const auto pad_end = this->get_padding_end();
+
+            gaussian_generator->generate(gains, 2 * pad_beg, (R)1 / (R)std::sqrt((R)2));
+            gaussian_generator->generate(gains + 2 * pad_end, gains_size - 2 * pad_end, (R)1 / (R)std::sqrt((R)2));
+            gaussian_generator->generate(noise, pad_beg, (R)*CP);
+            gaussian_generator->generate(noise + pad_end, this->N - pad_end, (R)*CP);
+            std::fill(gains + 2 * pad_beg, gains + 2 * pad_end, (R)0);
+            std::fill(noise + pad_beg, noise + pad_end, (R)0);
+
+            const auto fade_reg = [&](const R* G, const R* X, const R* Z, R* H, R* Y)
             {
-                const auto h_re = this->gains[frame_id * this->N + 2 * n];
-                const auto h_im = this->gains[frame_id * this->N + 2 * n + 1];
+                // the gains are interleaved: the real parts go in 'val[0]' and the imaginary parts in 'val[1]'
+                const auto r_g = mipp::deinterleave(mipp::Reg<R>(G), mipp::Reg<R>(G + mipp::nElReg<R>()));
+                const auto r_h = mipp::sqrt(r_g.val[0] * r_g.val[0] + r_g.val[1] * r_g.val[1]);
+                const mipp::Reg<R> r_x = X;
+                const mipp::Reg<R> r_noise = Z;
+                r_h.store(H);
+                (r_x * r_h + r_noise).store(Y);
+            };
 
-                H_N[n] = std::sqrt(h_re * h_re + h_im * h_im);
-                Y_N[n] = X_N[n] * H_N[n] + this->noised_data[frame_id * this->N + n];
-            }
+            const auto fade = [&](const int beg, const int end)
+            {
+                const auto vec_loop_size = beg + ((end - beg) / mipp::nElReg<R>()) * mipp::nElReg<R>();
+                for (auto n = beg; n < vec_loop_size; n += mipp::nElReg<R>())
+                    fade_reg(gains + 2 * n, X_N + n, noise + n, H_N + n, Y_N + n);
+
+                // the tail is processed in a full register through zero padded scratch buffers
+                if (vec_loop_size < end)
+                {
+                    R G_tail[2 * mipp::N<R>()] = {};
+                    R X_tail[mipp::N<R>()] = {};
+                    R noise_tail[mipp::N<R>()] = {};
+                    R H_tail[mipp::N<R>()];
+                    R Y_tail[mipp::N<R>()];
+
+                    std::copy(gains + 2 * vec_loop_size, gains + 2 * end, G_tail);
+                    std::copy(X_N + vec_loop_size, X_N + end, X_tail);
+                    std::copy(noise + vec_loop_size, noise + end, noise_tail);
+                    fade_reg(G_tail, X_tail, noise_tail, H_tail, Y_tail);
+                    std::copy(H_tail, H_tail + (end - vec_loop_size), H_N + vec_loop_size);
+                    std::copy(Y_tail, Y_tail + (end - vec_loop_size), Y_N + vec_loop_size);
+                }
+            };
+
+            fade(0, pad_beg);
+            std::fill(H_N + pad_beg, H_N + pad_end, (R)1);
+            std::copy(X_N + pad_beg, X_N + pad_end, Y_N + pad_beg);
+            fade(pad_end, this->N);
         }
     }
 }
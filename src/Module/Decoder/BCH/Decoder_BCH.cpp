@@ -39,6 +39,13 @@ Decoder_BCH<B, R>::get_last_is_codeword(const int frame_id) const
     return last_is_codeword[frame_id < 0 ? 0 : frame_id];
 }
 
+template<typename B, typename R>
+int
+Decoder_BCH<B, R>::get_t() const
+{
+    return this->t;
+}
+
 template<typename B, typename R>
 void
 Decoder_BCH<B, R>::set_n_frames(const size_t n_frames)
@@ -49,175 +49,223 @@ Decoder_BCH_std<B, R>::clone() const
     return m;
 }
 
+template<typename B, typename R>
+void
+Decoder_BCH_std<B, R>::compute_syndromes(const B* Y_N, int* syndromes) const
+{
+    for (auto i = 1; i <= t2; i++)
+    {
+        syndromes[i] = 0;
+        for (auto j = 0; j < this->N; j++)
+            if (Y_N[j] != 0) syndromes[i] ^= alpha_to[(i * j) % this->N_p2_1];
+    }
+}
+
+template<typename B, typename R>
+void
+Decoder_BCH_std<B, R>::flip_syndromes(const int pos, int* syndromes) const
+{
+    for (auto i = 1; i <= t2; i++)
+        syndromes[i] ^= alpha_to[(i * pos) % this->N_p2_1];
+}
+
 template<typename B, typename R>
 int
-Decoder_BCH_std<B, R>::_decode(B* Y_N, const size_t frame_id)
+Decoder_BCH_std<B, R>::decode_syndromes(const int* syndromes, int* err_pos)
 {
-    int i, j, syn_error = 0;
+    auto syn_error = false;
+    for (auto i = 1; i <= t2; i++)
+    {
+        if (syndromes[i] != 0) syn_error = true;
+        s[i] = (int)index_of[syndromes[i]];
+    }
 
-    /* first form the syndromes */
-    for (i = 1; i <= t2; i++)
+    if (!syn_error) return 0;
+
+    const auto n_roots = this->_decode_syndromes();
+    if (n_roots < 0) return -1;
+
+    auto n_errors = 0;
+    for (auto i = 0; i < n_roots; i++)
+        if (loc[i] < this->N) err_pos[n_errors++] = loc[i];
+
+    return n_errors;
+}
+
+template<typename B, typename R>
+int
+Decoder_BCH_std<B, R>::_decode_syndromes()
+{
+    int i, j;
+
+    /*
+     * Compute the error location polynomial via the Berlekamp
+     * iterative algorithm. Following the terminology of Lin and
+     * Costello's book :   d[u] is the 'mu'th discrepancy, where
+     * u='mu'+1 and 'mu' (the Greek letter!) is the step number
+     * ranging from -1 to 2*this->t (see L&C),  l[u] is the degree of
+     * the elp at that step, and u_l[u] is the difference between
+     * the step number and the degree of the elp.
+     */
+    /* initialise table entries */
+    discrepancy[0] = 0;    /* index form */
+    discrepancy[1] = s[1]; /* index form */
+    elp[0][0] = 0;         /* index form */
+    elp[1][0] = 1;         /* polynomial form */
+    for (i = 1; i < t2; i++)
     {
-        s[i] = 0;
-        for (j = 0; j < this->N; j++)
-            if (Y_N[j] != 0) s[i] ^= alpha_to[(i * j) % this->N_p2_1];
-        if (s[i] != 0) syn_error = 1; /* set error flag if non-zero syndrome */
-        /* convert syndrome from polynomial form to index form  */
-        s[i] = (int)index_of[s[i]];
+        elp[0][i] = -1; /* index form */
+        elp[1][i] = 0;  /* polynomial form */
     }
+    l[0] = 0;
+    l[1] = 0;
+    u_lu[0] = -1;
+    u_lu[1] = 0;
 
-    this->last_is_codeword[frame_id] = !syn_error;
+    int q, u = 0;
+    do
+    {
+        u++;
 
-    if (syn_error)
-    { /* if there are errors, try to correct them */
-        /*
-         * Compute the error location polynomial via the Berlekamp
-         * iterative algorithm. Following the terminology of Lin and
-         * Costello's book :   d[u] is the 'mu'th discrepancy, where
-         * u='mu'+1 and 'mu' (the Greek letter!) is the step number
-         * ranging from -1 to 2*this->t (see L&C),  l[u] is the degree of
-         * the elp at that step, and u_l[u] is the difference between
-         * the step number and the degree of the elp.
-         */
-        /* initialise table entries */
-        discrepancy[0] = 0;    /* index form */
-        discrepancy[1] = s[1]; /* index form */
-        elp[0][0] = 0;         /* index form */
-        elp[1][0] = 1;         /* polynomial form */
-        for (i = 1; i < t2; i++)
+        if (discrepancy[u] == -1)
         {
-            elp[0][i] = -1; /* index form */
-            elp[1][i] = 0;  /* polynomial form */
+            l[u + 1] = l[u];
+            for (i = 0; i <= l[u]; i++)
+            {
+                elp[u + 1][i] = elp[u][i];
+                elp[u][i] = (int)index_of[elp[u][i]];
+            }
         }
-        l[0] = 0;
-        l[1] = 0;
-        u_lu[0] = -1;
-        u_lu[1] = 0;
-
-        int q, u = 0;
-        do
-        {
-            u++;
-
-            if (discrepancy[u] == -1)
+        else
+        { // search for words with greatest u_lu[q] for which d[q]!=0
+            q = u - 1;
+            while ((discrepancy[q] == -1) && (q > 0))
+                q--;
+            /* have found first non-zero d[q]  */
+            if (q > 0)
             {
-                l[u + 1] = l[u];
-                for (i = 0; i <= l[u]; i++)
+                j = q;
+                do
                 {
-                    elp[u + 1][i] = elp[u][i];
-                    elp[u][i] = (int)index_of[elp[u][i]];
-                }
+                    j--;
+                    if ((discrepancy[j] != -1) && (u_lu[q] < u_lu[j])) q = j;
+                } while (j > 0);
+            }
+
+            /*
+             * have now found q such that d[u]!=0 and
+             * u_lu[q] is maximum
+             */
+            /* store degree of new elp polynomial */
+            if (l[u] > l[q] + u - q)
+                l[u + 1] = l[u];
+            else
+                l[u + 1] = l[q] + u - q;
+
+            /* form new elp(x) */
+            for (i = 0; i < t2; i++)
+                elp[u + 1][i] = 0;
+            for (i = 0; i <= l[q]; i++)
+                if (elp[q][i] != -1)
+                    elp[u + 1][i + u - q] =
+                      (int)alpha_to[(discrepancy[u] + this->N_p2_1 - discrepancy[q] + elp[q][i]) % this->N_p2_1];
+            for (i = 0; i <= l[u]; i++)
+            {
+                elp[u + 1][i] ^= elp[u][i];
+                elp[u][i] = (int)index_of[elp[u][i]];
             }
+        }
+        u_lu[u + 1] = u - l[u + 1];
+
+        /* form (u+1)th discrepancy */
+        if (u < t2)
+        {
+            /* no discrepancy computed on last iteration */
+            if (s[u + 1] != -1)
+                discrepancy[u + 1] = (int)alpha_to[s[u + 1]];
             else
-            { // search for words with greatest u_lu[q] for which d[q]!=0
-                q = u - 1;
-                while ((discrepancy[q] == -1) && (q > 0))
-                    q--;
-                /* have found first non-zero d[q]  */
-                if (q > 0)
+                discrepancy[u + 1] = 0;
+
+            for (i = 1; i <= l[u + 1]; i++)
+                if ((s[u + 1 - i] != -1) && (elp[u + 1][i] != 0))
+                    discrepancy[u + 1] ^= alpha_to[(s[u + 1 - i] + index_of[elp[u + 1][i]]) % this->N_p2_1];
+            /* put d[u+1] into index form */
+            discrepancy[u + 1] = (int)index_of[discrepancy[u + 1]];
+        }
+    } while ((u < t2) && (l[u + 1] <= this->t));
+
+    u++;
+    if (l[u] <= this->t)
+    { /* May correct errors */
+        /* put elp into index form */
+        for (i = 0; i <= l[u]; i++)
+            elp[u][i] = (int)index_of[elp[u][i]];
+
+        /* Chien search: find roots of the error location polynomial */
+        for (i = 1; i <= l[u]; i++)
+            reg[i] = elp[u][i];
+
+        int count = 0;
+        for (i = 1; i <= this->N_p2_1; i++)
+        {
+            q = 1;
+            for (j = 1; j <= l[u]; j++)
+                if (reg[j] != -1)
                 {
-                    j = q;
-                    do
-                    {
-                        j--;
-                        if ((discrepancy[j] != -1) && (u_lu[q] < u_lu[j])) q = j;
-                    } while (j > 0);
+                    reg[j] += j;
+                    if (reg[j] >= this->N_p2_1) reg[j] -= this->N_p2_1;
+                    q ^= alpha_to[reg[j]];
                 }
-
-                /*
-                 * have now found q such that d[u]!=0 and
-                 * u_lu[q] is maximum
-                 */
-                /* store degree of new elp polynomial */
-                if (l[u] > l[q] + u - q)
-                    l[u + 1] = l[u];
-                else
-                    l[u + 1] = l[q] + u - q;
-
-                /* form new elp(x) */
-                for (i = 0; i < t2; i++)
-                    elp[u + 1][i] = 0;
-                for (i = 0; i <= l[q]; i++)
-                    if (elp[q][i] != -1)
-                        elp[u + 1][i + u - q] =
-                          (int)alpha_to[(discrepancy[u] + this->N_p2_1 - discrepancy[q] + elp[q][i]) % this->N_p2_1];
-                for (i = 0; i <= l[u]; i++)
+            if (!q)
+            { /* store root and error
+               * location number indices */
+                if (static_cast<size_t>(count) >= loc.size())
                 {
-                    elp[u + 1][i] ^= elp[u][i];
-                    elp[u][i] = (int)index_of[elp[u][i]];
+                    std::stringstream message;
+                    message << "The polynomial seems not to be primitive.";
+                    throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
                 }
+                loc[count++] = this->N_p2_1 - i;
             }
-            u_lu[u + 1] = u - l[u + 1];
-
-            /* form (u+1)th discrepancy */
-            if (u < t2)
-            {
-                /* no discrepancy computed on last iteration */
-                if (s[u + 1] != -1)
-                    discrepancy[u + 1] = (int)alpha_to[s[u + 1]];
-                else
-                    discrepancy[u + 1] = 0;
-
-                for (i = 1; i <= l[u + 1]; i++)
-                    if ((s[u + 1 - i] != -1) && (elp[u + 1][i] != 0))
-                        discrepancy[u + 1] ^= alpha_to[(s[u + 1 - i] + index_of[elp[u + 1][i]]) % this->N_p2_1];
-                /* put d[u+1] into index form */
-                discrepancy[u + 1] = (int)index_of[discrepancy[u + 1]];
-            }
-        } while ((u < t2) && (l[u + 1] <= this->t));
+        }
 
-        u++;
-        if (l[u] <= this->t)
-        { /* May correct errors */
-            /* put elp into index form */
-            for (i = 0; i <= l[u]; i++)
-                elp[u][i] = (int)index_of[elp[u][i]];
+        /* no. roots = degree of elp hence <= this->t errors */
+        return (count == l[u]) ? count : -1;
+    }
+    else
+        return -1;
+}
 
-            /* Chien search: find roots of the error location polynomial */
-            for (i = 1; i <= l[u]; i++)
-                reg[i] = elp[u][i];
+template<typename B, typename R>
+int
+Decoder_BCH_std<B, R>::_decode(B* Y_N, const size_t frame_id)
+{
+    int i, j, syn_error = 0;
 
-            int count = 0;
-            for (i = 1; i <= this->N_p2_1; i++)
-            {
-                q = 1;
-                for (j = 1; j <= l[u]; j++)
-                    if (reg[j] != -1)
-                    {
-                        reg[j] = (reg[j] + j) % this->N_p2_1;
-                        q ^= alpha_to[reg[j]];
-                    }
-                if (!q)
-                { /* store root and error
-                   * location number indices */
-                    if (static_cast<size_t>(count) >= loc.size())
-                    {
-                        std::stringstream message;
-                        message << "The polynomial seems not to be primitive.";
-                        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
-                    }
-                    loc[count++] = this->N_p2_1 - i;
-                }
-            }
+    /* first form the syndromes */
+    for (i = 1; i <= t2; i++)
+    {
+        s[i] = 0;
+        for (j = 0; j < this->N; j++)
+            if (Y_N[j] != 0) s[i] ^= alpha_to[(i * j) % this->N_p2_1];
+        if (s[i] != 0) syn_error = 1; /* set error flag if non-zero syndrome */
+        /* convert syndrome from polynomial form to index form  */
+        s[i] = (int)index_of[s[i]];
+    }
 
-            if (count == l[u])
-            {
-                this->last_is_codeword[frame_id] = true;
+    this->last_is_codeword[frame_id] = !syn_error;
 
-                /* no. roots = degree of elp hence <= this->t errors */
-                for (i = 0; i < l[u]; i++)
-                    if (loc[i] < this->N) Y_N[loc[i]] ^= 1;
+    if (syn_error)
+    { /* if there are errors, try to correct them */
+        const auto n_roots = this->_decode_syndromes();
+        if (n_roots < 0) return spu::runtime::status_t::FAILURE;
 
-                return spu::runtime::status_t::SUCCESS;
-            }
-            else
-                return spu::runtime::status_t::FAILURE;
-        }
-        else
-            return spu::runtime::status_t::FAILURE;
+        this->last_is_codeword[frame_id] = true;
+        for (i = 0; i < n_roots; i++)
+            if (loc[i] < this->N) Y_N[loc[i]] ^= 1;
     }
-    else
-        return spu::runtime::status_t::SUCCESS;
+
+    return spu::runtime::status_t::SUCCESS;
 }
 
 template<typename B, typename R>
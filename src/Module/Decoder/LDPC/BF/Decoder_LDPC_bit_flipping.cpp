@@ -1,7 +1,6 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
-#include <mipp.h>
 #include <sstream>
 #include <streampu.hpp>
 #include <string>
@@ -35,6 +34,8 @@ Decoder_LDPC_bit_flipping<B, R>::Decoder_LDPC_bit_flipping(const int& K,
   , syndrome_depth(syndrome_depth)
   , H(H)
   , info_bits_pos(info_bits_pos)
+  , chk_to_var_ids(tools::Sparse_matrix_CSR::from_cols(H, tools::Sparse_matrix_CSR::fits_compact(H)))
+  , var_to_chk_ids(tools::Sparse_matrix_CSR::from_rows(H, tools::Sparse_matrix_CSR::fits_compact(H)))
   , Lp_N(N, -1)
   , // -1 in order to fail when AZCW
   C_to_V(this->n_frames, std::vector<R>(this->n_branches))
@@ -69,47 +70,6 @@ Decoder_LDPC_bit_flipping<B, R>::Decoder_LDPC_bit_flipping(const int& K,
         throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
     }
 
-    transpose.resize(this->n_branches);
-    mipp::vector<unsigned char> connections(H.get_n_rows(), 0);
-
-    const auto& CN_to_VN = H.get_col_to_rows();
-    const auto& VN_to_CN = H.get_row_to_cols();
-
-    auto k = 0;
-    for (auto i = 0; i < (int)CN_to_VN.size(); i++)
-    {
-        for (auto j = 0; j < (int)CN_to_VN[i].size(); j++)
-        {
-            auto id_V = CN_to_VN[i][j];
-
-            auto branch_id = 0;
-            for (auto ii = 0; ii < (int)id_V; ii++)
-                branch_id += (int)VN_to_CN[ii].size();
-            branch_id += connections[id_V];
-            connections[id_V]++;
-
-            if (connections[id_V] > (int)VN_to_CN[id_V].size())
-            {
-                std::stringstream message;
-                message << "'connections[id_V]' has to be equal or smaller than 'VN_to_CN[id_V].size()' ('id_V' = "
-                        << id_V << ", 'connections[id_V]' = " << connections[id_V]
-                        << ", 'VN_to_CN[id_V].size()' = " << VN_to_CN[id_V].size() << ").";
-                throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-            }
-
-            transpose[k] = branch_id;
-            k++;
-        }
-    }
-
-    n_variables_per_parity.resize(H.get_n_cols());
-    for (auto i = 0; i < (int)H.get_n_cols(); i++)
-        n_variables_per_parity[i] = (unsigned char)CN_to_VN[i].size();
-
-    n_parities_per_variable.resize(H.get_n_rows());
-    for (auto i = 0; i < (int)H.get_n_rows(); i++)
-        n_parities_per_variable[i] = (unsigned char)VN_to_CN[i].size();
-
     this->reset();
 }
 
@@ -208,17 +168,11 @@ bool
 Decoder_LDPC_bit_flipping<B, R>::BF_decode(const R* Y_N, const size_t frame_id)
 {
     // compute y_min,m for n in N(m)
-    for (auto imin = 0; imin < this->n_C_nodes; imin++)
-    {
-        const auto length = this->n_variables_per_parity[imin];
-        auto min_val = std::numeric_limits<R>::max();
-        for (auto mmin = 0; mmin < length; ++mmin)
-        {
-            auto comp = (R)std::abs(Y_N[this->H.get_rows_from_col(imin)[mmin]]);
-            min_val = (min_val > comp) ? comp : min_val;
-        }
-        Y_min[imin] = min_val;
-    }
+    if (this->chk_to_var_ids.is_compact())
+        this->template compute_Y_min<uint16_t>(Y_N);
+    else
+        this->template compute_Y_min<uint32_t>(Y_N);
+
     // compute init Zn
     for (int i = 0; i < this->n_V_nodes; ++i)
     {
@@ -246,6 +200,26 @@ Decoder_LDPC_bit_flipping<B, R>::BF_decode(const R* Y_N, const size_t frame_id)
     return syndrome;
 }
 
+template<typename B, typename R>
+template<typename I>
+void
+Decoder_LDPC_bit_flipping<B, R>::compute_Y_min(const R* Y_N)
+{
+    const auto offsets = this->chk_to_var_ids.get_offsets().data();
+    const auto var_ids = this->chk_to_var_ids.template get_indexes<I>();
+
+    for (auto imin = 0; imin < this->n_C_nodes; imin++)
+    {
+        auto min_val = std::numeric_limits<R>::max();
+        for (auto mmin = offsets[imin]; mmin < offsets[imin + 1]; ++mmin)
+        {
+            auto comp = (R)std::abs(Y_N[var_ids[mmin]]);
+            min_val = (min_val > comp) ? comp : min_val;
+        }
+        Y_min[imin] = min_val;
+    }
+}
+
 template<typename B, typename R>
 void
 Decoder_LDPC_bit_flipping<B, R>::set_n_frames(const size_t n_frames)
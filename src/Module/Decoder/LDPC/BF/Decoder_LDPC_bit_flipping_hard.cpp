@@ -26,6 +26,8 @@ Decoder_LDPC_bit_flipping_hard<B, R>::Decoder_LDPC_bit_flipping_hard(const int&
   , enable_syndrome(enable_syndrome)
   , syndrome_depth(syndrome_depth)
   , H(_H)
+  , chk_to_var_ids(tools::Sparse_matrix_CSR::from_cols(_H, tools::Sparse_matrix_CSR::fits_compact(_H)))
+  , var_to_chk_ids(tools::Sparse_matrix_CSR::from_rows(_H, tools::Sparse_matrix_CSR::fits_compact(_H)))
   , var_nodes(N)
   , check_nodes(this->H.get_n_cols())
   , YH_N(N)
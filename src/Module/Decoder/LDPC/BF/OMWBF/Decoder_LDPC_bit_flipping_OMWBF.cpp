@@ -50,14 +50,30 @@ template<typename B, typename R>
 bool
 Decoder_LDPC_bit_flipping_OMWBF<B, R>::BF_process(const R* Y_N, std::vector<R>& V_to_C, std::vector<R>& C_to_V)
 {
+    if (this->chk_to_var_ids.is_compact())
+        return this->template _BF_process<uint16_t>(Y_N);
+    else
+        return this->template _BF_process<uint32_t>(Y_N);
+}
+
+template<typename B, typename R>
+template<typename I>
+bool
+Decoder_LDPC_bit_flipping_OMWBF<B, R>::_BF_process(const R* Y_N)
+{
+    const auto chk_offsets = this->chk_to_var_ids.get_offsets().data();
+    const auto var_ids = this->chk_to_var_ids.template get_indexes<I>();
+    const auto var_offsets = this->var_to_chk_ids.get_offsets().data();
+    const auto chk_ids = this->var_to_chk_ids.template get_indexes<I>();
+
     bool syndrome = 0;
 
     for (auto i = 0; i < this->n_C_nodes; ++i)
     {
         synd[i] = 0;
 
-        for (auto j = 0; j < this->n_variables_per_parity[i]; ++j)
-            synd[i] ^= this->decis[this->H.get_rows_from_col(i).at(j)];
+        for (auto j = chk_offsets[i]; j < chk_offsets[i + 1]; ++j)
+            synd[i] ^= this->decis[var_ids[j]];
 
         syndrome |= (synd[i] != 0);
     }
@@ -65,9 +81,9 @@ Decoder_LDPC_bit_flipping_OMWBF<B, R>::BF_process(const R* Y_N, std::vector<R>&
     for (auto i = 0; i < this->n_V_nodes; ++i)
     {
         energy[i] = 0;
-        for (auto j = 0; j < this->n_parities_per_variable[i]; ++j)
+        for (auto j = var_offsets[i]; j < var_offsets[i + 1]; ++j)
         {
-            auto m = this->H.get_cols_from_row(i)[j];
+            auto m = chk_ids[j];
             energy[i] += (2 * synd[m] - 1) * this->Y_min[m];
         }
         energy[i] -= this->mwbf_factor * (R)std::abs(Y_N[i]);
@@ -34,12 +34,12 @@ Decoder_LDPC_probabilistic_parallel_bit_flipping<B, R>::Decoder_LDPC_probabilist
         throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
-    if (bernouilli_probas.size() != (this->H.get_rows_max_degree() + 2))
+    if (bernouilli_probas.size() != (this->var_to_chk_ids.get_max_degree() + 2))
     {
         std::stringstream message;
         message << "'bernouilli_probas.size()' must be equal to the biggest variable node degree plus 2"
                 << "('bernouilli_probas.size() = '" << bernouilli_probas.size()
-                << ", 'variable node max degree' = " << this->H.get_rows_max_degree() << ").";
+                << ", 'variable node max degree' = " << this->var_to_chk_ids.get_max_degree() << ").";
         throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
@@ -61,16 +61,30 @@ template<typename B, typename R>
 void
 Decoder_LDPC_probabilistic_parallel_bit_flipping<B, R>::cn_process(const B* VN, B* CN, const size_t frame_id)
 {
+    if (this->chk_to_var_ids.is_compact())
+        this->template _cn_process<uint16_t>(VN, CN);
+    else
+        this->template _cn_process<uint32_t>(VN, CN);
+}
+
+template<typename B, typename R>
+template<typename I>
+void
+Decoder_LDPC_probabilistic_parallel_bit_flipping<B, R>::_cn_process(const B* VN, B* CN)
+{
+    const auto offsets = this->chk_to_var_ids.get_offsets().data();
+    const auto var_ids = this->chk_to_var_ids.template get_indexes<I>();
+
     // for each check nodes
-    const auto n_chk_nodes = (int)this->H.get_n_cols();
+    const auto n_chk_nodes = (int)this->chk_to_var_ids.size();
     for (auto c = 0; c < n_chk_nodes; c++)
     {
-        const auto& chk_node = this->H.get_col_to_rows()[c];
-        const auto chk_degree = chk_node.size();
+        const auto chk_vars = var_ids + offsets[c];
+        const auto chk_degree = offsets[c + 1] - offsets[c];
 
         CN[c] = 0;
         for (unsigned v = 0; v < chk_degree; v++)
-            CN[c] ^= VN[chk_node[v]];
+            CN[c] ^= VN[chk_vars[v]];
     }
 }
 
@@ -81,16 +95,30 @@ Decoder_LDPC_probabilistic_parallel_bit_flipping<B, R>::vn_process(const B* Y_N,
                                                                    const B* CN,
                                                                    const size_t frame_id)
 {
+    if (this->var_to_chk_ids.is_compact())
+        this->template _vn_process<uint16_t>(Y_N, VN, CN);
+    else
+        this->template _vn_process<uint32_t>(Y_N, VN, CN);
+}
+
+template<typename B, typename R>
+template<typename I>
+void
+Decoder_LDPC_probabilistic_parallel_bit_flipping<B, R>::_vn_process(const B* Y_N, B* VN, const B* CN)
+{
+    const auto offsets = this->var_to_chk_ids.get_offsets().data();
+    const auto chk_ids = this->var_to_chk_ids.template get_indexes<I>();
+
     // for each variable nodes
-    const auto n_var_nodes = (int)this->H.get_n_rows();
+    const auto n_var_nodes = (int)this->var_to_chk_ids.size();
     for (auto v = 0; v < n_var_nodes; v++)
     {
-        const auto& var_node = this->H.get_row_to_cols()[v];
-        const auto var_degree = var_node.size();
+        const auto var_chks = chk_ids + offsets[v];
+        const auto var_degree = offsets[v + 1] - offsets[v];
 
         auto energy = VN[v] ^ Y_N[v];
         for (unsigned c = 0; c < var_degree; c++)
-            energy += CN[var_node[c]];
+            energy += CN[var_chks[c]];
 
         VN[v] ^= (B)(bernouilli_dist[energy])(this->rd_engine);
     }
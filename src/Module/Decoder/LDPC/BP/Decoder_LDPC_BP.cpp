@@ -14,6 +14,8 @@ Decoder_LDPC_BP ::Decoder_LDPC_BP(const int K,
                                   const int syndrome_depth)
   : n_ite(n_ite)
   , H(_H)
+  , chk_to_var_ids(tools::Sparse_matrix_CSR::from_cols(_H, tools::Sparse_matrix_CSR::fits_compact(_H)))
+  , var_to_chk_ids(tools::Sparse_matrix_CSR::from_rows(_H, tools::Sparse_matrix_CSR::fits_compact(_H)))
   , enable_syndrome(enable_syndrome)
   , syndrome_depth(syndrome_depth)
   , cur_syndrome_depth(0)
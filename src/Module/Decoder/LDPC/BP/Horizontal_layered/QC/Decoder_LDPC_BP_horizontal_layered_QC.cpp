@@ -0,0 +1,477 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+#include <typeinfo>
+
+#include "Module/Decoder/LDPC/BP/Horizontal_layered/QC/Decoder_LDPC_BP_horizontal_layered_QC.hpp"
+#include "Tools/Code/LDPC/QC/QC.hpp"
+#include "Tools/Perf/common/hard_decide.h"
+#include "Tools/general_utils.h"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template<typename B, typename R>
+Decoder_LDPC_BP_horizontal_layered_QC<B, R>::Decoder_LDPC_BP_horizontal_layered_QC(
+  const int K,
+  const int N,
+  const int n_ite,
+  const tools::Sparse_matrix& _H,
+  const std::vector<unsigned>& info_bits_pos,
+  const float normalize_factor,
+  const R offset,
+  const bool enable_syndrome,
+  const int syndrome_depth)
+  : Decoder_SISO<B, R>(K, N)
+  , Decoder_LDPC_BP(K, N, n_ite, _H, enable_syndrome, syndrome_depth)
+  , normalize_factor(normalize_factor)
+  , offset(offset)
+  , saturation((R)((1 << ((sizeof(R) * 8 - 2) - (int)std::log2(this->H.get_rows_max_degree()))) - 1))
+  , info_bits_pos(info_bits_pos)
+  , Z(0)
+  , Z_al(0)
+  , stride(0)
+  , lanes(mipp::N<R>())
+{
+    const std::string name = "Decoder_LDPC_BP_horizontal_layered_QC";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    tools::check_LUT(info_bits_pos, "info_bits_pos", (size_t)K);
+
+    if (sizeof(R) == 1)
+        throw spu::tools::runtime_error(
+          __FILE__, __LINE__, __func__, "This decoder does not work in 8-bit fixed-point.");
+
+    if (saturation <= 0)
+    {
+        std::stringstream message;
+        message << "'saturation' has to be greater than 0 ('saturation' = " << saturation << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    tools::QC::Base_matrix base;
+    if (!tools::QC::extract_base(this->H, base))
+    {
+        std::stringstream message;
+        message << "'H' has no quasi-cyclic structure, this decoder requires a QC matrix without check nodes "
+                << "reordering ('H.get_n_rows()' = " << this->H.get_n_rows()
+                << ", 'H.get_n_cols()' = " << this->H.get_n_cols() << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    const auto n_lanes = (unsigned)mipp::N<R>();
+    this->Z = base.Z;
+    this->Z_al = ((this->Z + n_lanes - 1) / n_lanes) * n_lanes;
+    // the unaligned loads of a block start at most at 'Z - 1' and read 'Z_al' values
+    this->stride = ((2 * this->Z + n_lanes - 1) / n_lanes + 1) * n_lanes;
+
+    auto n_circulants = 0u;
+    auto max_layer_degree = 0u;
+    this->layers.resize(base.M_red);
+    for (unsigned i = 0; i < base.M_red; i++)
+    {
+        for (unsigned j = 0; j < base.N_red; j++)
+            if (base.shifts[i][j] >= 0) this->layers[i].push_back(std::make_pair(j, (unsigned)base.shifts[i][j]));
+        n_circulants += (unsigned)this->layers[i].size();
+        max_layer_degree = std::max(max_layer_degree, (unsigned)this->layers[i].size());
+    }
+
+    for (unsigned l = 0; l < n_lanes; l++)
+        this->lanes[l] = (R)l;
+
+    this->contributions.resize(max_layer_degree * n_lanes);
+    this->var_nodes.resize(this->get_n_frames(), mipp::vector<R>(base.N_red * this->stride));
+    this->messages.resize(this->get_n_frames(), mipp::vector<R>(n_circulants * this->Z_al));
+
+    this->reset();
+}
+
+template<typename B, typename R>
+Decoder_LDPC_BP_horizontal_layered_QC<B, R>*
+Decoder_LDPC_BP_horizontal_layered_QC<B, R>::clone() const
+{
+    auto m = new Decoder_LDPC_BP_horizontal_layered_QC(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R>
+unsigned
+Decoder_LDPC_BP_horizontal_layered_QC<B, R>::get_Z() const
+{
+    return this->Z;
+}
+
+template<typename B, typename R>
+void
+Decoder_LDPC_BP_horizontal_layered_QC<B, R>::_reset(const size_t frame_id)
+{
+    std::fill(this->messages[frame_id].begin(), this->messages[frame_id].end(), (R)0);
+    std::fill(this->var_nodes[frame_id].begin(), this->var_nodes[frame_id].end(), (R)0);
+}
+
+template<typename B, typename R>
+void
+Decoder_LDPC_BP_horizontal_layered_QC<B, R>::_load(const R* Y_N, const size_t frame_id)
+{
+    const auto n_blocks = (unsigned)this->N / this->Z;
+    for (unsigned j = 0; j < n_blocks; j++)
+    {
+        auto blk = this->var_nodes[frame_id].data() + j * this->stride;
+        const auto Y_blk = Y_N + j * this->Z;
+        for (unsigned p = 0; p < this->Z; p++)
+            blk[p] += Y_blk[p]; // var_nodes contain previous extrinsic information
+        std::copy(blk, blk + this->Z, blk + this->Z);
+    }
+}
+
+template<typename B, typename R>
+int
+Decoder_LDPC_BP_horizontal_layered_QC<B, R>::_decode_siso(const R* Y_N1,
+                                                          int8_t* CWD,
+                                                          R* Y_N2,
+                                                          const size_t frame_id)
+{
+    // memory zones initialization
+    this->_load(Y_N1, frame_id);
+
+    // actual decoding
+    auto status = this->_decode(frame_id);
+
+    // prepare for next round by processing extrinsic information and copy it into var_nodes for next TURBO iteration
+    const auto n_blocks = (unsigned)this->N / this->Z;
+    for (unsigned j = 0; j < n_blocks; j++)
+    {
+        auto blk = this->var_nodes[frame_id].data() + j * this->stride;
+        for (unsigned p = 0; p < this->Z; p++)
+        {
+            const auto v = j * this->Z + p;
+            Y_N2[v] = blk[p] - Y_N1[v];
+        }
+        std::copy(Y_N2 + j * this->Z, Y_N2 + (j + 1) * this->Z, blk);
+        std::copy(Y_N2 + j * this->Z, Y_N2 + (j + 1) * this->Z, blk + this->Z);
+    }
+
+    CWD[0] = !status;
+    return status;
+}
+
+template<typename B, typename R>
+int
+Decoder_LDPC_BP_horizontal_layered_QC<B, R>::_decode_siho(const R* Y_N,
+                                                          int8_t* CWD,
+                                                          B* V_K,
+                                                          const size_t frame_id)
+{
+    this->_load(Y_N, frame_id);
+    auto status = this->_decode(frame_id);
+
+    // take the hard decision
+    for (auto i = 0; i < this->K; i++)
+    {
+        const auto k = this->info_bits_pos[i];
+        V_K[i] = !(this->var_nodes[frame_id][(k / this->Z) * this->stride + k % this->Z] >= 0);
+    }
+
+    CWD[0] = !status;
+    return status;
+}
+
+template<typename B, typename R>
+int
+Decoder_LDPC_BP_horizontal_layered_QC<B, R>::_decode_siho_cw(const R* Y_N,
+                                                             int8_t* CWD,
+                                                             B* V_N,
+                                                             const size_t frame_id)
+{
+    this->_load(Y_N, frame_id);
+    auto status = this->_decode(frame_id);
+
+    // take the hard decision
+    const auto n_blocks = (unsigned)this->N / this->Z;
+    for (unsigned j = 0; j < n_blocks; j++)
+        tools::hard_decide(this->var_nodes[frame_id].data() + j * this->stride, V_N + j * this->Z, this->Z);
+
+    CWD[0] = !status;
+    return status;
+}
+
+template<typename B, typename R>
+int
+Decoder_LDPC_BP_horizontal_layered_QC<B, R>::_decode(const size_t frame_id)
+{
+    if (typeid(R) == typeid(short) || typeid(R) == typeid(signed char))
+    {
+        if (normalize_factor == 0.125f)
+            return this->_decode<1>(frame_id);
+        else if (normalize_factor == 0.250f)
+            return this->_decode<2>(frame_id);
+        else if (normalize_factor == 0.375f)
+            return this->_decode<3>(frame_id);
+        else if (normalize_factor == 0.500f)
+            return this->_decode<4>(frame_id);
+        else if (normalize_factor == 0.625f)
+            return this->_decode<5>(frame_id);
+        else if (normalize_factor == 0.750f)
+            return this->_decode<6>(frame_id);
+        else if (normalize_factor == 0.875f)
+            return this->_decode<7>(frame_id);
+        else if (normalize_factor == 1.000f)
+            return this->_decode<8>(frame_id);
+        else
+        {
+            std::stringstream message;
+            message << "'normalize_factor' can only be 0.125f, 0.250f, 0.375f, 0.500f, 0.625f, 0.750f, 0.875f or 1.000f"
+                    << " ('normalize_factor' = " << normalize_factor << ").";
+            throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+    }
+    else // float or double
+    {
+        if (normalize_factor == 1.000f)
+            return this->_decode<8>(frame_id);
+        else
+            return this->_decode<0>(frame_id);
+    }
+}
+
+template<typename B, typename R>
+template<int F>
+int
+Decoder_LDPC_BP_horizontal_layered_QC<B, R>::_decode(const size_t frame_id)
+{
+    auto cur_syndrome_depth = 0;
+    auto valid_synd = false;
+    for (auto ite = 0; ite < this->n_ite; ite++)
+    {
+        this->_decode_single_ite<F>(this->var_nodes[frame_id], this->messages[frame_id]);
+
+        // stop criterion
+        if (this->enable_syndrome && (valid_synd = this->_check_syndrome(this->var_nodes[frame_id])))
+        {
+            cur_syndrome_depth++;
+            if (cur_syndrome_depth == this->syndrome_depth) break;
+        }
+        else
+            cur_syndrome_depth = 0;
+    }
+
+    return !valid_synd && this->enable_syndrome;
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
+
+// --------------------------------------------------------------------------------------------------------- saturation
+template<typename R>
+inline mipp::Reg<R>
+layer_sat(const mipp::Reg<R> val, const R saturation)
+{
+    return val;
+}
+template<>
+inline mipp::Reg<short>
+layer_sat(const mipp::Reg<short> v, const short s)
+{
+    return mipp::sat(v, (short)-s, (short)+s);
+}
+
+// ------------------------------------------------------------------------------------------------------ normalization
+template<typename R, int F = 0>
+inline mipp::Reg<R>
+layer_normalize(const mipp::Reg<R> val, const float factor)
+{
+    return val * mipp::Reg<R>((R)factor);
+}
+template<>
+inline mipp::Reg<short>
+layer_normalize<short, 1>(const mipp::Reg<short> v, const float f)
+{
+    return (v >> 3);
+} // v * 0.125
+template<>
+inline mipp::Reg<short>
+layer_normalize<short, 2>(const mipp::Reg<short> v, const float f)
+{
+    return (v >> 2);
+} // v * 0.250
+template<>
+inline mipp::Reg<short>
+layer_normalize<short, 3>(const mipp::Reg<short> v, const float f)
+{
+    return (v >> 3) + (v >> 2);
+} // v * 0.375
+template<>
+inline mipp::Reg<short>
+layer_normalize<short, 4>(const mipp::Reg<short> v, const float f)
+{
+    return (v >> 1);
+} // v * 0.500
+template<>
+inline mipp::Reg<short>
+layer_normalize<short, 5>(const mipp::Reg<short> v, const float f)
+{
+    return (v >> 3) + (v >> 1);
+} // v * 0.625
+template<>
+inline mipp::Reg<short>
+layer_normalize<short, 6>(const mipp::Reg<short> v, const float f)
+{
+    return (v >> 2) + (v >> 1);
+} // v * 0.750
+template<>
+inline mipp::Reg<short>
+layer_normalize<short, 7>(const mipp::Reg<short> v, const float f)
+{
+    return (v >> 3) + (v >> 2) + (v >> 1);
+} // v * 0.875
+template<>
+inline mipp::Reg<short>
+layer_normalize<short, 8>(const mipp::Reg<short> v, const float f)
+{
+    return v;
+} // v * 1.000
+template<>
+inline mipp::Reg<float>
+layer_normalize<float, 8>(const mipp::Reg<float> v, const float f)
+{
+    return v;
+} // v * 1.000
+template<>
+inline mipp::Reg<double>
+layer_normalize<double, 8>(const mipp::Reg<double> v, const float f)
+{
+    return v;
+} // v * 1.000
+
+// --------------------------------------------------------------------------------------------------------- SIMD TOOLS
+// --------------------------------------------------------------------------------------------------------------------
+
+// BP algorithm, one layer (block row) at a time: the lane 'k' of the circulant (i, j) of shift 's' is the connection
+// between the check node 'i * Z + k' and the variable node 'j * Z + (k + s) % Z'
+template<typename B, typename R>
+template<int F>
+void
+Decoder_LDPC_BP_horizontal_layered_QC<B, R>::_decode_single_ite(mipp::vector<R>& var_nodes,
+                                                                mipp::vector<R>& messages)
+{
+    const auto n_lanes = (unsigned)mipp::N<R>();
+    const auto zero_msk = mipp::Msk<mipp::N<R>()>(false);
+    const auto zero = mipp::Reg<R>((R)0);
+    const auto r_max = mipp::Reg<R>(std::numeric_limits<R>::max());
+    const auto r_offset = mipp::Reg<R>(this->offset);
+
+    auto msg = messages.data();
+    for (const auto& layer : this->layers)
+    {
+        const auto layer_degree = (unsigned)layer.size();
+        for (unsigned n = 0; n < this->Z_al; n += n_lanes)
+        {
+            auto sign = zero_msk;
+            auto min1 = r_max;
+            auto min2 = r_max;
+
+            for (unsigned d = 0; d < layer_degree; d++)
+            {
+                const auto var = var_nodes.data() + layer[d].first * this->stride + layer[d].second + n;
+                const auto contribution = mipp::loadu(var) - mipp::load(msg + d * this->Z_al + n);
+                mipp::store(this->contributions.data() + d * n_lanes, contribution);
+
+                const auto var_abs = mipp::abs(contribution);
+                const auto tmp = min1;
+
+                sign ^= mipp::sign(contribution);
+                min1 = mipp::min(min1, var_abs);
+                min2 = mipp::min(min2, mipp::max(var_abs, tmp));
+            }
+
+            auto cste1 = layer_sat<R>(layer_normalize<R, F>(min2 - r_offset, normalize_factor), saturation);
+            auto cste2 = layer_sat<R>(layer_normalize<R, F>(min1 - r_offset, normalize_factor), saturation);
+
+            cste1 = mipp::blend(zero, cste1, zero > cste1);
+            cste2 = mipp::blend(zero, cste2, zero > cste2);
+
+            for (unsigned d = 0; d < layer_degree; d++)
+            {
+                const auto contribution = mipp::load(this->contributions.data() + d * n_lanes);
+                const auto var_abs = mipp::abs(contribution);
+                const auto res_abs = mipp::blend(cste1, cste2, var_abs == min1);
+                const auto res = mipp::copysign(res_abs, sign ^ mipp::sign(contribution));
+
+                mipp::store(msg + d * this->Z_al + n, res);
+                mipp::storeu(var_nodes.data() + layer[d].first * this->stride + layer[d].second + n, contribution + res);
+            }
+        }
+
+        // the variable nodes have been updated in the range [s, s + Z) of each block, refresh the two copies
+        for (unsigned d = 0; d < layer_degree; d++)
+        {
+            auto blk = var_nodes.data() + layer[d].first * this->stride;
+            const auto s = layer[d].second;
+            std::copy(blk + this->Z, blk + this->Z + s, blk);
+            std::copy(blk + s, blk + this->Z, blk + this->Z + s);
+        }
+
+        msg += layer_degree * this->Z_al;
+    }
+}
+
+template<typename B, typename R>
+bool
+Decoder_LDPC_BP_horizontal_layered_QC<B, R>::_check_syndrome(const mipp::vector<R>& var_nodes)
+{
+    const auto n_lanes = (unsigned)mipp::N<R>();
+    const auto zero_msk = mipp::Msk<mipp::N<R>()>(false);
+    const auto r_lanes = mipp::load(this->lanes.data());
+
+    for (const auto& layer : this->layers)
+    {
+        for (unsigned n = 0; n < this->Z_al; n += n_lanes)
+        {
+            auto sign = zero_msk;
+            for (const auto& circulant : layer)
+                sign ^= mipp::sign(mipp::loadu(var_nodes.data() + circulant.first * this->stride + circulant.second + n));
+
+            // mask the padding lanes of the last register
+            if (n + n_lanes > this->Z) sign &= r_lanes < mipp::Reg<R>((R)(this->Z - n));
+
+            if (!mipp::testz(sign)) return false;
+        }
+    }
+
+    return true;
+}
+
+template<typename B, typename R>
+void
+Decoder_LDPC_BP_horizontal_layered_QC<B, R>::set_n_frames(const size_t n_frames)
+{
+    const auto old_n_frames = this->get_n_frames();
+    if (old_n_frames != n_frames)
+    {
+        Decoder_SISO<B, R>::set_n_frames(n_frames);
+
+        const auto vec_size = this->var_nodes[0].size();
+        this->var_nodes.resize(n_frames, mipp::vector<R>(vec_size));
+
+        const auto vec_size2 = this->messages[0].size();
+        this->messages.resize(n_frames, mipp::vector<R>(vec_size2));
+    }
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_BP_horizontal_layered_QC<B_8, Q_8>;
+template class aff3ct::module::Decoder_LDPC_BP_horizontal_layered_QC<B_16, Q_16>;
+template class aff3ct::module::Decoder_LDPC_BP_horizontal_layered_QC<B_32, Q_32>;
+template class aff3ct::module::Decoder_LDPC_BP_horizontal_layered_QC<B_64, Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_BP_horizontal_layered_QC<B, Q>;
+#endif
+// ==================================================================================== explicit template instantiation
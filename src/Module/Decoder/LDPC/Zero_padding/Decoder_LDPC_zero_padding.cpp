@@ -0,0 +1,204 @@
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+
+#include "Module/Decoder/LDPC/Zero_padding/Decoder_LDPC_zero_padding.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template<typename B, typename R>
+Decoder_LDPC_zero_padding<B, R>::Decoder_LDPC_zero_padding(const int K,
+                                                           const int N,
+                                                           const Decoder_SIHO<B, R>& dec,
+                                                           const std::vector<uint32_t>& kept_pos)
+  : Decoder_SISO<B, R>(K, N)
+  , dec(dynamic_cast<Decoder_SIHO<B, R>*>(dec.clone()))
+  , kept_pos(kept_pos)
+  , padding_llr(std::numeric_limits<R>::max() / 2)
+  , Y_N_red(dec.get_N() * dec.get_n_frames_per_wave())
+  , Y_N2_red(dec.get_N() * dec.get_n_frames_per_wave())
+  , V_red(dec.get_N() * dec.get_n_frames_per_wave())
+{
+    const std::string name = "Decoder_LDPC_zero_padding";
+    this->set_name(name);
+    this->set_n_frames(dec.get_n_frames());
+    this->set_n_frames_per_wave(dec.get_n_frames_per_wave());
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    if (dec.get_K() > K)
+    {
+        std::stringstream message;
+        message << "'dec.get_K()' has to be smaller than or equal to 'K' ('dec.get_K()' = " << dec.get_K()
+                << ", 'K' = " << K << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if ((size_t)dec.get_N() != kept_pos.size())
+    {
+        std::stringstream message;
+        message << "'dec.get_N()' has to be equal to 'kept_pos.size()' ('dec.get_N()' = " << dec.get_N()
+                << ", 'kept_pos.size()' = " << kept_pos.size() << ").";
+        throw spu::tools::length_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    for (size_t i = 0; i < kept_pos.size(); i++)
+        if (kept_pos[i] >= (uint32_t)N || (i > 0 && kept_pos[i] <= kept_pos[i - 1]))
+        {
+            std::stringstream message;
+            message << "'kept_pos' has to be strictly increasing and its values have to be smaller than 'N' ('i' = "
+                    << i << ", 'kept_pos[i]' = " << kept_pos[i] << ", 'N' = " << N << ").";
+            throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+
+    // the inner decoder is reset with this decoder
+    this->dec->set_auto_reset(false);
+    (*this->dec.get())[dec::tsk::decode_siho].set_fast(true);
+    (*this->dec.get())[dec::tsk::decode_siho_cw].set_fast(true);
+    if (auto siso = dynamic_cast<Decoder_SISO<B, R>*>(this->dec.get())) (*siso)[dec::tsk::decode_siso].set_fast(true);
+}
+
+template<typename B, typename R>
+Decoder_LDPC_zero_padding<B, R>*
+Decoder_LDPC_zero_padding<B, R>::clone() const
+{
+    auto m = new Decoder_LDPC_zero_padding(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R>
+void
+Decoder_LDPC_zero_padding<B, R>::deep_copy(const Decoder_LDPC_zero_padding<B, R>& m)
+{
+    spu::module::Stateful::deep_copy(m);
+    if (m.dec != nullptr) this->dec.reset(dynamic_cast<Decoder_SIHO<B, R>*>(m.dec->clone()));
+}
+
+template<typename B, typename R>
+const Decoder_SIHO<B, R>&
+Decoder_LDPC_zero_padding<B, R>::get_decoder() const
+{
+    return *this->dec;
+}
+
+template<typename B, typename R>
+void
+Decoder_LDPC_zero_padding<B, R>::set_n_frames(const size_t n_frames)
+{
+    const auto old_n_frames = this->get_n_frames();
+    if (old_n_frames != n_frames)
+    {
+        Decoder_SISO<B, R>::set_n_frames(n_frames);
+        this->dec->set_n_frames(n_frames);
+    }
+}
+
+template<typename B, typename R>
+void
+Decoder_LDPC_zero_padding<B, R>::set_seed(const int seed)
+{
+    this->dec->set_seed(seed);
+}
+
+template<typename B, typename R>
+void
+Decoder_LDPC_zero_padding<B, R>::_reset(const size_t frame_id)
+{
+    this->dec->reset((int)frame_id);
+}
+
+template<typename B, typename R>
+void
+Decoder_LDPC_zero_padding<B, R>::_gather(const R* Y_N)
+{
+    const auto N_red = this->kept_pos.size();
+    for (size_t f = 0; f < this->get_n_frames_per_wave(); f++)
+    {
+        const auto Y_N_f = Y_N + f * this->N;
+        auto Y_N_red_f = this->Y_N_red.data() + f * N_red;
+        for (size_t i = 0; i < N_red; i++)
+            Y_N_red_f[i] = Y_N_f[this->kept_pos[i]];
+    }
+}
+
+template<typename B, typename R>
+int
+Decoder_LDPC_zero_padding<B, R>::_decode_siso(const R* Y_N1, int8_t* CWD, R* Y_N2, const size_t frame_id)
+{
+    auto siso = dynamic_cast<Decoder_SISO<B, R>*>(this->dec.get());
+    if (siso == nullptr)
+    {
+        std::stringstream message;
+        message << "The inner decoder is not a SISO decoder ('dec->get_name()' = " << this->dec->get_name() << ").";
+        throw spu::tools::unimplemented_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->_gather(Y_N1);
+    const auto status = siso->decode_siso(this->Y_N_red.data(), CWD, this->Y_N2_red.data(), frame_id, false);
+
+    const auto N_red = this->kept_pos.size();
+    for (size_t f = 0; f < this->get_n_frames_per_wave(); f++)
+    {
+        auto Y_N2_f = Y_N2 + f * this->N;
+        const auto Y_N2_red_f = this->Y_N2_red.data() + f * N_red;
+        std::fill(Y_N2_f, Y_N2_f + this->N, this->padding_llr);
+        for (size_t i = 0; i < N_red; i++)
+            Y_N2_f[this->kept_pos[i]] = Y_N2_red_f[i];
+    }
+
+    return status;
+}
+
+template<typename B, typename R>
+int
+Decoder_LDPC_zero_padding<B, R>::_decode_siho(const R* Y_N, int8_t* CWD, B* V_K, const size_t frame_id)
+{
+    this->_gather(Y_N);
+    const auto status = this->dec->decode_siho(this->Y_N_red.data(), CWD, this->V_red.data(), frame_id, false);
+
+    const auto K_red = (size_t)this->dec->get_K();
+    for (size_t f = 0; f < this->get_n_frames_per_wave(); f++)
+    {
+        auto V_K_f = V_K + f * this->K;
+        std::copy(this->V_red.data() + f * K_red, this->V_red.data() + (f + 1) * K_red, V_K_f);
+        std::fill(V_K_f + K_red, V_K_f + this->K, (B)0);
+    }
+
+    return status;
+}
+
+template<typename B, typename R>
+int
+Decoder_LDPC_zero_padding<B, R>::_decode_siho_cw(const R* Y_N, int8_t* CWD, B* V_N, const size_t frame_id)
+{
+    this->_gather(Y_N);
+    const auto status = this->dec->decode_siho_cw(this->Y_N_red.data(), CWD, this->V_red.data(), frame_id, false);
+
+    const auto N_red = this->kept_pos.size();
+    for (size_t f = 0; f < this->get_n_frames_per_wave(); f++)
+    {
+        auto V_N_f = V_N + f * this->N;
+        const auto V_red_f = this->V_red.data() + f * N_red;
+        std::fill(V_N_f, V_N_f + this->N, (B)0);
+        for (size_t i = 0; i < N_red; i++)
+            V_N_f[this->kept_pos[i]] = V_red_f[i];
+    }
+
+    return status;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_LDPC_zero_padding<B_8, Q_8>;
+template class aff3ct::module::Decoder_LDPC_zero_padding<B_16, Q_16>;
+template class aff3ct::module::Decoder_LDPC_zero_padding<B_32, Q_32>;
+template class aff3ct::module::Decoder_LDPC_zero_padding<B_64, Q_64>;
+#else
+template class aff3ct::module::Decoder_LDPC_zero_padding<B, Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,316 @@
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+#include <type_traits>
+
+#include "Module/Decoder/Polar_MK/SC/Decoder_polar_MK_SC_fast.hpp"
+#include "Tools/Code/Polar/decoder_polar_functions.h"
+#include "Tools/Code/Polar/fb_assert.h"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template<typename B, typename R>
+Decoder_polar_MK_SC_fast<B, R>::Decoder_polar_MK_SC_fast(const int& K,
+                                                         const int& N,
+                                                         const tools::Polar_code& code,
+                                                         const std::vector<bool>& frozen_bits)
+  : Decoder_SIHO<B, R>(K, N)
+  , frozen_bits(frozen_bits)
+  , kernel_ids(code.get_stages().size())
+  , node_sizes(code.get_stages().size() + 1)
+  , offsets(code.get_stages().size() + 2, 0)
+  , kernel_sizes(code.get_kernel_matrices().size())
+  , updates(code.get_kernel_matrices().size())
+  , rows(code.get_kernel_matrices().size())
+  , codewords(code.get_kernel_matrices().size())
+  , u(N)
+  , leaf(0)
+{
+    const std::string name = "Decoder_polar_MK_SC_fast";
+    this->set_name(name);
+
+    if (this->N != code.get_codeword_size())
+    {
+        std::stringstream message;
+        message << "'N' has to be equal to 'code.get_codeword_size()' ('N' = " << N
+                << ", 'code.get_codeword_size()' = " << code.get_codeword_size() << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->N != (int)frozen_bits.size())
+    {
+        std::stringstream message;
+        message << "'frozen_bits.size()' has to be equal to 'N' ('frozen_bits.size()' = " << frozen_bits.size()
+                << ", 'N' = " << N << ").";
+        throw spu::tools::length_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    auto k = 0;
+    for (auto i = 0; i < this->N; i++)
+        if (frozen_bits[i] == 0) k++;
+    if (this->K != k)
+    {
+        std::stringstream message;
+        message << "The number of information bits in the frozen_bits is invalid ('K' = " << K << ", 'k' = " << k
+                << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    // compile the min-sum update tables of the kernels
+    for (size_t ke = 0; ke < code.get_kernel_matrices().size(); ke++)
+    {
+        const auto& kernel_matrix = code.get_kernel_matrices()[ke];
+        const auto kernel_size = (int)kernel_matrix.size();
+        if (kernel_size > 16)
+        {
+            std::stringstream message;
+            message << "'kernel_size' has to be smaller or equal to 16 ('kernel_size' = " << kernel_size << ").";
+            throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+
+        this->kernel_sizes[ke] = kernel_size;
+        this->rows[ke].resize(kernel_size, 0);
+        for (auto i = 0; i < kernel_size; i++)
+            for (auto j = 0; j < kernel_size; j++)
+                if (kernel_matrix[i][j]) this->rows[ke][i] |= (uint32_t)1 << j;
+
+        this->codewords[ke].resize(kernel_size);
+        for (auto i = 0; i < kernel_size; i++)
+        {
+            const auto n_next = kernel_size - i - 1;
+            this->codewords[ke][i].resize((size_t)1 << n_next, 0);
+            for (uint32_t next = 0; next < ((uint32_t)1 << n_next); next++)
+                for (auto b = 0; b < n_next; b++)
+                    if ((next >> b) & 1) this->codewords[ke][i][next] ^= this->rows[ke][i + 1 + b];
+        }
+
+        switch (kernel_size)
+        {
+            case 2:
+                this->updates[ke] = &Decoder_polar_MK_SC_fast<B, R>::template update<2>;
+                break;
+            case 3:
+                this->updates[ke] = &Decoder_polar_MK_SC_fast<B, R>::template update<3>;
+                break;
+            case 4:
+                this->updates[ke] = &Decoder_polar_MK_SC_fast<B, R>::template update<4>;
+                break;
+            case 5:
+                this->updates[ke] = &Decoder_polar_MK_SC_fast<B, R>::template update<5>;
+                break;
+            case 6:
+                this->updates[ke] = &Decoder_polar_MK_SC_fast<B, R>::template update<6>;
+                break;
+            case 7:
+                this->updates[ke] = &Decoder_polar_MK_SC_fast<B, R>::template update<7>;
+                break;
+            case 8:
+                this->updates[ke] = &Decoder_polar_MK_SC_fast<B, R>::template update<8>;
+                break;
+            default:
+                this->updates[ke] = &Decoder_polar_MK_SC_fast<B, R>::template update<0>;
+                break;
+        }
+    }
+
+    // the root of the tree uses the last stage of the code (see 'Decoder_polar_MK_SC_naive')
+    const auto n_stages = (int)code.get_stages().size();
+    this->node_sizes[0] = this->N;
+    for (auto d = 0; d < n_stages; d++)
+    {
+        this->kernel_ids[d] = (int)code.get_stages()[(n_stages - 1) - d];
+        this->node_sizes[d + 1] = this->node_sizes[d] / this->kernel_sizes[this->kernel_ids[d]];
+    }
+    for (auto d = 0; d <= n_stages; d++)
+        this->offsets[d + 1] = this->offsets[d] + this->node_sizes[d];
+
+    this->l.resize(this->offsets.back());
+    this->s.resize(this->offsets.back());
+
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+}
+
+template<typename B, typename R>
+Decoder_polar_MK_SC_fast<B, R>*
+Decoder_polar_MK_SC_fast<B, R>::clone() const
+{
+    auto m = new Decoder_polar_MK_SC_fast(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R>
+void
+Decoder_polar_MK_SC_fast<B, R>::set_frozen_bits(const std::vector<bool>& fb)
+{
+    aff3ct::tools::fb_assert(fb, this->K, this->N);
+    std::copy(fb.begin(), fb.end(), this->frozen_bits.begin());
+}
+
+template<typename B, typename R>
+const std::vector<bool>&
+Decoder_polar_MK_SC_fast<B, R>::get_frozen_bits() const
+{
+    return this->frozen_bits;
+}
+
+template<typename B, typename R>
+template<int KS>
+void
+Decoder_polar_MK_SC_fast<B, R>::update(const R* l,
+                                       const B* s,
+                                       R* l_child,
+                                       const int n_kernels,
+                                       const int kernel_size,
+                                       const uint32_t* codewords,
+                                       const int n_codewords,
+                                       const uint32_t row)
+{
+    // the fixed-point LLRs are accumulated on 32 bits and saturated
+    using A = typename std::conditional<std::is_integral<R>::value, int32_t, R>::type;
+    const auto ks = KS ? KS : kernel_size;
+
+    for (auto k = 0; k < n_kernels; k++)
+    {
+        // the LLRs of the kernel with the signs of the partial sums of the previous bits
+        // (the signs are applied with products to avoid the branches on the random bits)
+        A hl[KS ? KS : 16];
+        for (auto j = 0; j < ks; j++)
+            hl[j] = (A)(1 - 2 * (int)s[j * n_kernels + k]) * (A)l[j * n_kernels + k];
+
+        // max-log metric of the codewords with 'u_i = 0' and 'u_i = 1'
+        auto max0 = std::numeric_limits<A>::lowest();
+        auto max1 = std::numeric_limits<A>::lowest();
+        for (auto c = 0; c < n_codewords; c++)
+        {
+            A metric0 = 0, metric1 = 0;
+            for (auto j = 0; j < ks; j++)
+            {
+                const auto v = (A)(1 - 2 * (int)((codewords[c] >> j) & 1)) * hl[j];
+                metric0 += v;
+                metric1 += (A)(1 - 2 * (int)((row >> j) & 1)) * v;
+            }
+            max0 = std::max(max0, metric0);
+            max1 = std::max(max1, metric1);
+        }
+
+        // the difference of two metrics is always even
+        const A lambda = (max0 - max1) / 2;
+        if (std::is_integral<R>::value)
+            l_child[k] = (R)std::min(std::max(lambda, (A)std::numeric_limits<R>::lowest()),
+                                     (A)std::numeric_limits<R>::max());
+        else
+            l_child[k] = (R)lambda;
+    }
+}
+
+template<typename B, typename R>
+void
+Decoder_polar_MK_SC_fast<B, R>::_load(const R* Y_N)
+{
+    std::copy(Y_N, Y_N + this->N, this->l.begin());
+}
+
+template<typename B, typename R>
+void
+Decoder_polar_MK_SC_fast<B, R>::recursive_decode(const int depth)
+{
+    const auto ke = this->kernel_ids[depth];
+    const auto kernel_size = this->kernel_sizes[ke];
+    const auto n_kernels = this->node_sizes[depth + 1];
+
+    const auto l_node = this->l.data() + this->offsets[depth];
+    const auto s_node = this->s.data() + this->offsets[depth];
+    const auto l_child = this->l.data() + this->offsets[depth + 1];
+    const auto s_child = this->s.data() + this->offsets[depth + 1];
+
+    std::fill(s_node, s_node + this->node_sizes[depth], (B)0);
+    for (auto i = 0; i < kernel_size; i++)
+    {
+        this->updates[ke](l_node,
+                          s_node,
+                          l_child,
+                          n_kernels,
+                          kernel_size,
+                          this->codewords[ke][i].data(),
+                          (int)this->codewords[ke][i].size(),
+                          this->rows[ke][i]);
+
+        if (depth + 1 == (int)this->kernel_ids.size()) // leaf
+        {
+            s_child[0] = !this->frozen_bits[this->leaf] && tools::h_LLR<B, R>(l_child[0]);
+            this->u[this->leaf++] = s_child[0];
+        }
+        else
+            this->recursive_decode(depth + 1);
+
+        // re-encode the partial sums of the decoded child
+        for (auto j = 0; j < kernel_size; j++)
+            if ((this->rows[ke][i] >> j) & 1)
+                for (auto k = 0; k < n_kernels; k++)
+                    s_node[j * n_kernels + k] ^= s_child[k];
+    }
+}
+
+template<typename B, typename R>
+void
+Decoder_polar_MK_SC_fast<B, R>::_decode()
+{
+    this->leaf = 0;
+    if (this->kernel_ids.size())
+        this->recursive_decode(0);
+    else
+        this->s[0] = this->u[0] = !this->frozen_bits[0] && tools::h_LLR<B, R>(this->l[0]);
+}
+
+template<typename B, typename R>
+int
+Decoder_polar_MK_SC_fast<B, R>::_decode_siho(const R* Y_N, B* V_K, const size_t frame_id)
+{
+    this->_load(Y_N);
+    this->_decode();
+    this->_store(V_K);
+
+    return 0;
+}
+
+template<typename B, typename R>
+int
+Decoder_polar_MK_SC_fast<B, R>::_decode_siho_cw(const R* Y_N, B* V_N, const size_t frame_id)
+{
+    this->_load(Y_N);
+    this->_decode();
+    this->_store(V_N, true);
+
+    return 0;
+}
+
+template<typename B, typename R>
+void
+Decoder_polar_MK_SC_fast<B, R>::_store(B* V, bool coded) const
+{
+    if (!coded)
+    {
+        auto k = 0;
+        for (auto i = 0; i < this->N; i++)
+            if (!this->frozen_bits[i]) V[k++] = this->u[i];
+    }
+    else
+        std::copy(this->s.begin(), this->s.begin() + this->N, V);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_polar_MK_SC_fast<B_8, Q_8>;
+template class aff3ct::module::Decoder_polar_MK_SC_fast<B_16, Q_16>;
+template class aff3ct::module::Decoder_polar_MK_SC_fast<B_32, Q_32>;
+template class aff3ct::module::Decoder_polar_MK_SC_fast<B_64, Q_64>;
+#else
+template class aff3ct::module::Decoder_polar_MK_SC_fast<B, Q>;
+#endif
+// ==================================================================================== explicit template instantiation
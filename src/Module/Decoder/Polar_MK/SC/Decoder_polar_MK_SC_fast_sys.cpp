@@ -0,0 +1,64 @@
+#include <algorithm>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+
+#include "Module/Decoder/Polar_MK/SC/Decoder_polar_MK_SC_fast_sys.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template<typename B, typename R>
+Decoder_polar_MK_SC_fast_sys<B, R>::Decoder_polar_MK_SC_fast_sys(const int& K,
+                                                                 const int& N,
+                                                                 const tools::Polar_code& code,
+                                                                 const std::vector<bool>& frozen_bits)
+  : Decoder_polar_MK_SC_fast<B, R>(K, N, code, frozen_bits)
+{
+    const std::string name = "Decoder_polar_MK_SC_fast_sys";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    if (!code.can_be_systematic())
+    {
+        std::stringstream message;
+        message << "This polar code does not support systematic encoding.";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+}
+
+template<typename B, typename R>
+Decoder_polar_MK_SC_fast_sys<B, R>*
+Decoder_polar_MK_SC_fast_sys<B, R>::clone() const
+{
+    auto m = new Decoder_polar_MK_SC_fast_sys(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R>
+void
+Decoder_polar_MK_SC_fast_sys<B, R>::_store(B* V, bool coded) const
+{
+    if (!coded)
+    {
+        auto k = 0;
+        for (auto i = 0; i < this->N; i++)
+            if (!this->frozen_bits[i]) V[k++] = this->s[i];
+    }
+    else
+        std::copy(this->s.begin(), this->s.begin() + this->N, V);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_polar_MK_SC_fast_sys<B_8, Q_8>;
+template class aff3ct::module::Decoder_polar_MK_SC_fast_sys<B_16, Q_16>;
+template class aff3ct::module::Decoder_polar_MK_SC_fast_sys<B_32, Q_32>;
+template class aff3ct::module::Decoder_polar_MK_SC_fast_sys<B_64, Q_64>;
+#else
+template class aff3ct::module::Decoder_polar_MK_SC_fast_sys<B, Q>;
+#endif
+// ==================================================================================== explicit template instantiation
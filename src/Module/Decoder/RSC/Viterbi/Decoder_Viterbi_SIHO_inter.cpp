@@ -0,0 +1,326 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+#include <type_traits>
+
+#include "Module/Decoder/RSC/Viterbi/Decoder_Viterbi_SIHO_inter.hpp"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+// metric of the states that cannot be reached
+template<typename R>
+static inline R
+viterbi_inf()
+{
+    return std::numeric_limits<R>::has_infinity ? std::numeric_limits<R>::infinity() : std::numeric_limits<R>::max();
+}
+
+// the trellis is checked before the number of states is used in the initialization list
+static int
+get_n_states(const std::vector<std::vector<int>>& trellis)
+{
+    if (trellis.size() < 10)
+    {
+        std::stringstream message;
+        message << "'trellis.size()' has to be equal or greater than 10 ('trellis.size()' = " << trellis.size()
+                << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    const auto n_states = static_cast<int>(trellis[0].size());
+    if (n_states < 2 || (n_states & (n_states - 1)))
+    {
+        std::stringstream message;
+        message << "'n_states' has to be a power of 2 greater than 1 ('n_states' = " << n_states << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    return n_states;
+}
+
+// the branch metrics are in ['-2 * sat', '2 * sat'], the normalized metrics differ by at most '4 * n_memories * sat'
+// and the closing steps (not normalized) add up to '2 * n_memories * sat': the fixed-point LLRs are saturated to keep
+// the metrics in the range of 'R'
+template<typename R>
+static inline R
+get_llr_sat(const int n_memories)
+{
+    if (std::is_floating_point<R>::value) return (R)100;
+    return (R)std::min(100, (int)std::numeric_limits<R>::max() / (6 * n_memories));
+}
+
+template<typename B, typename R>
+Decoder_Viterbi_SIHO_inter<B, R>::Decoder_Viterbi_SIHO_inter(const int K,
+                                                             const std::vector<std::vector<int>>& trellis,
+                                                             const bool is_closed)
+  : Decoder_SIHO<B, R>(K, is_closed ? 2 * K + 2 * static_cast<int>(std::log2(get_n_states(trellis))) : 2 * K)
+  , n_states(get_n_states(trellis))
+  , n_memories(static_cast<int>(std::log2(n_states)))
+  , is_closed(is_closed)
+  , n_steps(is_closed ? K + n_memories : K)
+  , n_bits(8 * (int)sizeof(B) - 1)
+  , n_words((n_states + n_bits - 1) / n_bits)
+  , llr_sat(get_llr_sat<R>(n_memories))
+  , in_prev(2 * n_states)
+  , in_bits(2 * n_states)
+  , in_out(2 * n_states)
+  , in_valid(2 * n_memories * 2 * n_states, true)
+  , in_ties(2 * n_memories * n_states, false)
+  , Y_N_inter(this->N * mipp::N<R>())
+  , metrics{ mipp::vector<R>(n_states * mipp::N<R>()), mipp::vector<R>(n_states * mipp::N<R>()) }
+  , survivors((size_t)n_steps * n_words * mipp::N<R>())
+{
+    const std::string name = "Decoder_Viterbi_SIHO_inter";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    this->set_n_frames_per_wave(mipp::N<R>());
+
+    // next state and parity bit with the input bit 'b': 'T[b][previous_state]' and 'C[b][previous_state]'
+    const std::vector<int>* T[2] = { &trellis[6], &trellis[8] };
+    const std::vector<int>* C[2] = { &trellis[7], &trellis[9] };
+
+    // the transitions leading to each state, sorted by input bit (the input bit 0 wins the ties as in
+    // 'Decoder_Viterbi_SIHO') and by previous state
+    std::vector<int> n_in(n_states, 0);
+    for (auto b = 0; b < 2; b++)
+        for (auto p = 0; p < n_states; p++)
+        {
+            const auto n = (*T[b])[p];
+            if (n < 0 || n >= n_states || n_in[n] == 2)
+            {
+                std::stringstream message;
+                message << "Each state has to be reached by two transitions ('n_states' = " << n_states << ").";
+                throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+            }
+            const auto k = 2 * n + n_in[n]++;
+            this->in_prev[k] = p;
+            this->in_bits[k] = b;
+            this->in_out[k] = 2 * b + (b ^ (*C[b])[p]); // the systematic bit is the input bit
+        }
+
+    // group the transitions by butterflies: two previous states leading to the same two next states
+    std::vector<bool> done(n_states, false);
+    for (auto n0 = 0; n0 < n_states; n0++)
+    {
+        if (done[n0]) continue;
+
+        const auto p0 = this->in_prev[2 * n0 + 0];
+        const auto p1 = this->in_prev[2 * n0 + 1];
+
+        auto n1 = -1;
+        for (auto n = n0 + 1; n < n_states && n1 == -1; n++)
+            if (!done[n] && ((this->in_prev[2 * n] == p0 && this->in_prev[2 * n + 1] == p1) ||
+                             (this->in_prev[2 * n] == p1 && this->in_prev[2 * n + 1] == p0)))
+                n1 = n;
+
+        if (p0 == p1 || n1 == -1)
+        {
+            std::stringstream message;
+            message << "The transitions of the trellis have to form butterflies ('n_states' = " << n_states << ").";
+            throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+
+        done[n0] = done[n1] = true;
+        this->bf_prev.push_back(p0);
+        this->bf_prev.push_back(p1);
+        this->bf_next.push_back(n0);
+        this->bf_next.push_back(n1);
+        this->bf_from.push_back(0);
+        this->bf_from.push_back(this->in_prev[2 * n1] == p0 ? 0 : 1);
+    }
+
+    // the closing transitions go to the smallest next state, the first steps start from the state 0
+    std::vector<int> closing_inputs(n_states);
+    for (auto p = 0; p < n_states; p++)
+        closing_inputs[p] = (*T[0])[p] < (*T[1])[p] ? 0 : 1;
+
+    std::vector<bool> reachable(n_states, false), reachable_next(n_states);
+    reachable[0] = true;
+    for (auto t = 0; t < n_steps; t++)
+    {
+        const auto v = this->valid_idx(t);
+        if (v == -1) continue; // all the states are reachable
+
+        std::fill(reachable_next.begin(), reachable_next.end(), false);
+        for (auto n = 0; n < n_states; n++)
+            for (auto k = 0; k < 2; k++)
+            {
+                const auto p = this->in_prev[2 * n + k];
+                const auto is_valid = reachable[p] && (t < K || closing_inputs[p] == this->in_bits[2 * n + k]);
+                this->in_valid[(v * n_states + n) * 2 + k] = is_valid;
+                reachable_next[n] = reachable_next[n] || is_valid;
+            }
+        // 'Decoder_Viterbi_SIHO' closes the trellis from the smallest previous state first
+        if (t >= K)
+            for (auto n = 0; n < n_states; n++)
+                this->in_ties[v * n_states + n] = this->in_prev[2 * n + 1] < this->in_prev[2 * n + 0];
+        std::swap(reachable, reachable_next);
+    }
+}
+
+template<typename B, typename R>
+Decoder_Viterbi_SIHO_inter<B, R>*
+Decoder_Viterbi_SIHO_inter<B, R>::clone() const
+{
+    auto m = new Decoder_Viterbi_SIHO_inter(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+// index of the step 't' in 'in_valid', -1 if all the transitions are valid
+template<typename B, typename R>
+int
+Decoder_Viterbi_SIHO_inter<B, R>::valid_idx(const int t) const
+{
+    if (t < this->n_memories) return t;
+    if (t >= this->K) return this->n_memories + t - this->K;
+    return -1;
+}
+
+template<typename B, typename R>
+void
+Decoder_Viterbi_SIHO_inter<B, R>::_load(const R* Y_N)
+{
+    constexpr auto n_frames = mipp::N<R>();
+
+    std::vector<const R*> frames(n_frames);
+    for (auto f = 0; f < n_frames; f++)
+        frames[f] = Y_N + f * this->N;
+    tools::Reorderer_static<R, n_frames>::apply(frames, this->Y_N_inter.data(), this->N);
+}
+
+// add-compare-select of all the states at the step 't', the first and the closing steps are MASKED (some transitions
+// are not valid)
+template<typename B, typename R>
+template<bool MASKED>
+void
+Decoder_Viterbi_SIHO_inter<B, R>::_acs(const int t)
+{
+    constexpr auto n_lanes = mipp::N<R>();
+
+    const auto r_sat_p = mipp::Reg<R>(this->llr_sat);
+    const auto r_sat_n = mipp::Reg<R>((R)-this->llr_sat);
+    const auto r_y0 = mipp::min(mipp::max(mipp::Reg<R>(&this->Y_N_inter[(2 * t + 0) * n_lanes]), r_sat_n), r_sat_p);
+    const auto r_y1 = mipp::min(mipp::max(mipp::Reg<R>(&this->Y_N_inter[(2 * t + 1) * n_lanes]), r_sat_n), r_sat_p);
+    const mipp::Reg<R> r_bm[4] = { mipp::Reg<R>((R)0), r_y1, r_y0, r_y0 + r_y1 };
+    const auto r_inf = mipp::Reg<R>(viterbi_inf<R>());
+    const auto r_zero = mipp::Reg<B>((B)0);
+
+    const auto m_prev = this->metrics[(t + 0) & 1].data();
+    const auto m_next = this->metrics[(t + 1) & 1].data();
+    const auto surv = this->survivors.data() + (size_t)t * this->n_words * n_lanes;
+    const auto valid = MASKED ? this->valid_idx(t) * this->n_states * 2 : 0;
+
+    std::fill(surv, surv + this->n_words * n_lanes, (B)0);
+    for (auto bf = 0; bf < this->n_states / 2; bf++)
+    {
+        const mipp::Reg<R> r_prev[2] = { &m_prev[this->bf_prev[2 * bf + 0] * n_lanes],
+                                         &m_prev[this->bf_prev[2 * bf + 1] * n_lanes] };
+        for (auto i = 0; i < 2; i++)
+        {
+            const auto n = this->bf_next[2 * bf + i];
+            const auto from = this->bf_from[2 * bf + i];
+
+            auto r_c0 = r_prev[from ^ 0] + r_bm[this->in_out[2 * n + 0]];
+            auto r_c1 = r_prev[from ^ 1] + r_bm[this->in_out[2 * n + 1]];
+            if (MASKED)
+            {
+                if (!this->in_valid[valid + 2 * n + 0]) r_c0 = r_inf;
+                if (!this->in_valid[valid + 2 * n + 1]) r_c1 = r_inf;
+            }
+
+            // the first transition wins the ties
+            const auto m_dec = MASKED && this->in_ties[valid / 2 + n] ? r_c1 <= r_c0 : r_c1 < r_c0;
+            mipp::min(r_c0, r_c1).store(&m_next[n * n_lanes]);
+
+            const auto w = n / this->n_bits;
+            const auto r_bit = mipp::Reg<B>((B)((B)1 << (n % this->n_bits)));
+            const auto r_surv = mipp::Reg<B>(&surv[w * n_lanes]) | mipp::blend(r_bit, r_zero, m_dec);
+            r_surv.store(&surv[w * n_lanes]);
+        }
+    }
+
+    // the fixed-point metrics are kept close to 0, this is not needed in the MASKED steps (there are few of them and
+    // the unreachable states are saturated)
+    if (!MASKED && !std::is_floating_point<R>::value)
+    {
+        auto r_min = mipp::Reg<R>(&m_next[0]);
+        for (auto s = 1; s < this->n_states; s++)
+            r_min = mipp::min(r_min, mipp::Reg<R>(&m_next[s * n_lanes]));
+        for (auto s = 0; s < this->n_states; s++)
+            (mipp::Reg<R>(&m_next[s * n_lanes]) - r_min).store(&m_next[s * n_lanes]);
+    }
+}
+
+template<typename B, typename R>
+void
+Decoder_Viterbi_SIHO_inter<B, R>::_forward_pass()
+{
+    constexpr auto n_lanes = mipp::N<R>();
+
+    const auto r_inf = mipp::Reg<R>(viterbi_inf<R>());
+    for (auto s = 1; s < this->n_states; s++)
+        r_inf.store(&this->metrics[0][s * n_lanes]);
+    mipp::Reg<R>((R)0).store(&this->metrics[0][0]);
+
+    for (auto t = 0; t < this->n_steps; t++)
+        if (this->valid_idx(t) != -1)
+            this->template _acs<true>(t);
+        else
+            this->template _acs<false>(t);
+}
+
+template<typename B, typename R>
+void
+Decoder_Viterbi_SIHO_inter<B, R>::_backwards_pass(B* V_K)
+{
+    constexpr auto n_lanes = mipp::N<R>();
+
+    const auto m_last = this->metrics[this->n_steps & 1].data();
+    for (auto f = 0; f < n_lanes; f++)
+    {
+        // the closed trellis ends in the state 0, else the traceback starts from the best state
+        auto state = 0;
+        if (!this->is_closed)
+            for (auto s = 1; s < this->n_states; s++)
+                if (m_last[s * n_lanes + f] < m_last[state * n_lanes + f]) state = s;
+
+        for (auto t = this->n_steps - 1; t >= 0; t--)
+        {
+            const auto word = this->survivors[((size_t)t * this->n_words + state / this->n_bits) * n_lanes + f];
+            const auto k = 2 * state + (int)((word >> (state % this->n_bits)) & 1);
+            if (t < this->K) V_K[f * this->K + t] = (B)this->in_bits[k];
+            state = this->in_prev[k];
+        }
+    }
+}
+
+template<typename B, typename R>
+int
+Decoder_Viterbi_SIHO_inter<B, R>::_decode_siho(const R* Y_N, B* V_K, const size_t frame_id)
+{
+    this->_load(Y_N);
+    this->_forward_pass();
+    this->_backwards_pass(V_K);
+
+    return 0;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_Viterbi_SIHO_inter<B_8, Q_8>;
+template class aff3ct::module::Decoder_Viterbi_SIHO_inter<B_16, Q_16>;
+template class aff3ct::module::Decoder_Viterbi_SIHO_inter<B_32, Q_32>;
+template class aff3ct::module::Decoder_Viterbi_SIHO_inter<B_64, Q_64>;
+#else
+template class aff3ct::module::Decoder_Viterbi_SIHO_inter<B, Q>;
+#endif
+// ==================================================================================== explicit template instantiation
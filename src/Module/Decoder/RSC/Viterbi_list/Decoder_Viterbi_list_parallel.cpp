@@ -36,7 +36,7 @@ Decoder_Viterbi_list_parallel<B, Q>::Decoder_Viterbi_list_parallel(const int K,
   , m_T_inv({ std::vector<int>(m_n_states), std::vector<int>(m_n_states) })
   , m_C({ std::vector<int>(m_n_states), std::vector<int>(m_n_states) })
   , m_P(std::vector<Q>(L * m_n_states * (m_n_steps + 1)))
-  , m_branch_metr(std::vector<Q>((m_K + m_n_memories) * m_n_states))
+  , m_branch_metr(std::vector<Q>(m_n_states * m_n_states))
   , m_backwards_path(std::vector<int>(L * m_n_states * (m_n_steps + 1)))
   , m_previous_rank(std::vector<int>(L * m_n_states * (m_n_steps + 1)))
   , m_step_result(std::vector<Q>(L * m_n_states))
@@ -159,19 +159,23 @@ Decoder_Viterbi_list_parallel<B, Q>::__reset()
 }
 
 // https://stackoverflow.com/a/12399290
-// Trie les indices d'un vecteur en fonction de ses valeurs
+// Trie les indices d'un vecteur en fonction de ses valeurs, seuls les n premiers indices sont tries (dans le meme
+// ordre qu'avec un tri stable)
 template<typename T>
 std::vector<size_t>
-argsort(const std::vector<T>& v)
+argsort(const std::vector<T>& v, const size_t n)
 {
 
     std::vector<size_t> idx(v.size());
     // Remplit le vecteur de valeurs croissantes, demarrant a 0
     std::iota(idx.begin(), idx.end(), 0);
 
-    // Trie les valeurs de idx.begin() a idx.end() selon la condition
-    // specifiee sur les valeurs de v
-    std::stable_sort(idx.begin(), idx.end(), [&v](size_t i1, size_t i2) { return v[i1] < v[i2]; });
+    // Trie les valeurs de idx.begin() a idx.begin() + n selon la condition
+    // specifiee sur les valeurs de v, les egalites sont departagees par les indices
+    std::partial_sort(idx.begin(),
+                      idx.begin() + std::min(n, idx.size()),
+                      idx.end(),
+                      [&v](size_t i1, size_t i2) { return v[i1] < v[i2] || (!(v[i2] < v[i1]) && i1 < i2); });
 
     return idx;
 }
@@ -240,8 +244,8 @@ template<typename B, typename Q>
 void
 Decoder_Viterbi_list_parallel<B, Q>::_process_step(const int i_step, const int i_next_state)
 {
-    // Tri des valeurs dans step_result
-    std::vector<size_t> idx_minima = argsort(m_step_result);
+    // Tri des L plus petites valeurs dans step_result
+    std::vector<size_t> idx_minima = argsort(m_step_result, (size_t)m_L);
 
     // Separation des indices en rang et en etats precedents
     for (auto l = 0; l < m_L; l++)
@@ -280,7 +284,7 @@ Decoder_Viterbi_list_parallel<B, Q>::__forward_pass_closing(const Q* Y_N)
     //  L'indicateur 'g' indique une variable globale
     int n_memories_set_to_0 = 0;
 
-    for (auto i_step = m_K + 1; i_step <= m_K + m_n_memories + 1; i_step++)
+    for (auto i_step = m_K + 1; i_step <= m_K + m_n_memories; i_step++)
     {
         std::array<Q, 2> channel_input{ Y_N[2 * (i_step - 1)], Y_N[2 * (i_step - 1) + 1] };
 
@@ -307,14 +311,13 @@ Decoder_Viterbi_list_parallel<B, Q>::__forward_pass_closing(const Q* Y_N)
                         {
                             const Q node_weight = m_P[prev_node_idx];
 
-                            Q branch_weight = m_branch_metr[i_next_state * (m_K + m_n_memories) + previous_state];
+                            Q branch_weight = m_branch_metr[i_next_state * m_n_states + previous_state];
 
                             if (branch_weight == gDOUBLE_INF) // pas calcule
                             {
                                 const std::vector<Q> output = m_bin_vals[2 * bit_sys + m_C[bit_sys][previous_state]];
                                 branch_weight = channel_input[0] * output[0] + channel_input[1] * output[1];
-                                m_branch_metr[i_next_state * (m_K + m_n_memories) + previous_state] =
-                                  branch_weight; // stockage
+                                m_branch_metr[i_next_state * m_n_states + previous_state] = branch_weight; // stockage
                             }
 
                             const Q new_weight = node_weight + branch_weight;
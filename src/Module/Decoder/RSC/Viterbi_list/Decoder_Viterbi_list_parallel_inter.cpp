@@ -0,0 +1,381 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+#include <type_traits>
+
+#include "Module/Decoder/RSC/Viterbi_list/Decoder_Viterbi_list_parallel_inter.hpp"
+#include "Tools/Perf/Reorderer/Reorderer.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+// metric of the paths that do not exist
+template<typename R>
+static inline R
+viterbi_inf()
+{
+    return std::numeric_limits<R>::has_infinity ? std::numeric_limits<R>::infinity() : std::numeric_limits<R>::max();
+}
+
+// the trellis is checked before the number of states is used in the initialization list
+static int
+get_n_states(const std::vector<std::vector<int>>& trellis)
+{
+    if (trellis.size() < 10)
+    {
+        std::stringstream message;
+        message << "'trellis.size()' has to be equal or greater than 10 ('trellis.size()' = " << trellis.size()
+                << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    const auto n_states = static_cast<int>(trellis[0].size());
+    if (n_states < 2 || (n_states & (n_states - 1)))
+    {
+        std::stringstream message;
+        message << "'n_states' has to be a power of 2 greater than 1 ('n_states' = " << n_states << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    return n_states;
+}
+
+static int
+get_n_sorted(const int L)
+{
+    if (L < 1)
+    {
+        std::stringstream message;
+        message << "'L' has to be greater than 0 ('L' = " << L << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    auto n_sorted = 1;
+    while (n_sorted < L)
+        n_sorted *= 2;
+    return n_sorted;
+}
+
+// the branch metrics are in ['-2 * sat', '2 * sat'] and the 'L' best paths of a state differ from the best path only
+// in the last 'n_memories + log2(L)' steps: the normalized metrics differ by at most '4 * (n_memories + log2(L)) * sat'
+// and the closing steps can add '4 * n_memories * sat', the fixed-point LLRs are saturated to keep the metrics in the
+// range of 'R'
+template<typename R>
+static inline R
+get_llr_sat(const int n_memories, const int n_sorted)
+{
+    if (std::is_floating_point<R>::value) return (R)0; // not used, the LLRs are not saturated
+    const auto log_L = (int)std::log2(n_sorted);
+    return (R)std::max(1, std::min(100, (int)std::numeric_limits<R>::max() / (4 * (2 * n_memories + log_L + 1))));
+}
+
+template<typename B, typename R>
+Decoder_Viterbi_list_parallel_inter<B, R>::Decoder_Viterbi_list_parallel_inter(
+  const int K,
+  const int L,
+  const CRC<B>& crc,
+  const std::vector<std::vector<int>>& trellis)
+  : Decoder_SIHO<B, R>(K, 2 * K + 2 * static_cast<int>(std::log2(get_n_states(trellis))))
+  , n_states(get_n_states(trellis))
+  , n_memories(static_cast<int>(std::log2(n_states)))
+  , L(L)
+  , n_steps(K + n_memories)
+  , n_sorted(get_n_sorted(L))
+  , n_bits(8 * (int)sizeof(B) - 1)
+  , w_idx(1 + static_cast<int>(std::log2(n_sorted)))
+  , n_fields(std::max(1, n_bits / w_idx))
+  , n_words((L + n_fields - 1) / n_fields)
+  , llr_sat(get_llr_sat<R>(n_memories, n_sorted))
+  , in_prev(2 * n_states)
+  , in_bits(2 * n_states)
+  , in_out(2 * n_states)
+  , Y_N_inter(this->N * mipp::N<R>())
+  , metrics{ mipp::vector<R>(n_states * L * mipp::N<R>()), mipp::vector<R>(n_states * L * mipp::N<R>()) }
+  , net_metrics(n_sorted * mipp::N<R>())
+  , net_idx(n_sorted * mipp::N<R>())
+  , survivors((size_t)n_steps * n_states * n_words * mipp::N<R>())
+  , path(K)
+  , crc(crc.clone())
+{
+    const std::string name = "Decoder_Viterbi_list_parallel_inter";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    this->set_n_frames_per_wave(mipp::N<R>());
+
+    // the indexes of the merge network are stored on 'B'
+    if (2 * n_sorted - 1 > std::numeric_limits<B>::max())
+    {
+        std::stringstream message;
+        message << "'2 * L - 1' has to be equal or smaller than 'std::numeric_limits<B>::max()' ('L' = " << L
+                << ", 'std::numeric_limits<B>::max()' = " << +std::numeric_limits<B>::max() << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->crc->get_size() > K)
+    {
+        std::stringstream message;
+        message << "'crc->get_size()' has to be equal or smaller than 'K' ('crc->get_size()' = "
+                << this->crc->get_size() << ", 'K' = " << K << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    // next state and parity bit with the input bit 'b': 'T[b][previous_state]' and 'C[b][previous_state]'
+    const std::vector<int>* T[2] = { &trellis[6], &trellis[8] };
+    const std::vector<int>* C[2] = { &trellis[7], &trellis[9] };
+
+    std::vector<int> n_in(n_states, 0);
+    for (auto b = 0; b < 2; b++)
+        for (auto p = 0; p < n_states; p++)
+        {
+            const auto n = (*T[b])[p];
+            if (n < 0 || n >= n_states || n_in[n] == 2)
+            {
+                std::stringstream message;
+                message << "Each state has to be reached by two transitions ('n_states' = " << n_states << ").";
+                throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+            }
+            const auto k = 2 * n + n_in[n]++;
+            this->in_prev[k] = p;
+            this->in_bits[k] = b;
+            this->in_out[k] = 2 * b + (b ^ (*C[b])[p]); // the systematic bit is the input bit
+        }
+
+    // 'Decoder_Viterbi_list_parallel' breaks the ties by the smallest previous state: the two transitions leading to
+    // a state are sorted by previous state
+    for (auto n = 0; n < n_states; n++)
+    {
+        if (this->in_prev[2 * n + 0] == this->in_prev[2 * n + 1])
+        {
+            std::stringstream message;
+            message << "The two transitions leading to a state have to come from two different states ('n_states' = "
+                    << n_states << ").";
+            throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+
+        if (this->in_prev[2 * n + 1] < this->in_prev[2 * n + 0])
+        {
+            std::swap(this->in_prev[2 * n + 0], this->in_prev[2 * n + 1]);
+            std::swap(this->in_bits[2 * n + 0], this->in_bits[2 * n + 1]);
+            std::swap(this->in_out[2 * n + 0], this->in_out[2 * n + 1]);
+        }
+    }
+}
+
+template<typename B, typename R>
+Decoder_Viterbi_list_parallel_inter<B, R>*
+Decoder_Viterbi_list_parallel_inter<B, R>::clone() const
+{
+    auto m = new Decoder_Viterbi_list_parallel_inter(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R>
+void
+Decoder_Viterbi_list_parallel_inter<B, R>::deep_copy(const Decoder_Viterbi_list_parallel_inter<B, R>& m)
+{
+    spu::module::Stateful::deep_copy(m);
+    if (m.crc != nullptr) this->crc.reset(m.crc->clone());
+}
+
+template<typename B, typename R>
+void
+Decoder_Viterbi_list_parallel_inter<B, R>::_load(const R* Y_N)
+{
+    constexpr auto n_frames = mipp::N<R>();
+
+    std::vector<const R*> frames(n_frames);
+    for (auto f = 0; f < n_frames; f++)
+        frames[f] = Y_N + f * this->N;
+    tools::Reorderer_static<R, n_frames>::apply(frames, this->Y_N_inter.data(), this->N);
+}
+
+// the 'L' best paths of the state 's' at the step 't + 1': the first 'L' candidates of the two sorted lists of the
+// previous states
+template<typename B, typename R>
+void
+Decoder_Viterbi_list_parallel_inter<B, R>::_merge(const int t, const int s, const mipp::Reg<R> r_bm[4])
+{
+    constexpr auto n_lanes = mipp::N<R>();
+
+    const auto r_inf = mipp::Reg<R>(viterbi_inf<R>());
+    const auto m_prev = this->metrics[(t + 0) & 1].data();
+    const auto m_next = this->metrics[(t + 1) & 1].data();
+    const auto v = this->net_metrics.data();
+    const auto x = this->net_idx.data();
+
+    // candidate 'r' of the transition 'k', the lists are padded with infinite metrics up to 'n_sorted'
+    const auto cand = [&](const int k, const int r) -> mipp::Reg<R> {
+        if (r >= this->L) return r_inf;
+        const auto r_prev = mipp::Reg<R>(&m_prev[(this->in_prev[2 * s + k] * this->L + r) * n_lanes]);
+        const auto r_cand = r_prev + r_bm[this->in_out[2 * s + k]];
+        // the paths that do not exist keep their fixed-point metric (the additions may not saturate)
+        return std::is_floating_point<R>::value ? r_cand : mipp::blend(r_inf, r_cand, r_prev == r_inf);
+    };
+
+    // the candidates are ordered by metric, by rank and by transition: the index '2 * r + k' breaks the ties, the
+    // list of the transition 0 ascending and the list of the transition 1 descending form a bitonic sequence whose
+    // 'n_sorted' smallest elements are selected by one step of comparisons
+    for (auto i = 0; i < this->n_sorted; i++)
+    {
+        const auto j = this->n_sorted - 1 - i;
+        const auto r_c0 = cand(0, i);
+        const auto r_c1 = cand(1, j);
+        const auto m_c1 = j < i ? r_c1 <= r_c0 : r_c1 < r_c0;
+        mipp::blend(r_c1, r_c0, m_c1).store(&v[i * n_lanes]);
+        mipp::blend(mipp::Reg<B>((B)(2 * j + 1)), mipp::Reg<B>((B)(2 * i + 0)), m_c1).store(&x[i * n_lanes]);
+    }
+
+    // the bitonic sequence is sorted
+    for (auto h = this->n_sorted / 2; h > 0; h /= 2)
+        for (auto i = 0; i < this->n_sorted; i++)
+            if ((i & h) == 0)
+            {
+                const auto r_v0 = mipp::Reg<R>(&v[(i + 0) * n_lanes]);
+                const auto r_v1 = mipp::Reg<R>(&v[(i + h) * n_lanes]);
+                const auto r_x0 = mipp::Reg<B>(&x[(i + 0) * n_lanes]);
+                const auto r_x1 = mipp::Reg<B>(&x[(i + h) * n_lanes]);
+                const auto m_swap = (r_v1 < r_v0) | ((r_v1 == r_v0) & (r_x1 < r_x0));
+                mipp::blend(r_v1, r_v0, m_swap).store(&v[(i + 0) * n_lanes]);
+                mipp::blend(r_v0, r_v1, m_swap).store(&v[(i + h) * n_lanes]);
+                mipp::blend(r_x1, r_x0, m_swap).store(&x[(i + 0) * n_lanes]);
+                mipp::blend(r_x0, r_x1, m_swap).store(&x[(i + h) * n_lanes]);
+            }
+
+    const auto surv = this->survivors.data() + ((size_t)t * this->n_states + s) * this->n_words * n_lanes;
+    for (auto w = 0; w < this->n_words; w++)
+    {
+        auto r_word = mipp::Reg<B>((B)0);
+        for (auto f = 0; f < this->n_fields && w * this->n_fields + f < this->L; f++)
+            r_word = r_word | mipp::lshift(mipp::Reg<B>(&x[(w * this->n_fields + f) * n_lanes]), f * this->w_idx);
+        r_word.store(&surv[w * n_lanes]);
+    }
+    std::copy(v, v + this->L * n_lanes, &m_next[s * this->L * n_lanes]);
+}
+
+// add-compare-select of all the states at the step 't'
+template<typename B, typename R>
+void
+Decoder_Viterbi_list_parallel_inter<B, R>::_acs(const int t)
+{
+    constexpr auto n_lanes = mipp::N<R>();
+
+    auto r_y0 = mipp::Reg<R>(&this->Y_N_inter[(2 * t + 0) * n_lanes]);
+    auto r_y1 = mipp::Reg<R>(&this->Y_N_inter[(2 * t + 1) * n_lanes]);
+    if (!std::is_floating_point<R>::value)
+    {
+        const auto r_sat_p = mipp::Reg<R>(this->llr_sat);
+        const auto r_sat_n = mipp::Reg<R>((R)-this->llr_sat);
+        r_y0 = mipp::min(mipp::max(r_y0, r_sat_n), r_sat_p);
+        r_y1 = mipp::min(mipp::max(r_y1, r_sat_n), r_sat_p);
+    }
+    const mipp::Reg<R> r_bm[4] = { mipp::Reg<R>((R)0), r_y1, r_y0, r_y0 + r_y1 };
+    const auto r_inf = mipp::Reg<R>(viterbi_inf<R>());
+    const auto m_next = this->metrics[(t + 1) & 1].data();
+
+    // as in 'Decoder_Viterbi_list_parallel', the closing step 'c' (from 1 to 'n_memories') only reaches the states
+    // smaller than '2^(n_memories - c)'
+    const auto n_reached = t < this->K ? this->n_states : 1 << (this->n_memories - (t - this->K + 1));
+    for (auto s = 0; s < n_reached; s++)
+        this->_merge(t, s, r_bm);
+
+    const auto surv = this->survivors.data() + (size_t)t * this->n_states * this->n_words * n_lanes;
+    std::fill(&surv[n_reached * this->n_words * n_lanes], &surv[this->n_states * this->n_words * n_lanes], (B)0);
+    for (auto i = n_reached * this->L; i < this->n_states * this->L; i++)
+        r_inf.store(&m_next[i * n_lanes]);
+
+    // the fixed-point metrics are kept close to 0, the best path of each lane is the first one of a state
+    if (!std::is_floating_point<R>::value)
+    {
+        auto r_min = mipp::Reg<R>(&m_next[0]);
+        for (auto s = 1; s < n_reached; s++)
+            r_min = mipp::min(r_min, mipp::Reg<R>(&m_next[s * this->L * n_lanes]));
+        for (auto i = 0; i < n_reached * this->L; i++)
+        {
+            const auto r_met = mipp::Reg<R>(&m_next[i * n_lanes]);
+            mipp::blend(r_met, r_met - r_min, r_met == r_inf).store(&m_next[i * n_lanes]);
+        }
+    }
+}
+
+template<typename B, typename R>
+void
+Decoder_Viterbi_list_parallel_inter<B, R>::_forward_pass()
+{
+    // the trellis starts with a single path in the state 0
+    std::fill(this->metrics[0].begin(), this->metrics[0].end(), viterbi_inf<R>());
+    mipp::Reg<R>((R)0).store(&this->metrics[0][0]);
+
+    for (auto t = 0; t < this->n_steps; t++)
+        this->_acs(t);
+}
+
+// decoded bits of the path of rank 'l' ending in the state 0, in the lane 'f'
+template<typename B, typename R>
+void
+Decoder_Viterbi_list_parallel_inter<B, R>::_trace(const int f, const int l)
+{
+    constexpr auto n_lanes = mipp::N<R>();
+    const auto mask = (1 << this->w_idx) - 1;
+
+    auto state = 0, rank = l;
+    for (auto t = this->n_steps - 1; t >= 0; t--)
+    {
+        const auto w = ((size_t)t * this->n_states + state) * this->n_words + rank / this->n_fields;
+        const auto idx = (int)((this->survivors[w * n_lanes + f] >> ((rank % this->n_fields) * this->w_idx)) & mask);
+        const auto k = 2 * state + (idx & 1);
+        if (t < this->K) this->path[t] = (B)this->in_bits[k];
+        state = this->in_prev[k];
+        rank = idx >> 1;
+    }
+}
+
+template<typename B, typename R>
+void
+Decoder_Viterbi_list_parallel_inter<B, R>::_backwards_pass(B* V_K)
+{
+    constexpr auto n_lanes = mipp::N<R>();
+
+    for (auto f = 0; f < n_lanes; f++)
+    {
+        // the first path is returned if no path verifies the CRC
+        auto l = 0;
+        auto is_valid = false;
+        do
+        {
+            this->_trace(f, l);
+            is_valid = this->crc->check(this->path);
+        } while (!is_valid && ++l < this->L);
+
+        if (!is_valid && this->L > 1) this->_trace(f, 0);
+        std::copy(this->path.begin(), this->path.end(), V_K + f * this->K);
+    }
+}
+
+template<typename B, typename R>
+int
+Decoder_Viterbi_list_parallel_inter<B, R>::_decode_siho(const R* Y_N, B* V_K, const size_t frame_id)
+{
+    this->_load(Y_N);
+    this->_forward_pass();
+    this->_backwards_pass(V_K);
+
+    return 0;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_Viterbi_list_parallel_inter<B_8, Q_8>;
+template class aff3ct::module::Decoder_Viterbi_list_parallel_inter<B_16, Q_16>;
+template class aff3ct::module::Decoder_Viterbi_list_parallel_inter<B_32, Q_32>;
+template class aff3ct::module::Decoder_Viterbi_list_parallel_inter<B_64, Q_64>;
+#else
+template class aff3ct::module::Decoder_Viterbi_list_parallel_inter<B, Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,242 @@
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <sstream>
+#include <streampu.hpp>
+#include <string>
+
+#include "Module/Decoder/Turbo_product/Chase_pyndiah/Decoder_chase_pyndiah_incr.hpp"
+#include "Tools/Perf/compute_parity.h"
+
+using namespace aff3ct;
+using namespace aff3ct::module;
+
+template<typename B, typename R>
+Decoder_chase_pyndiah_incr<B, R>::Decoder_chase_pyndiah_incr(const int K,
+                                                             const int N, // N includes the parity bit if any
+                                                             const Decoder_BCH<B, R>& dec_,
+                                                             const Encoder<B>& enc_,
+                                                             const int n_least_reliable_positions_,
+                                                             const int n_test_vectors_,
+                                                             const int n_competitors_,
+                                                             const std::vector<float>& cp_coef)
+  : Decoder_chase_pyndiah_fast<B, R>(K,
+                                     N,
+                                     dec_,
+                                     enc_,
+                                     n_least_reliable_positions_,
+                                     n_test_vectors_,
+                                     n_competitors_,
+                                     cp_coef)
+  , dec_std(dynamic_cast<Decoder_BCH_std<B, R>*>(this->dec.get()))
+  , max_diff(this->n_least_reliable_positions + dec_.get_t())
+  , patterns(this->n_test_vectors, 0)
+  , syndromes(2 * dec_.get_t() + 1, 0)
+  , diff_pos(this->n_test_vectors * max_diff)
+  , n_diff(this->n_test_vectors, 0)
+  , hashes(this->n_test_vectors, 0)
+  , hash_set(spu::tools::next_power_of_2(2 * this->n_test_vectors), -1)
+{
+    const std::string name = "Decoder_chase_pyndiah_incr";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    if (this->dec_std == nullptr)
+    {
+        std::stringstream message;
+        message << "'dec' has to be a 'Decoder_BCH_std' to be decoded from its syndromes.";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (this->n_test_vectors == ((int)1 << this->n_least_reliable_positions))
+    {
+        // Gray code order: two consecutive test patterns differ by a single position
+        for (auto c = 0; c < this->n_test_vectors; c++)
+            this->patterns[c] = c ^ (c >> 1);
+    }
+    else
+    {
+        for (auto c = 0; c < this->n_test_vectors; c++)
+            for (auto i = 0; i < this->n_least_reliable_positions; i++)
+                if (this->test_patterns[c][i]) this->patterns[c] |= (int)1 << i;
+    }
+}
+
+template<typename B, typename R>
+Decoder_chase_pyndiah_incr<B, R>*
+Decoder_chase_pyndiah_incr<B, R>::clone() const
+{
+    auto m = new Decoder_chase_pyndiah_incr(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B, typename R>
+void
+Decoder_chase_pyndiah_incr<B, R>::deep_copy(const Decoder_chase_pyndiah<B, R>& m)
+{
+    Decoder_chase_pyndiah<B, R>::deep_copy(m);
+    this->dec_std = dynamic_cast<Decoder_BCH_std<B, R>*>(this->dec.get());
+}
+
+template<typename B, typename R>
+void
+Decoder_chase_pyndiah_incr<B, R>::compute_test_vectors(const size_t /*frame_id*/)
+{
+    this->dec_std->compute_syndromes(this->hard_Y_N.data(), this->syndromes.data());
+
+    auto prev_pattern = 0;
+    for (auto c = 0; c < this->n_test_vectors; c++)
+    {
+        // update the syndromes with the positions flipped from the previous test pattern
+        const auto delta = this->patterns[c] ^ prev_pattern;
+        for (auto i = 0; i < this->n_least_reliable_positions; i++)
+            if ((delta >> i) & 1)
+                this->dec_std->flip_syndromes(this->least_reliable_pos[i].pos, this->syndromes.data());
+        prev_pattern = this->patterns[c];
+
+        auto* diff = this->diff_pos.data() + c * this->max_diff;
+        auto n = this->dec_std->decode_syndromes(this->syndromes.data(), diff);
+
+        this->is_wrong[c] = n < 0;
+        if (n < 0)
+        {
+            this->n_diff[c] = 0;
+            continue;
+        }
+
+        // the flipped positions corrected by the decoder are back to the hard decision
+        for (auto i = 0; i < this->n_least_reliable_positions; i++)
+            if ((this->patterns[c] >> i) & 1)
+            {
+                const auto pos = this->least_reliable_pos[i].pos;
+                auto it = std::find(diff, diff + n, pos);
+                if (it != diff + n)
+                    *it = diff[--n];
+                else
+                    diff[n++] = pos;
+            }
+
+        std::sort(diff, diff + n);
+        this->n_diff[c] = n;
+
+        // FNV-1a hash of the positions
+        uint64_t hash = 14695981039346656037ull;
+        for (auto i = 0; i < n; i++)
+        {
+            hash ^= (uint64_t)diff[i];
+            hash *= 1099511628211ull;
+        }
+        this->hashes[c] = hash;
+    }
+}
+
+template<typename B, typename R>
+bool
+Decoder_chase_pyndiah_incr<B, R>::insert_competitor(const int c)
+{
+    const auto mask = this->hash_set.size() - 1;
+    const auto* diff_c = this->diff_pos.data() + c * this->max_diff;
+
+    for (auto slot = (size_t)this->hashes[c] & mask;; slot = (slot + 1) & mask)
+    {
+        const auto d = this->hash_set[slot];
+        if (d == -1)
+        {
+            this->hash_set[slot] = c;
+            return true;
+        }
+
+        const auto* diff_d = this->diff_pos.data() + d * this->max_diff;
+        if (this->hashes[d] == this->hashes[c] && this->n_diff[d] == this->n_diff[c] &&
+            std::equal(diff_c, diff_c + this->n_diff[c], diff_d))
+            return false; // same codeword
+    }
+}
+
+template<typename B, typename R>
+void
+Decoder_chase_pyndiah_incr<B, R>::write_competitor(const int c, B* test_vect) const
+{
+    std::copy(this->hard_Y_N.begin(), this->hard_Y_N.end(), test_vect);
+
+    const auto* diff = this->diff_pos.data() + c * this->max_diff;
+    for (auto i = 0; i < this->n_diff[c]; i++)
+        test_vect[diff[i]] = !test_vect[diff[i]];
+
+    if (this->parity_extended) test_vect[this->N - 1] = tools::compute_parity(test_vect, this->N_np);
+}
+
+template<typename B, typename R>
+void
+Decoder_chase_pyndiah_incr<B, R>::compute_metrics(const R* Y_N)
+{
+    const auto hard_parity = this->parity_extended ? tools::compute_parity(this->hard_Y_N.data(), this->N_np) : (B)0;
+
+    std::fill(this->hash_set.begin(), this->hash_set.end(), -1);
+
+    this->n_good_competitors = 0;
+    for (auto c = 0; c < this->n_test_vectors; c++)
+    {
+        if (this->is_wrong[c])
+        {
+            this->metrics[c] = std::numeric_limits<R>::max() / 2;
+            continue;
+        }
+
+        const auto* diff = this->diff_pos.data() + c * this->max_diff;
+        R metric = 0;
+        for (auto i = 0; i < this->n_diff[c]; i++)
+            metric += std::abs(Y_N[diff[i]]);
+
+        // the parity bit of the competitor differs from the hard decision
+        if (this->parity_extended && (B)(hard_parity ^ (B)(this->n_diff[c] & 1)) != this->hard_Y_N[this->N - 1])
+            metric += std::abs(Y_N[this->N - 1]);
+
+        this->metrics[c] = metric;
+
+        if (this->insert_competitor(c)) this->competitors[this->n_good_competitors++] = { metric, c };
+    }
+
+    if (this->n_good_competitors == 0)
+    {
+        // no test vector has been corrected: the decided word is the first test vector
+        this->n_diff[0] = 0;
+        for (auto i = 0; i < this->n_least_reliable_positions; i++)
+            if ((this->patterns[0] >> i) & 1)
+                this->diff_pos[this->n_diff[0]++] = this->least_reliable_pos[i].pos;
+
+        this->competitors[0] = { std::numeric_limits<R>::max() / 2, 0 };
+        this->write_competitor(0, this->test_vect.data());
+        return;
+    }
+
+    // select the best competitors, the ties are broken by the test vector index
+    using I = typename Decoder_chase_pyndiah<B, R>::info;
+    const auto n_best = std::min(this->n_good_competitors, this->n_competitors);
+    std::partial_sort(this->competitors.begin(),
+                      this->competitors.begin() + n_best,
+                      this->competitors.begin() + this->n_good_competitors,
+                      [](const I& a, const I& b)
+                      { return a.metric < b.metric || (a.metric == b.metric && a.pos < b.pos); });
+
+    this->n_good_competitors = n_best;
+    for (auto j = 0; j < n_best; j++)
+    {
+        this->write_competitor(this->competitors[j].pos, this->test_vect.data() + j * this->N);
+        this->competitors[j].pos = j * this->N;
+    }
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Decoder_chase_pyndiah_incr<B_8, Q_8>;
+template class aff3ct::module::Decoder_chase_pyndiah_incr<B_16, Q_16>;
+template class aff3ct::module::Decoder_chase_pyndiah_incr<B_32, Q_32>;
+template class aff3ct::module::Decoder_chase_pyndiah_incr<B_64, Q_64>;
+#else
+template class aff3ct::module::Decoder_chase_pyndiah_incr<B, Q>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <atomic>
 #include <sstream>
 #include <streampu.hpp>
 #include <string>
@@ -14,7 +15,8 @@ Decoder_turbo_product<B, R>::Decoder_turbo_product(const int& n_ite,
                                                    const Decoder_chase_pyndiah<B, R>& cp_r,
                                                    const Decoder_chase_pyndiah<B, R>& cp_c,
                                                    const Interleaver<R>& pi,
-                                                   const std::vector<float>& beta)
+                                                   const std::vector<float>& beta,
+                                                   const int n_threads)
   : Decoder_SISO<B, R>(cp_r.get_K() * cp_c.get_K(), pi.get_core().get_size())
   , n_ite(n_ite)
   , alpha(alpha)
@@ -22,6 +24,7 @@ Decoder_turbo_product<B, R>::Decoder_turbo_product(const int& n_ite,
   , pi(pi.clone())
   , cp_r(cp_r.clone())
   , cp_c(cp_c.clone())
+  , n_threads(n_threads)
   , Y_N_i(this->N)
   , Y_N_pi(this->N)
   , V_K_i(this->K)
@@ -40,6 +43,13 @@ Decoder_turbo_product<B, R>::Decoder_turbo_product(const int& n_ite,
         throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
     }
 
+    if (n_threads <= 0)
+    {
+        std::stringstream message;
+        message << "'n_threads' has to be greater than 0 ('n_threads' = " << n_threads << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
     if (n_ite * 2 != (int)alpha.size())
     {
         std::stringstream message;
@@ -103,6 +113,7 @@ Decoder_turbo_product<B, R>::Decoder_turbo_product(const int& n_ite,
         this->cp_c->clear_beta();
     }
 
+    this->init_threads();
     this->set_n_frames(this->pi->get_n_frames());
 }
 
@@ -123,6 +134,52 @@ Decoder_turbo_product<B, R>::deep_copy(const Decoder_turbo_product<B, R>& m)
     if (m.cp_r != nullptr) this->cp_r.reset(m.cp_r->clone());
     if (m.cp_c != nullptr) this->cp_c.reset(m.cp_c->clone());
     if (m.pi != nullptr) this->pi.reset(m.pi->clone());
+    this->init_threads();
+}
+
+template<typename B, typename R>
+void
+Decoder_turbo_product<B, R>::init_threads()
+{
+    // the thread 0 is the calling thread, it uses the 'cp_r' and 'cp_c' decoders
+    this->cp_r_t.resize(this->n_threads);
+    this->cp_c_t.resize(this->n_threads);
+    this->cp_r_t[0] = this->cp_r;
+    this->cp_c_t[0] = this->cp_c;
+    for (auto t = 1; t < this->n_threads; t++)
+    {
+        this->cp_r_t[t].reset(this->cp_r->clone());
+        this->cp_c_t[t].reset(this->cp_c->clone());
+    }
+
+    if (this->n_threads > 1)
+        this->pool.reset(new tools::Thread_pool(this->n_threads));
+    else
+        this->pool.reset();
+}
+
+template<typename B, typename R>
+void
+Decoder_turbo_product<B, R>::for_each_word(
+  const int n_words,
+  const std::function<void(Decoder_chase_pyndiah<B, R>& cp_r, Decoder_chase_pyndiah<B, R>& cp_c, const int j)>& decode)
+{
+    if (this->pool == nullptr)
+    {
+        for (auto j = 0; j < n_words; j++)
+            decode(*this->cp_r, *this->cp_c, j);
+    }
+    else
+    {
+        // the words are dynamically distributed over the threads
+        std::atomic<int> next_word(0);
+        this->pool->run(
+          [&](const size_t tid)
+          {
+              for (auto j = next_word++; j < n_words; j = next_word++)
+                  decode(*this->cp_r_t[tid], *this->cp_c_t[tid], j);
+          });
+    }
 }
 
 template<typename B, typename R>
@@ -217,61 +274,73 @@ Decoder_turbo_product<B, R>::_decode(const R* Y_N_cha, const size_t frame_id, in
         pi->interleave(Y_N_i.data(), Y_N_pi.data(), frame_id, false); // columns becomes rows
 
         if (beta.size())
-        {
-            cp_c->set_beta((R)beta[2 * i + 0]);
-            cp_r->set_beta((R)beta[2 * i + 1]);
-        }
-
-        // decode each col
-        for (int j = 0; j < n_cols; j++)
-        {
-            cp_c->decode_siso(Y_N_pi.data(), Y_N_pi.data(), j); // decode j-th column
-
-            auto* cha_ptr = Y_N_cha_i.data() + j * n_rows;
-            auto* last_it = Y_N_pi.data() + (j + 1) * n_rows;
-
-            for (auto it = Y_N_pi.data() + j * n_rows; it < last_it; it++, cha_ptr++)
+            for (auto t = 0; t < n_threads; t++)
             {
-                *it *= (R)alpha[2 * i];
-                *it += *cha_ptr;
+                cp_c_t[t]->set_beta((R)beta[2 * i + 0]);
+                cp_r_t[t]->set_beta((R)beta[2 * i + 1]);
             }
-        }
+
+        // decode each col
+        this->for_each_word(
+          n_cols,
+          [&](Decoder_chase_pyndiah<B, R>&, Decoder_chase_pyndiah<B, R>& dec_c, const int j)
+          {
+              dec_c.decode_siso(Y_N_pi.data(), Y_N_pi.data(), j); // decode j-th column
+
+              auto* cha_ptr = Y_N_cha_i.data() + j * n_rows;
+              auto* last_it = Y_N_pi.data() + (j + 1) * n_rows;
+
+              for (auto it = Y_N_pi.data() + j * n_rows; it < last_it; it++, cha_ptr++)
+              {
+                  *it *= (R)alpha[2 * i];
+                  *it += *cha_ptr;
+              }
+          });
 
         pi->deinterleave(Y_N_pi.data(), Y_N_i.data(), frame_id, false); // rows go back as columns
 
         // decode each row
         if (i < (n_ite - 1) || return_K_siso >= 2)
         {
-            for (int j = 0; j < n_rows; j++)
-            {
-                cp_r->decode_siso(Y_N_i.data(), Y_N_i.data(), j); // decode j-th row
-
-                auto* cha_ptr = Y_N_cha + j * n_cols;
-                auto* last_it = Y_N_i.data() + (j + 1) * n_cols;
-
-                for (auto it = Y_N_i.data() + j * n_cols; it < last_it; it++, cha_ptr++)
-                {
-                    *it *= (R)alpha[2 * i + 1];
-                    *it += *cha_ptr;
-                }
-            }
+            this->for_each_word(
+              n_rows,
+              [&](Decoder_chase_pyndiah<B, R>& dec_r, Decoder_chase_pyndiah<B, R>&, const int j)
+              {
+                  dec_r.decode_siso(Y_N_i.data(), Y_N_i.data(), j); // decode j-th row
+
+                  auto* cha_ptr = Y_N_cha + j * n_cols;
+                  auto* last_it = Y_N_i.data() + (j + 1) * n_cols;
+
+                  for (auto it = Y_N_i.data() + j * n_cols; it < last_it; it++, cha_ptr++)
+                  {
+                      *it *= (R)alpha[2 * i + 1];
+                      *it += *cha_ptr;
+                  }
+              });
         }
         else if (return_K_siso == 0)
         {
-            for (int j = 0; j < cp_c->get_K(); j++)
-            {
-                auto pos = (int)cp_c->get_info_bits_pos()[j];
-
-                cp_r->decode_siho(Y_N_i.data(),
-                                  V_K_i.data() + (j - pos) * cp_r->get_K(),
-                                  pos); // decode pos-th row,
-                                        // offset pos automatically added by decoder
-            }
+            const auto& info_bits_pos = cp_c->get_info_bits_pos();
+            this->for_each_word(
+              cp_c->get_K(),
+              [&](Decoder_chase_pyndiah<B, R>& dec_r, Decoder_chase_pyndiah<B, R>&, const int j)
+              {
+                  auto pos = (int)info_bits_pos[j];
+
+                  dec_r.decode_siho(Y_N_i.data(),
+                                    V_K_i.data() + (j - pos) * cp_r->get_K(),
+                                    pos); // decode pos-th row,
+                                          // offset pos automatically added by decoder
+              });
         }
         else if (return_K_siso == 1)
         {
-            for (int j = 0; j < n_cols; j++)
-                cp_r->decode_siho_cw(Y_N_i.data(), V_N_i.data(), j); // decode j-th row
+            this->for_each_word(
+              n_cols,
+              [&](Decoder_chase_pyndiah<B, R>& dec_r, Decoder_chase_pyndiah<B, R>&, const int j)
+              {
+                  dec_r.decode_siho_cw(Y_N_i.data(), V_N_i.data(), j); // decode j-th row
+              });
         }
     }
 
@@ -19,7 +19,8 @@ Encoder_LDPC_from_H<B>::Encoder_LDPC_from_H(const int K,
                                             const tools::Sparse_matrix& _H,
                                             const std::string& G_method,
                                             const std::string& G_save_path,
-                                            const bool G_save_path_single_thread)
+                                            const bool G_save_path_single_thread,
+                                            const std::string& cache_path)
   : Encoder_LDPC<B>(K, N)
 {
     const std::string name = "Encoder_LDPC_from_H";
@@ -32,7 +33,7 @@ Encoder_LDPC_from_H<B>::Encoder_LDPC_from_H(const int K,
     if (G_method == "IDENTITY")
         this->G = tools::LDPC_matrix_handler::transform_H_to_G_identity(this->H, this->info_bits_pos);
     else if (G_method == "LU_DEC")
-        this->G = tools::LDPC_matrix_handler::transform_H_to_G_decomp_LU(this->H, this->info_bits_pos);
+        this->G = tools::LDPC_matrix_handler::transform_H_to_G_decomp_LU(this->H, this->info_bits_pos, cache_path);
     else
     {
         std::stringstream message;
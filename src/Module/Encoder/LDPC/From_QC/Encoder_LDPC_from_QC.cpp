@@ -1,28 +1,67 @@
 #include <algorithm>
 #include <cstdint>
+#include <map>
 #include <mipp.h>
+#include <random>
 #include <sstream>
 #include <streampu.hpp>
 #include <string>
 
 #include "Module/Encoder/LDPC/From_QC/Encoder_LDPC_from_QC.hpp"
+#include "Tools/Code/LDPC/Syndrome/LDPC_syndrome.hpp"
 
 using namespace aff3ct;
 using namespace aff3ct::module;
 
 template<typename B>
-Encoder_LDPC_from_QC<B>::Encoder_LDPC_from_QC(const int K, const int N, const tools::Sparse_matrix& _H)
+Encoder_LDPC_from_QC<B>::Encoder_LDPC_from_QC(const int K,
+                                              const int N,
+                                              const tools::Sparse_matrix& _H,
+                                              const int dec_granularity,
+                                              const std::string& cache_path)
   : Encoder_LDPC<B>(K, N)
-  , invH2(tools::LDPC_matrix_handler::LU_decomposition(_H))
+  , n_info((dec_granularity > 0 && dec_granularity < K) ? dec_granularity : K)
+  , structured(false)
+  , K_red(0)
+  , n_words(0)
+  , n_words_al(0)
+  , last_mask(0)
 {
     const std::string name = "Encoder_LDPC_from_QC";
     this->set_name(name);
     for (auto& t : this->tasks)
         t->set_replicability(true);
 
+    this->dec_granularity = dec_granularity;
     this->H = _H;
 
     this->check_H_dimensions();
+
+    this->structured = tools::QC::extract_base(this->H, this->base) && this->build_schedule();
+
+    if (this->structured)
+    {
+        const auto Z = this->base.Z;
+        this->n_words = (Z + 31) / 32;
+        this->n_words_al = ((this->n_words + mipp::nElReg<int32_t>() - 1) / mipp::nElReg<int32_t>()) *
+                           mipp::nElReg<int32_t>();
+        this->last_mask = (Z % 32) ? (uint32_t)((1u << (Z % 32)) - 1) : (uint32_t)0xFFFFFFFF;
+
+        const auto M_red = this->base.M_red;
+        this->U_packed.resize(this->K_red * 2 * this->n_words_al, 0);
+        this->P_packed.resize(M_red * 2 * this->n_words_al, 0);
+        this->lambda.resize(M_red * this->n_words_al, 0);
+        this->acc.resize(this->n_words_al, 0);
+        this->acc_packed.resize(2 * this->n_words_al, 0);
+
+        this->structured = this->check_schedule();
+    }
+
+    if (!this->structured)
+    {
+        this->invH2 = tools::LDPC_matrix_handler::inverse_H2(this->H, cache_path);
+        this->parity.resize(this->invH2.get_n_words(), 0);
+    }
 }
 
 template<typename B>
@@ -34,36 +73,321 @@ Encoder_LDPC_from_QC<B>::clone() const
     return m;
 }
 
+template<typename B>
+bool
+Encoder_LDPC_from_QC<B>::is_structured() const
+{
+    return this->structured;
+}
+
+template<typename B>
+bool
+Encoder_LDPC_from_QC<B>::build_schedule()
+{
+    const auto Z = this->base.Z;
+    const auto M_red = this->base.M_red;
+
+    if (this->K % Z != 0) return false;
+
+    this->K_red = this->K / Z;
+    if (this->base.N_red - this->K_red != M_red) return false;
+
+    const auto& shifts = this->base.shifts;
+
+    this->info_blocks.assign(M_red, std::vector<std::pair<unsigned, unsigned>>());
+    for (unsigned i = 0; i < M_red; i++)
+        for (unsigned j = 0; j < this->K_red; j++)
+            if (shifts[i][j] >= 0) this->info_blocks[i].push_back(std::make_pair(j, (unsigned)shifts[i][j]));
+
+    auto shift = [&](const unsigned i, const unsigned c) { return shifts[i][this->K_red + c]; };
+
+    std::vector<bool> known(M_red, false), row_done(M_red, false);
+    unsigned n_known = 0;
+    this->steps.clear();
+
+    while (n_known < M_red)
+    {
+        // peel the block rows with a single unknown parity block
+        bool progress = false;
+        for (unsigned i = 0; i < M_red; i++)
+        {
+            if (row_done[i]) continue;
+
+            unsigned n_unknowns = 0, col = 0;
+            for (unsigned c = 0; c < M_red; c++)
+                if (shift(i, c) >= 0 && !known[c])
+                {
+                    n_unknowns++;
+                    col = c;
+                }
+
+            if (n_unknowns == 0)
+                row_done[i] = true;
+            else if (n_unknowns == 1)
+            {
+                Step step;
+                step.col = col;
+                step.inv_shift = (Z - (unsigned)shift(i, col)) % Z;
+                step.rows.push_back(i);
+                for (unsigned c = 0; c < M_red; c++)
+                    if (shift(i, c) >= 0 && known[c]) step.parities.push_back(std::make_pair(c, (unsigned)shift(i, c)));
+                this->steps.push_back(step);
+
+                known[col] = true;
+                row_done[i] = true;
+                n_known++;
+                progress = true;
+            }
+        }
+
+        if (progress) continue;
+
+        // no single unknown left (dual-diagonal core): sum the core block rows to cancel all the unknowns but one, the
+        // rows holding a parity block that appears only once can't be part of the core
+        std::vector<bool> in_core(row_done);
+        in_core.flip();
+        bool removed = true;
+        while (removed)
+        {
+            removed = false;
+            std::vector<unsigned> degree(M_red, 0);
+            for (unsigned i = 0; i < M_red; i++)
+                if (in_core[i])
+                    for (unsigned c = 0; c < M_red; c++)
+                        if (shift(i, c) >= 0 && !known[c]) degree[c]++;
+
+            for (unsigned i = 0; i < M_red; i++)
+                if (in_core[i])
+                    for (unsigned c = 0; c < M_red; c++)
+                        if (shift(i, c) >= 0 && !known[c] && degree[c] == 1)
+                        {
+                            in_core[i] = false;
+                            removed = true;
+                            break;
+                        }
+        }
+
+        // a block appearing twice with the same shift cancels, keep the odd occurrences only
+        std::map<std::pair<unsigned, unsigned>, unsigned> occurrences;
+        Step step;
+        for (unsigned i = 0; i < M_red; i++)
+            if (in_core[i])
+            {
+                step.rows.push_back(i);
+                for (unsigned c = 0; c < M_red; c++)
+                    if (shift(i, c) >= 0) occurrences[std::make_pair(c, (unsigned)shift(i, c))]++;
+            }
+
+        if (step.rows.empty()) return false;
+
+        unsigned n_unknowns = 0;
+        for (auto& o : occurrences)
+            if (o.second % 2)
+            {
+                const auto c = o.first.first, s = o.first.second;
+                if (known[c])
+                    step.parities.push_back(std::make_pair(c, s));
+                else
+                {
+                    n_unknowns++;
+                    step.col = c;
+                    step.inv_shift = (Z - s) % Z;
+                }
+            }
+
+        if (n_unknowns != 1) return false;
+
+        this->steps.push_back(step);
+        known[step.col] = true;
+        n_known++;
+    }
+
+    return true;
+}
+
+template<typename B>
+bool
+Encoder_LDPC_from_QC<B>::check_schedule()
+{
+    // the schedule does not check the rank of the parity part of H (the block rows without unknown left and the sums
+    // of the core rows are assumed to be consistent): a few random words are encoded and verified, a parity part that
+    // can't be solved by back-substitution gives a non-codeword with a probability of at least 1/2 for each word
+    std::mt19937 gen(0);
+    std::vector<B> U_K(this->K), X_N(this->N);
+    for (auto w = 0; w < 8; w++)
+    {
+        for (auto& u : U_K)
+            u = (B)(gen() & 1);
+        this->_encode(U_K.data(), X_N.data(), 0);
+        if (!tools::LDPC_syndrome::check_hard(X_N.data(), this->H)) return false;
+    }
+    return true;
+}
+
+template<typename B>
+void
+Encoder_LDPC_from_QC<B>::pack(const B* in, const unsigned n_bits, uint32_t* out) const
+{
+    const auto Z = this->base.Z;
+
+    std::fill(out, out + 2 * this->n_words_al, 0);
+    for (unsigned k = 0; k < n_bits; k++)
+    {
+        const auto bit = (uint32_t)in[k] & 1;
+        out[k >> 5] |= bit << (k & 31);
+        out[(k + Z) >> 5] |= bit << ((k + Z) & 31);
+    }
+}
+
+template<typename B>
+void
+Encoder_LDPC_from_QC<B>::rotate_xor(const uint32_t* in_packed, const unsigned shift, uint32_t* out) const
+{
+    // 'in_packed' holds the block twice in a row, so the rotation is a plain shifted read, the words after 'n_words' in
+    // 'out' are not used
+    const auto q = shift >> 5;
+    const auto r = (int)(shift & 31);
+    const auto n_el = mipp::nElReg<int32_t>();
+    const auto in_ptr = reinterpret_cast<const int32_t*>(in_packed + q);
+    auto out_ptr = reinterpret_cast<int32_t*>(out);
+
+    if (r == 0)
+        for (unsigned w = 0; w < this->n_words_al; w += n_el)
+        {
+            const auto r_out = mipp::Reg<int32_t>(out_ptr + w) ^ mipp::loadu<int32_t>(in_ptr + w);
+            r_out.store(out_ptr + w);
+        }
+    else
+        for (unsigned w = 0; w < this->n_words_al; w += n_el)
+        {
+            const auto r_lo = mipp::rshift(mipp::loadu<int32_t>(in_ptr + w + 0), r);
+            const auto r_hi = mipp::lshift(mipp::loadu<int32_t>(in_ptr + w + 1), 32 - r);
+            const auto r_out = mipp::Reg<int32_t>(out_ptr + w) ^ (r_lo | r_hi);
+            r_out.store(out_ptr + w);
+        }
+}
+
+template<typename B>
+void
+Encoder_LDPC_from_QC<B>::duplicate(const uint32_t* in, uint32_t* out_packed) const
+{
+    const auto Z = this->base.Z;
+    const auto q = Z >> 5;
+    const auto r = Z & 31;
+
+    std::fill(out_packed, out_packed + 2 * this->n_words_al, 0);
+    std::copy(in, in + this->n_words, out_packed);
+    for (unsigned w = 0; w < this->n_words; w++)
+    {
+        out_packed[q + w] |= in[w] << r;
+        if (r) out_packed[q + w + 1] |= in[w] >> (32 - r);
+    }
+}
+
 template<typename B>
 void
 Encoder_LDPC_from_QC<B>::_encode(const B* U_K, B* X_N, const size_t frame_id)
 {
-    int M = this->N - this->K;
+    // Systematic part, the information bits after 'n_info' are zero padded
+    std::copy_n(U_K, this->n_info, X_N);
+    std::fill(X_N + this->n_info, X_N + this->K, (B)0);
 
-    // Systematic part
-    std::copy_n(U_K, this->K, X_N);
+    if (this->structured)
+        this->_encode_structured(U_K, X_N);
+    else
+        this->_encode_dense(U_K, X_N);
+}
 
-    // Calculate parity part
-    mipp::vector<int8_t> parity(M, 0);
+template<typename B>
+void
+Encoder_LDPC_from_QC<B>::_encode_structured(const B* U_K, B* X_N)
+{
+    const auto Z = this->base.Z;
+    const auto M_red = this->base.M_red;
+    const auto stride = 2 * this->n_words_al;
 
-    int zero_padding_size = this->N - this->dec_granularity - M;
-    std::cout << "ENCODER\n";
-    for (auto i = 0; i < zero_padding_size; i++){
-        std::cout << i << " " << X_N[i + this->dec_granularity] << "\n";
-        X_N[i + this->dec_granularity] = 0;
+    // only the blocks holding at least one non-padded information bit contribute to the parity
+    const auto n_info_blocks = (this->n_info + Z - 1) / Z;
+    for (unsigned j = 0; j < n_info_blocks; j++)
+    {
+        const auto n_bits = std::min(Z, (unsigned)this->n_info - j * Z);
+        this->pack(U_K + j * Z, n_bits, this->U_packed.data() + j * stride);
     }
 
-    for (auto i = 0; i < M; i++)
-        for (auto& l : this->H.get_rows_from_col(i))
-            if (l < (unsigned)this->K && l < this->dec_granularity) parity[i] ^= U_K[l];
+    for (unsigned i = 0; i < M_red; i++)
+    {
+        auto lambda_i = this->lambda.data() + i * this->n_words_al;
+        std::fill(lambda_i, lambda_i + this->n_words_al, 0);
+        for (auto& b : this->info_blocks[i])
+        {
+            if (b.first >= n_info_blocks) break;
+            this->rotate_xor(this->U_packed.data() + b.first * stride, b.second, lambda_i);
+        }
+    }
+
+    // back-substitution on the parity blocks
+    const auto n_el = mipp::nElReg<int32_t>();
+    auto acc_ptr = reinterpret_cast<int32_t*>(this->acc.data());
+    for (auto& step : this->steps)
+    {
+        mipp::Reg<int32_t> r_zero = (int32_t)0;
+        for (unsigned w = 0; w < this->n_words_al; w += n_el)
+            r_zero.store(acc_ptr + w);
+
+        for (auto i : step.rows)
+        {
+            const auto lambda_i = reinterpret_cast<const int32_t*>(this->lambda.data() + i * this->n_words_al);
+            for (unsigned w = 0; w < this->n_words_al; w += n_el)
+            {
+                const mipp::Reg<int32_t> r_acc = acc_ptr + w;
+                const mipp::Reg<int32_t> r_lambda = lambda_i + w;
+                (r_acc ^ r_lambda).store(acc_ptr + w);
+            }
+        }
+
+        for (auto& p : step.parities)
+            this->rotate_xor(this->P_packed.data() + p.first * stride, p.second, this->acc.data());
+        this->acc[this->n_words - 1] &= this->last_mask;
+
+        this->duplicate(this->acc.data(), this->acc_packed.data());
+        std::fill(this->acc.begin(), this->acc.end(), 0);
+        this->rotate_xor(this->acc_packed.data(), step.inv_shift, this->acc.data());
+        this->acc[this->n_words - 1] &= this->last_mask;
+
+        this->duplicate(this->acc.data(), this->P_packed.data() + step.col * stride);
+    }
 
     auto* X_N_ptr = X_N + this->K;
+    for (unsigned c = 0; c < M_red; c++)
+    {
+        const auto P_c = this->P_packed.data() + c * stride;
+        for (unsigned k = 0; k < Z; k++)
+            X_N_ptr[c * Z + k] = (B)((P_c[k >> 5] >> (k & 31)) & 1);
+    }
+}
+
+template<typename B>
+void
+Encoder_LDPC_from_QC<B>::_encode_dense(const B* U_K, B* X_N)
+{
+    int M = this->N - this->K;
+
+    using word_t = tools::GF2_matrix::word_t;
+    constexpr auto word_size = tools::GF2_matrix::word_size;
+
+    // Calculate parity part
+    std::fill(this->parity.begin(), this->parity.end(), (word_t)0);
     for (auto i = 0; i < M; i++)
     {
-        X_N_ptr[i] = 0;
-        for (auto j = 0; j < M; j++)
-            X_N_ptr[i] ^= parity[j] & invH2[i][j];
+        B bit = 0;
+        for (auto& l : this->H.get_rows_from_col(i))
+            if (l < (unsigned)this->n_info) bit ^= U_K[l];
+        if (bit) this->parity[i / word_size] |= (word_t)1 << (i % word_size);
     }
+
+    auto* X_N_ptr = X_N + this->K;
+    for (auto i = 0; i < M; i++)
+        X_N_ptr[i] = (B)this->invH2.dot(i, this->parity.data());
 }
 
 template<typename B>
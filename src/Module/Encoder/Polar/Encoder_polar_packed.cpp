@@ -0,0 +1,137 @@
+#include <algorithm>
+#include <string>
+
+#include "Module/Encoder/Polar/Encoder_polar_packed.hpp"
+
+using namespace aff3ct::module;
+
+// 'intra_masks[s]' selects the bits 'i' of a word for which the bit 'i + 2^s' is added in the stage of distance 2^s
+static const uint64_t intra_masks[6] = { 0x5555555555555555ull, 0x3333333333333333ull, 0x0F0F0F0F0F0F0F0Full,
+                                         0x00FF00FF00FF00FFull, 0x0000FFFF0000FFFFull, 0x00000000FFFFFFFFull };
+
+template<typename B>
+Encoder_polar_packed<B>::Encoder_polar_packed(const int& K, const int& N, const std::vector<bool>& frozen_bits)
+  : Encoder_polar<B>(K, N, frozen_bits)
+  , n_words((N + 63) / 64)
+  , frozen_mask(n_words)
+  , X_N_packed(n_words)
+{
+    const std::string name = "Encoder_polar_packed";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+
+    this->set_frozen_bits(frozen_bits);
+}
+
+template<typename B>
+Encoder_polar_packed<B>*
+Encoder_polar_packed<B>::clone() const
+{
+    auto m = new Encoder_polar_packed(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B>
+void
+Encoder_polar_packed<B>::_encode(const B* U_K, B* X_N, const size_t frame_id)
+{
+    this->pack_info_bits(U_K, this->X_N_packed.data());
+    this->light_encode_packed(this->X_N_packed.data());
+    this->unpack(this->X_N_packed.data(), X_N);
+}
+
+template<typename B>
+void
+Encoder_polar_packed<B>::pack_info_bits(const B* U_K, uint64_t* words) const
+{
+    std::fill(words, words + this->n_words, (uint64_t)0);
+    for (auto k = 0; k < this->K; k++)
+    {
+        const auto pos = this->info_bits_pos[k];
+        words[pos >> 6] |= (uint64_t)(U_K[k] != 0) << (pos & 63);
+    }
+}
+
+template<typename B>
+void
+Encoder_polar_packed<B>::pack(const B* X_N, uint64_t* words) const
+{
+    std::fill(words, words + this->n_words, (uint64_t)0);
+    for (auto i = 0; i < this->N; i++)
+        words[i >> 6] |= (uint64_t)(X_N[i] != 0) << (i & 63);
+}
+
+template<typename B>
+void
+Encoder_polar_packed<B>::unpack(const uint64_t* words, B* X_N) const
+{
+    for (auto w = 0; w < this->n_words; w++)
+    {
+        const auto word = words[w];
+        const auto n_bits = std::min(64, this->N - w * 64);
+        for (auto b = 0; b < n_bits; b++)
+            X_N[w * 64 + b] = (B)((word >> b) & 1);
+    }
+}
+
+template<typename B>
+void
+Encoder_polar_packed<B>::light_encode_packed(uint64_t* words) const
+{
+    // stages of distance >= 64: XORs of whole words (the inner loop is vectorized by the compiler)
+    for (auto k = (this->n_words >> 1); k > 0; k >>= 1)
+        for (auto j = 0; j < this->n_words; j += 2 * k)
+            for (auto i = 0; i < k; i++)
+                words[j + i] ^= words[k + j + i];
+
+    // stages of distance < 64: all the stages of a word are computed in registers
+    auto s_max = 0;
+    while (s_max < 6 && (2 << s_max) <= this->N)
+        s_max++;
+    for (auto w = 0; w < this->n_words; w++)
+    {
+        auto word = words[w];
+        for (auto s = s_max - 1; s >= 0; s--)
+            word ^= (word >> (1 << s)) & intra_masks[s];
+        words[w] = word;
+    }
+}
+
+template<typename B>
+bool
+Encoder_polar_packed<B>::is_codeword(const B* X_N)
+{
+    // the polar transform is its own inverse: 'X_N' is a codeword if all the frozen bits of its transform are 0
+    this->pack(X_N, this->X_N_packed.data());
+    this->light_encode_packed(this->X_N_packed.data());
+
+    for (auto w = 0; w < this->n_words; w++)
+        if (this->X_N_packed[w] & this->frozen_mask[w]) return false;
+
+    return true;
+}
+
+template<typename B>
+void
+Encoder_polar_packed<B>::set_frozen_bits(const std::vector<bool>& frozen_bits)
+{
+    Encoder_polar<B>::set_frozen_bits(frozen_bits);
+
+    std::fill(this->frozen_mask.begin(), this->frozen_mask.end(), (uint64_t)0);
+    for (auto i = 0; i < this->N; i++)
+        if (this->frozen_bits[i]) this->frozen_mask[i >> 6] |= (uint64_t)1 << (i & 63);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Encoder_polar_packed<B_8>;
+template class aff3ct::module::Encoder_polar_packed<B_16>;
+template class aff3ct::module::Encoder_polar_packed<B_32>;
+template class aff3ct::module::Encoder_polar_packed<B_64>;
+#else
+template class aff3ct::module::Encoder_polar_packed<B>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -0,0 +1,58 @@
+#include <string>
+
+#include "Module/Encoder/Polar/Encoder_polar_packed_sys.hpp"
+
+using namespace aff3ct::module;
+
+template<typename B>
+Encoder_polar_packed_sys<B>::Encoder_polar_packed_sys(const int& K,
+                                                      const int& N,
+                                                      const std::vector<bool>& frozen_bits)
+  : Encoder_polar_packed<B>(K, N, frozen_bits)
+{
+    const std::string name = "Encoder_polar_packed_sys";
+    this->set_name(name);
+    for (auto& t : this->tasks)
+        t->set_replicability(true);
+    this->set_sys(true);
+}
+
+template<typename B>
+Encoder_polar_packed_sys<B>*
+Encoder_polar_packed_sys<B>::clone() const
+{
+    auto m = new Encoder_polar_packed_sys(*this);
+    m->deep_copy(*this);
+    return m;
+}
+
+template<typename B>
+void
+Encoder_polar_packed_sys<B>::_encode(const B* U_K, B* X_N, const size_t frame_id)
+{
+    auto words = this->X_N_packed.data();
+    this->pack_info_bits(U_K, words);
+
+    // first time encode
+    this->light_encode_packed(words);
+
+    for (auto w = 0; w < this->n_words; w++)
+        words[w] &= ~this->frozen_mask[w];
+
+    // second time encode because of systematic encoder
+    this->light_encode_packed(words);
+
+    this->unpack(words, X_N);
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template class aff3ct::module::Encoder_polar_packed_sys<B_8>;
+template class aff3ct::module::Encoder_polar_packed_sys<B_16>;
+template class aff3ct::module::Encoder_polar_packed_sys<B_32>;
+template class aff3ct::module::Encoder_polar_packed_sys<B_64>;
+#else
+template class aff3ct::module::Encoder_polar_packed_sys<B>;
+#endif
+// ==================================================================================== explicit template instantiation
@@ -36,8 +36,14 @@ template<typename B, typename R, typename Q>
 void
 Modem_BPSK<B, R, Q>::_modulate(const B* X_N1, R* X_N2, const size_t frame_id)
 {
-    auto size = (unsigned int)(this->N);
-    for (unsigned i = 0; i < size; i++)
+    // the zero padded bits are known by the receiver: they are not modulated, their symbol is the one of the bit 0
+    const auto pad_beg = this->get_padding_begin();
+    const auto pad_end = this->get_padding_end();
+
+    for (auto i = 0; i < pad_beg; i++)
+        X_N2[i] = (R)((B)1 - (X_N1[i] + X_N1[i])); // (X_N[i] == 1) ? -1 : +1
+    std::fill(X_N2 + pad_beg, X_N2 + pad_end, (R)1);
+    for (auto i = pad_end; i < this->N; i++)
         X_N2[i] = (R)((B)1 - (X_N1[i] + X_N1[i])); // (X_N[i] == 1) ? -1 : +1
 }
 
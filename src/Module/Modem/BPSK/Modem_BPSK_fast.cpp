@@ -48,20 +48,29 @@ template<>
 void
 Modem_BPSK_fast<int, float, float>::_modulate(const int* X_N1, float* X_N2, const size_t frame_id)
 {
-    auto size = (unsigned int)(this->N);
-
-    const auto vec_loop_size = (size / mipp::nElReg<int>()) * mipp::nElReg<int>();
     const mipp::Reg<float> one = 1.f;
-    for (unsigned i = 0; i < vec_loop_size; i += mipp::nElReg<int>())
+    const auto modulate = [&](const unsigned beg, const unsigned end)
     {
-        auto x1b = mipp::Reg<int>(&X_N1[i]);
-        auto x1r = x1b.cvt<float>();
-        auto x2r = one - (x1r + x1r);
-        x2r.store(&X_N2[i]);
-    }
+        const auto vec_loop_size = beg + ((end - beg) / mipp::nElReg<int>()) * mipp::nElReg<int>();
+        for (unsigned i = beg; i < vec_loop_size; i += mipp::nElReg<int>())
+        {
+            auto x1b = mipp::Reg<int>(&X_N1[i]);
+            auto x1r = x1b.cvt<float>();
+            auto x2r = one - (x1r + x1r);
+            x2r.store(&X_N2[i]);
+        }
+
+        for (unsigned i = vec_loop_size; i < end; i++)
+            X_N2[i] = (float)((int)1 - (X_N1[i] + X_N1[i])); // (X_N[i] == 1) ? -1 : +1
+    };
 
-    for (unsigned i = vec_loop_size; i < size; i++)
-        X_N2[i] = (float)((int)1 - (X_N1[i] + X_N1[i])); // (X_N[i] == 1) ? -1 : +1
+    // the zero padded bits are known by the receiver: they are not modulated, their symbol is the one of the bit 0
+    const auto pad_beg = (unsigned)this->get_padding_begin();
+    const auto pad_end = (unsigned)this->get_padding_end();
+
+    modulate(0, pad_beg);
+    std::fill(X_N2 + pad_beg, X_N2 + pad_end, 1.f);
+    modulate(pad_end, (unsigned)this->N);
 }
 }
 }
@@ -74,28 +83,37 @@ template<>
 void
 Modem_BPSK_fast<short, float, float>::_modulate(const short* X_N1, float* X_N2, const size_t frame_id)
 {
-    auto size = (unsigned int)(this->N);
-
-    const auto vec_loop_size = size / mipp::nElReg<short>();
     const mipp::Reg<float> one = 1.f;
-    for (unsigned i = 0; i < vec_loop_size; i++)
+    const auto modulate = [&](const unsigned beg, const unsigned end)
     {
-        auto x1b = mipp::Reg<short>(&X_N1[i * mipp::nElReg<short>()]);
-        auto x1b_low = x1b.low().cvt<int>();
-        auto x1b_high = x1b.high().cvt<int>();
+        const auto vec_loop_size = (end - beg) / mipp::nElReg<short>();
+        for (unsigned i = 0; i < vec_loop_size; i++)
+        {
+            auto x1b = mipp::Reg<short>(&X_N1[beg + i * mipp::nElReg<short>()]);
+            auto x1b_low = x1b.low().cvt<int>();
+            auto x1b_high = x1b.high().cvt<int>();
 
-        auto x1r_low = x1b_low.cvt<float>();
-        auto x1r_high = x1b_high.cvt<float>();
+            auto x1r_low = x1b_low.cvt<float>();
+            auto x1r_high = x1b_high.cvt<float>();
 
-        auto x2r_low = one - (x1r_low + x1r_low);
-        auto x2r_high = one - (x1r_high + x1r_high);
+            auto x2r_low = one - (x1r_low + x1r_low);
+            auto x2r_high = one - (x1r_high + x1r_high);
 
-        x2r_low.store(&X_N2[i * 2 * mipp::nElReg<float>() + 0 * mipp::nElReg<float>()]);
-        x2r_high.store(&X_N2[i * 2 * mipp::nElReg<float>() + 1 * mipp::nElReg<float>()]);
-    }
+            x2r_low.store(&X_N2[beg + i * 2 * mipp::nElReg<float>() + 0 * mipp::nElReg<float>()]);
+            x2r_high.store(&X_N2[beg + i * 2 * mipp::nElReg<float>() + 1 * mipp::nElReg<float>()]);
+        }
+
+        for (unsigned i = beg + vec_loop_size * mipp::nElReg<short>(); i < end; i++)
+            X_N2[i] = (float)((short)1 - (X_N1[i] + X_N1[i])); // (X_N[i] == 1) ? -1 : +1
+    };
+
+    // the zero padded bits are known by the receiver: they are not modulated, their symbol is the one of the bit 0
+    const auto pad_beg = (unsigned)this->get_padding_begin();
+    const auto pad_end = (unsigned)this->get_padding_end();
 
-    for (unsigned i = vec_loop_size * mipp::nElReg<short>(); i < size; i++)
-        X_N2[i] = (float)((short)1 - (X_N1[i] + X_N1[i])); // (X_N[i] == 1) ? -1 : +1
+    modulate(0, pad_beg);
+    std::fill(X_N2 + pad_beg, X_N2 + pad_end, 1.f);
+    modulate(pad_end, (unsigned)this->N);
 }
 }
 }
@@ -108,39 +126,48 @@ template<>
 void
 Modem_BPSK_fast<signed char, float, float>::_modulate(const signed char* X_N1, float* X_N2, const size_t frame_id)
 {
-    auto size = (unsigned int)(this->N);
-
-    const auto vec_loop_size = size / mipp::nElReg<signed char>();
     const mipp::Reg<float> one = 1.f;
-    for (unsigned i = 0; i < vec_loop_size; i++)
+    const auto modulate = [&](const unsigned beg, const unsigned end)
     {
-        auto x1b = mipp::Reg<signed char>(&X_N1[i * mipp::nElReg<signed char>()]);
-        auto x1b_low = x1b.low().cvt<short>();
-        auto x1b_high = x1b.high().cvt<short>();
-
-        auto x1b_low_low = x1b_low.low().cvt<int>();
-        auto x1b_low_high = x1b_low.high().cvt<int>();
-        auto x1b_high_low = x1b_high.low().cvt<int>();
-        auto x1b_high_high = x1b_high.high().cvt<int>();
-
-        auto x1r_low_low = x1b_low_low.cvt<float>();
-        auto x1r_low_high = x1b_low_high.cvt<float>();
-        auto x1r_high_low = x1b_high_low.cvt<float>();
-        auto x1r_high_high = x1b_high_high.cvt<float>();
-
-        auto x2r_low_low = one - (x1r_low_low + x1r_low_low);
-        auto x2r_low_high = one - (x1r_low_high + x1r_low_high);
-        auto x2r_high_low = one - (x1r_high_low + x1r_high_low);
-        auto x2r_high_high = one - (x1r_high_high + x1r_high_high);
-
-        x2r_low_low.store(&X_N2[i * 4 * mipp::nElReg<float>() + 0 * mipp::nElReg<float>()]);
-        x2r_low_high.store(&X_N2[i * 4 * mipp::nElReg<float>() + 1 * mipp::nElReg<float>()]);
-        x2r_high_low.store(&X_N2[i * 4 * mipp::nElReg<float>() + 2 * mipp::nElReg<float>()]);
-        x2r_high_high.store(&X_N2[i * 4 * mipp::nElReg<float>() + 3 * mipp::nElReg<float>()]);
-    }
+        const auto vec_loop_size = (end - beg) / mipp::nElReg<signed char>();
+        for (unsigned i = 0; i < vec_loop_size; i++)
+        {
+            auto x1b = mipp::Reg<signed char>(&X_N1[beg + i * mipp::nElReg<signed char>()]);
+            auto x1b_low = x1b.low().cvt<short>();
+            auto x1b_high = x1b.high().cvt<short>();
+
+            auto x1b_low_low = x1b_low.low().cvt<int>();
+            auto x1b_low_high = x1b_low.high().cvt<int>();
+            auto x1b_high_low = x1b_high.low().cvt<int>();
+            auto x1b_high_high = x1b_high.high().cvt<int>();
+
+            auto x1r_low_low = x1b_low_low.cvt<float>();
+            auto x1r_low_high = x1b_low_high.cvt<float>();
+            auto x1r_high_low = x1b_high_low.cvt<float>();
+            auto x1r_high_high = x1b_high_high.cvt<float>();
+
+            auto x2r_low_low = one - (x1r_low_low + x1r_low_low);
+            auto x2r_low_high = one - (x1r_low_high + x1r_low_high);
+            auto x2r_high_low = one - (x1r_high_low + x1r_high_low);
+            auto x2r_high_high = one - (x1r_high_high + x1r_high_high);
+
+            x2r_low_low.store(&X_N2[beg + i * 4 * mipp::nElReg<float>() + 0 * mipp::nElReg<float>()]);
+            x2r_low_high.store(&X_N2[beg + i * 4 * mipp::nElReg<float>() + 1 * mipp::nElReg<float>()]);
+            x2r_high_low.store(&X_N2[beg + i * 4 * mipp::nElReg<float>() + 2 * mipp::nElReg<float>()]);
+            x2r_high_high.store(&X_N2[beg + i * 4 * mipp::nElReg<float>() + 3 * mipp::nElReg<float>()]);
+        }
+
+        for (unsigned i = beg + vec_loop_size * mipp::nElReg<signed char>(); i < end; i++)
+            X_N2[i] = (float)((signed char)1 - (X_N1[i] + X_N1[i])); // (X_N[i] == 1) ? -1 : +1
+    };
+
+    // the zero padded bits are known by the receiver: they are not modulated, their symbol is the one of the bit 0
+    const auto pad_beg = (unsigned)this->get_padding_begin();
+    const auto pad_end = (unsigned)this->get_padding_end();
 
-    for (unsigned i = vec_loop_size * mipp::nElReg<signed char>(); i < size; i++)
-        X_N2[i] = (float)((signed char)1 - (X_N1[i] + X_N1[i])); // (X_N[i] == 1) ? -1 : +1
+    modulate(0, pad_beg);
+    std::fill(X_N2 + pad_beg, X_N2 + pad_end, 1.f);
+    modulate(pad_end, (unsigned)this->N);
 }
 }
 }
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cmath>
 #include <sstream>
 #include <streampu.hpp>
 #include <string>
@@ -13,15 +15,19 @@ template<typename B>
 Monitor_BFER<B>::Monitor_BFER(const int K,
                               const unsigned max_fe,
                               const unsigned max_n_frames,
-                              const bool count_unknown_values)
+                              const bool count_unknown_values,
+                              const int dec_granularity)
   : Monitor()
   , K(K)
+  , n_info((dec_granularity > 0 && dec_granularity < K) ? dec_granularity : K)
   , max_fe(max_fe)
   , max_n_frames(max_n_frames)
   , count_unknown_values(count_unknown_values)
   , no_is_done(false)
   , err_hist(0)
   , err_hist_activated(false)
+  , counters(nullptr)
+  , shard(0)
 {
     const std::string name = "Monitor_BFER";
     this->set_name(name);
@@ -79,6 +85,25 @@ Monitor_BFER<B>::Monitor_BFER(const int K,
                              return n_be;
                          });
 
+    auto& p3 = this->create_task("check_errors_w", (int)mnt::tsk::check_errors_w);
+    auto p3s_U = this->template create_socket_in<B>(p3, "U", this->get_K());
+    auto p3s_V = this->template create_socket_in<B>(p3, "V", this->get_K());
+    auto p3s_W = this->template create_socket_in<double>(p3, "W", 1);
+
+    this->create_codelet(
+      p3,
+      [p3s_U, p3s_V, p3s_W](spu::module::Module& m, spu::runtime::Task& t, const size_t frame_id) -> int
+      {
+          auto& mnt = static_cast<Monitor_BFER<B>&>(m);
+
+          auto n_be = mnt._check_errors_w(static_cast<B*>(t[p3s_U].get_dataptr()),
+                                          static_cast<B*>(t[p3s_V].get_dataptr()),
+                                          static_cast<double*>(t[p3s_W].get_dataptr()),
+                                          frame_id);
+
+          return n_be;
+      });
+
     reset();
 }
 
@@ -115,6 +140,14 @@ Monitor_BFER<B>::clone() const
     return m;
 }
 
+template<typename B>
+void
+Monitor_BFER<B>::deep_copy(const Monitor_BFER<B>& m)
+{
+    spu::module::Stateful::deep_copy(m);
+    this->shard = 0; // the clone claims its own shard
+}
+
 template<typename B>
 bool
 Monitor_BFER<B>::equivalent(const Monitor_BFER<B>& m, bool do_throw) const
@@ -127,6 +160,16 @@ Monitor_BFER<B>::equivalent(const Monitor_BFER<B>& m, bool do_throw) const
         throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
     }
 
+    if (get_n_info() != m.get_n_info())
+    {
+        if (!do_throw) return false;
+
+        std::stringstream message;
+        message << "'get_n_info()' is different than 'm.get_n_info()' ('get_n_info()' = " << get_n_info()
+                << ", 'm.get_n_info()' = " << m.get_n_info() << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
     if (get_max_fe() != m.get_max_fe())
     {
         if (!do_throw) return false;
@@ -242,6 +285,49 @@ Monitor_BFER<B>::_check_errors2(const B* U,
     return n_be_total;
 }
 
+template<typename B>
+int
+Monitor_BFER<B>::check_errors_w(const B* U,
+                                const B* V,
+                                const double* W,
+                                const int frame_id,
+                                const bool managed_memory)
+{
+    (*this)[mnt::sck::check_errors_w::U].bind(U);
+    (*this)[mnt::sck::check_errors_w::V].bind(V);
+    (*this)[mnt::sck::check_errors_w::W].bind(W);
+    const auto& status = (*this)[mnt::tsk::check_errors_w].exec(frame_id, managed_memory);
+
+    return status[0];
+}
+
+template<typename B>
+int
+Monitor_BFER<B>::_check_errors_w(const B* U, const B* V, const double* W, const size_t frame_id)
+{
+    int n_be_total = 0;
+    for (size_t f = 0; f < this->get_n_frames(); f++)
+    {
+        auto n_be = this->__check_errors(U + f * get_K(), V + f * get_K(), f);
+        n_be_total += n_be;
+
+        if (n_be)
+        {
+            const auto w_be = W[f] * (double)n_be;
+            vals.w_fe += W[f];
+            vals.w2_fe += W[f] * W[f];
+            vals.w_be += w_be;
+            vals.w2_be += w_be * w_be;
+        }
+    }
+
+    this->callback_check.notify();
+
+    if (this->fe_limit_achieved()) this->callback_fe_limit_achieved.notify();
+
+    return n_be_total;
+}
+
 template<typename B>
 int
 Monitor_BFER<B>::__check_errors(const B* U, const B* V, const size_t frame_id)
@@ -249,9 +335,9 @@ Monitor_BFER<B>::__check_errors(const B* U, const B* V, const size_t frame_id)
     int bit_errors_count;
 
     if (get_count_unknown_values())
-        bit_errors_count = (int)tools::hamming_distance_unk(U, V, get_K());
+        bit_errors_count = (int)tools::hamming_distance_unk(U, V, get_n_info());
     else
-        bit_errors_count = (int)tools::hamming_distance(U, V, get_K());
+        bit_errors_count = (int)tools::hamming_distance(U, V, get_n_info());
 
     if (bit_errors_count)
     {
@@ -265,6 +351,12 @@ Monitor_BFER<B>::__check_errors(const B* U, const B* V, const size_t frame_id)
 
     vals.n_fra++;
 
+    if (this->counters != nullptr)
+    {
+        if (!this->shard) this->shard = this->counters->claim_shard();
+        this->counters->add_frame(this->shard, (unsigned)bit_errors_count);
+    }
+
     return bit_errors_count;
 }
 
@@ -272,14 +364,17 @@ template<typename B>
 bool
 Monitor_BFER<B>::fe_limit_achieved() const
 {
-    return get_max_fe() != 0 && get_n_fe() >= get_max_fe();
+    if (get_max_fe() == 0) return false;
+    return (this->counters != nullptr ? this->counters->get_n_fe() : get_n_fe()) >= get_max_fe();
 }
 
 template<typename B>
 bool
 Monitor_BFER<B>::frame_limit_achieved() const
 {
-    return get_max_n_frames() != 0 && get_n_analyzed_fra() >= get_max_n_frames();
+    if (get_max_n_frames() == 0) return false;
+    return (this->counters != nullptr ? this->counters->get_n_analyzed_fra() : get_n_analyzed_fra()) >=
+           get_max_n_frames();
 }
 
 template<typename B>
@@ -310,6 +405,13 @@ Monitor_BFER<B>::get_K() const
     return K;
 }
 
+template<typename B>
+int
+Monitor_BFER<B>::get_n_info() const
+{
+    return n_info;
+}
+
 template<typename B>
 unsigned
 Monitor_BFER<B>::get_max_n_frames() const
@@ -364,13 +466,53 @@ Monitor_BFER<B>::get_ber() const
 {
     auto t_ber = 0.f;
     if (this->get_n_be() != 0)
-        t_ber = (float)this->get_n_be() / (float)this->get_n_analyzed_fra() / (float)this->get_K();
+        t_ber = (float)this->get_n_be() / (float)this->get_n_analyzed_fra() / (float)this->get_n_info();
     else
-        t_ber = (1.f) / ((float)this->get_n_analyzed_fra()) / this->get_K();
+        t_ber = (1.f) / ((float)this->get_n_analyzed_fra()) / this->get_n_info();
 
     return t_ber;
 }
 
+template<typename B>
+double
+Monitor_BFER<B>::get_weighted_fer() const
+{
+    return this->get_n_analyzed_fra() ? vals.w_fe / (double)this->get_n_analyzed_fra() : 0.;
+}
+
+template<typename B>
+double
+Monitor_BFER<B>::get_weighted_ber() const
+{
+    return this->get_n_analyzed_fra() ? vals.w_be / (double)this->get_n_analyzed_fra() / (double)this->get_n_info()
+                                      : 0.;
+}
+
+template<typename B>
+double
+Monitor_BFER<B>::get_weighted_fer_ci() const
+{
+    const auto n = (double)this->get_n_analyzed_fra();
+    if (n < 2.) return 0.;
+
+    // the estimate is the mean of the weights of the frames (0 for the right frames)
+    const auto mean = vals.w_fe / n;
+    const auto var = std::max(vals.w2_fe / n - mean * mean, 0.) / (n - 1.);
+    return 1.96 * std::sqrt(var);
+}
+
+template<typename B>
+double
+Monitor_BFER<B>::get_weighted_ber_ci() const
+{
+    const auto n = (double)this->get_n_analyzed_fra();
+    if (n < 2.) return 0.;
+
+    const auto mean = vals.w_be / n;
+    const auto var = std::max(vals.w2_be / n - mean * mean, 0.) / (n - 1.);
+    return 1.96 * std::sqrt(var) / (double)this->get_n_info();
+}
+
 template<typename B>
 bool
 Monitor_BFER<B>::get_count_unknown_values() const
@@ -392,6 +534,38 @@ Monitor_BFER<B>::activate_err_histogram(bool val)
     err_hist_activated = val;
 }
 
+template<typename B>
+void
+Monitor_BFER<B>::add_values(const unsigned long long n_fra,
+                            const unsigned long long n_be,
+                            const unsigned long long n_fe,
+                            const tools::Histogram<int>& err_hist)
+{
+    Attributes v;
+    v.n_fra = n_fra;
+    v.n_be = n_be;
+    v.n_fe = n_fe;
+    collect(v);
+    this->err_hist.add_values(err_hist);
+
+    if (this->counters != nullptr) this->counters->add_values(n_fra, n_be, n_fe);
+}
+
+template<typename B>
+void
+Monitor_BFER<B>::set_counters(std::shared_ptr<tools::Monitor_BFER_counters> counters)
+{
+    this->counters = counters;
+    this->shard = 0;
+}
+
+template<typename B>
+const std::shared_ptr<tools::Monitor_BFER_counters>&
+Monitor_BFER<B>::get_counters() const
+{
+    return this->counters;
+}
+
 template<typename B>
 uint32_t
 Monitor_BFER<B>::record_callback_fe(std::function<void(unsigned, int)> callback)
@@ -520,6 +694,10 @@ Monitor_BFER<B>::Attributes ::operator+=(const Attributes& a)
     n_be += a.n_be;
     n_fe += a.n_fe;
     n_fra += a.n_fra;
+    w_fe += a.w_fe;
+    w2_fe += a.w2_fe;
+    w_be += a.w_be;
+    w2_be += a.w2_be;
 
     return *this;
 }
@@ -531,6 +709,10 @@ Monitor_BFER<B>::Attributes ::reset()
     n_be = 0;
     n_fe = 0;
     n_fra = 0;
+    w_fe = 0.;
+    w2_fe = 0.;
+    w_be = 0.;
+    w2_be = 0.;
 }
 
 template<typename B>
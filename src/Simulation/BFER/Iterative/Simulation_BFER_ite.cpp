@@ -3,6 +3,7 @@
 #include <iostream>
 #include <random>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Factory/Module/Coset/Coset.hpp"
@@ -671,7 +672,7 @@ Simulation_BFER_ite<B, R, Q>::create_sequence()
         this->noise->record_callback_update([m]() { m->notify_noise_update(); });
 
     // set different seeds in the modules that uses PRNG
-    std::mt19937 prng(params_BFER_ite.local_seed);
+    std::mt19937 prng(params_BFER_ite.local_seed + this->seed_offset);
     for (auto& m : this->sequence->template get_modules<spu::tools::Interface_set_seed>())
         m->set_seed(prng());
 
@@ -758,6 +759,20 @@ Simulation_BFER_ite<B, R, Q>::create_sequence()
     }
 }
 
+template<typename B, typename R, typename Q>
+std::unique_ptr<Simulation_BFER<B, R>>
+Simulation_BFER_ite<B, R, Q>::build_noise_worker(const int seed_offset, const int n_threads) const
+{
+    // the worker owns a copy of the parameters with its share of the threads
+    std::unique_ptr<factory::BFER_ite> params_worker(params_BFER_ite.clone());
+    params_worker->n_threads = n_threads;
+
+    auto worker = std::unique_ptr<Simulation_BFER_ite<B, R, Q>>(new Simulation_BFER_ite<B, R, Q>(*params_worker));
+    worker->params_worker = std::move(params_worker);
+    worker->seed_offset = seed_offset;
+    return std::move(worker);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -76,6 +76,8 @@ class Simulation_BFER_ite : public Simulation_BFER<B, R>
     virtual void create_modules();
     virtual void bind_sockets();
     virtual void create_sequence();
+
+    virtual std::unique_ptr<Simulation_BFER<B, R>> build_noise_worker(const int seed_offset, const int n_threads) const;
 };
 
 }
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <exception>
 #include <fstream>
 #include <iomanip>
@@ -8,10 +9,12 @@
 #include <streampu.hpp>
 #include <string>
 #include <thread>
+#include <utility>
 
 #include "Simulation/BFER/Simulation_BFER.hpp"
 #include "Tools/Display/Statistics/Statistics.hpp"
 #include "Tools/Display/rang_format/rang_format.h"
+#include "Tools/Noise/Noise_range_adaptive.hpp"
 #include "Tools/Reporter/BFER/Reporter_BFER.hpp"
 #include "Tools/Reporter/MI/Reporter_MI.hpp"
 #include "Tools/Reporter/Noise/Reporter_noise.hpp"
@@ -28,6 +31,10 @@ Simulation_BFER<B, R>::Simulation_BFER(const factory::BFER& params_BFER)
   , noise(params_BFER.noise->build<>())
   , channel_params(params_BFER.n_frames)
   , dumper(params_BFER.n_threads)
+  , red_group(0)
+  , noise_point(0)
+  , noise_points_stop(nullptr)
+  , seed_offset(0)
 {
     if (params_BFER.n_threads < 1)
     {
@@ -95,7 +102,7 @@ Simulation_BFER<B, R>::build_reporters(const tools ::Noise<>* noise,
         reporters.push_back(std::unique_ptr<tools::Reporter_MI<B, R>>(reporter_MI));
     }
 
-    auto reporter_BFER = new tools::Reporter_BFER<B>(*monitor_er);
+    auto reporter_BFER = new tools::Reporter_BFER<B>(*monitor_er, this->params_BFER.chn->is_scale != 1.f);
     reporters.push_back(std::unique_ptr<tools::Reporter_BFER<B>>(reporter_BFER));
     auto reporter_thr = new tools::Reporter_throughput<uint64_t>(*monitor_er);
     reporters.push_back(std::unique_ptr<tools::Reporter_throughput<uint64_t>>(reporter_thr));
@@ -125,10 +132,13 @@ Simulation_BFER<B, R>::configure_sequence_tasks()
     if (!params_BFER.sequence_path.empty())
     {
         std::ofstream dot_file(params_BFER.sequence_path);
-        this->sequence->export_dot(dot_file);
+        if (this->pipeline != nullptr)
+            this->pipeline->export_dot(dot_file);
+        else
+            this->sequence->export_dot(dot_file);
     }
 
-    for (auto& mod : sequence->get_modules<spu::module::Module>())
+    for (auto& mod : this->get_modules<spu::module::Module>())
         for (auto& tsk : mod->tasks)
         {
             if (this->params.statistics) tsk->set_stats(true);
@@ -146,33 +156,49 @@ Simulation_BFER<B, R>::configure_sequence_tasks()
         }
 }
 
+template<typename B, typename R>
+std::vector<std::vector<spu::module::Module*>>
+Simulation_BFER<B, R>::get_modules_per_types() const
+{
+    if (this->pipeline != nullptr) return this->pipeline->get_modules_per_types();
+    return this->sequence->get_modules_per_types();
+}
+
 template<typename B, typename R>
 void
 Simulation_BFER<B, R>::create_monitors_reduction()
 {
-    auto monitors_bfer = sequence->get_modules<module::Monitor_BFER<B>>();
+    auto monitors_bfer = this->get_modules<module::Monitor_BFER<B>>();
 #ifdef AFF3CT_MPI
     this->monitor_er_red.reset(new tools::Monitor_reduction_MPI<module::Monitor_BFER<B>>(monitors_bfer));
 #else
-    this->monitor_er_red.reset(new tools::Monitor_reduction<module::Monitor_BFER<B>>(monitors_bfer));
+    if (params_BFER.mnt_red_atomic)
+    {
+        // the monitors stop on the shared counters, the reduction is only required to display and save the values
+        this->counters_er = std::make_shared<tools::Monitor_BFER_counters>(monitors_bfer.size());
+        for (auto& m : monitors_bfer)
+            m->set_counters(this->counters_er);
+    }
+    this->monitor_er_red.reset(new tools::Monitor_reduction<module::Monitor_BFER<B>>(monitors_bfer, this->red_group));
 #endif
 
     if (params_BFER.mnt_mutinfo)
     {
-        auto monitors_mi = sequence->get_modules<module::Monitor_MI<B, R>>();
+        auto monitors_mi = this->get_modules<module::Monitor_MI<B, R>>();
 #ifdef AFF3CT_MPI
         this->monitor_mi_red.reset(new tools::Monitor_reduction_MPI<module::Monitor_MI<B, R>>(monitors_mi));
 #else
-        this->monitor_mi_red.reset(new tools::Monitor_reduction<module::Monitor_MI<B, R>>(monitors_mi));
+        this->monitor_mi_red.reset(
+          new tools::Monitor_reduction<module::Monitor_MI<B, R>>(monitors_mi, this->red_group));
 #endif
     }
 
-    tools::Monitor_reduction_static::set_master_thread_id(std::this_thread::get_id());
+    tools::Monitor_reduction_static::set_master_thread_id(std::this_thread::get_id(), this->red_group);
 #ifdef AFF3CT_MPI
     tools::Monitor_reduction_static::set_reduce_frequency(params_BFER.mnt_mpi_comm_freq);
 #else
     auto freq = std::chrono::milliseconds(0);
-    if (params_BFER.mnt_red_lazy)
+    if (params_BFER.mnt_red_lazy || params_BFER.mnt_red_atomic)
     {
         if (params_BFER.mnt_red_lazy_freq.count())
             freq = params_BFER.mnt_red_lazy_freq;
@@ -181,14 +207,46 @@ Simulation_BFER<B, R>::create_monitors_reduction()
     }
     tools::Monitor_reduction_static::set_reduce_frequency(freq);
 #endif
-    tools::Monitor_reduction_static::reset_all();
-    tools::Monitor_reduction_static::check_reducible();
+    tools::Monitor_reduction_static::reset_all(this->red_group);
+    tools::Monitor_reduction_static::check_reducible(this->red_group);
 }
 
 template<typename B, typename R>
 void
 Simulation_BFER<B, R>::launch()
 {
+    int noise_begin = 0;
+    int noise_end = (int)params_BFER.noise->range.size();
+    int noise_step = 1;
+    if (params_BFER.noise->type == "EP")
+    {
+        noise_begin = (int)params_BFER.noise->range.size() - 1;
+        noise_end = -1;
+        noise_step = -1;
+    }
+
+#ifndef AFF3CT_MPI
+    if (params_BFER.chkpt_enable)
+    {
+        this->checkpoint.reset(new tools::Monitor_checkpoint(params_BFER.chkpt_path, build_monitor_er()->get_n_info()));
+        if (params_BFER.chkpt_resume) this->checkpoint->load();
+
+        // a resumed simulation must not replay the frames of the previous runs
+        this->seed_offset = (int)this->checkpoint->get_n_runs() * params_BFER.n_threads * params_BFER.noise_par;
+    }
+
+    if (params_BFER.noise_par > 1 && params_BFER.noise->range.size() > 1 && !params_BFER.err_track_revert &&
+        !params_BFER.debug && params_BFER.noise->adapt_fer == 0.f)
+    {
+        std::vector<int> noise_ids;
+        for (auto noise_idx = noise_begin; noise_idx != noise_end; noise_idx += noise_step)
+            noise_ids.push_back(noise_idx);
+
+        this->launch_noise_points_parallel(noise_ids);
+        return;
+    }
+#endif
+
     if (!params_BFER.err_track_revert)
     {
         this->create_modules();
@@ -202,22 +260,28 @@ Simulation_BFER<B, R>::launch()
         this->terminal = this->build_terminal(this->reporters);
     }
 
-    int noise_begin = 0;
-    int noise_end = (int)params_BFER.noise->range.size();
-    int noise_step = 1;
-    if (params_BFER.noise->type == "EP")
+    std::vector<float> noise_vals;
+    for (auto noise_idx = noise_begin; noise_idx != noise_end; noise_idx += noise_step)
+        noise_vals.push_back(params_BFER.noise->range[noise_idx]);
+
+    // the adaptive sweep schedules the next noise point from the results of the previous ones
+    std::unique_ptr<tools::Noise_range_adaptive> noise_sweep;
+    if (params_BFER.noise->adapt_fer > 0.f && !params_BFER.err_track_revert)
     {
-        noise_begin = (int)params_BFER.noise->range.size() - 1;
-        noise_end = -1;
-        noise_step = -1;
+        noise_sweep.reset(new tools::Noise_range_adaptive(
+          noise_vals, params_BFER.noise->adapt_fer, params_BFER.noise->adapt_step, params_BFER.noise->adapt_dec));
+
+        float noise_val;
+        noise_vals.clear();
+        if (noise_sweep->next(noise_val)) noise_vals.push_back(noise_val);
     }
 
     // for each NOISE to be simulated
-    for (auto noise_idx = noise_begin; noise_idx != noise_end; noise_idx += noise_step)
+    for (size_t n = 0; n < noise_vals.size(); n++)
     {
         auto bit_rate = (float)params_BFER.src->K / (float)params_BFER.cdc->N;
         params_BFER.noise->template update<>(
-          *this->noise, params_BFER.noise->range[noise_idx], bit_rate, params_BFER.mdm->bps, params_BFER.mdm->cpm_upf);
+          *this->noise, noise_vals[n], bit_rate, params_BFER.mdm->bps, params_BFER.mdm->cpm_upf);
 
         std::fill(this->channel_params.begin(), this->channel_params.end(), this->noise->get_value());
 
@@ -266,7 +330,7 @@ Simulation_BFER<B, R>::launch()
         if (params_BFER.mpi_rank == 0)
 #endif
             if (params_BFER.display_legend)
-                if ((!params_BFER.ter->disabled && noise_idx == noise_begin && !params_BFER.debug) ||
+                if ((!params_BFER.ter->disabled && n == 0 && !params_BFER.debug) ||
                     (params_BFER.statistics && !params_BFER.debug))
                     terminal->legend(std::cout);
 
@@ -282,8 +346,7 @@ Simulation_BFER<B, R>::launch()
 
         try
         {
-            this->sequence->exec([this]() { return this->stop_condition(); });
-            tools::Monitor_reduction_static::last_reduce_all(); // final reduction
+            this->exec_noise_point(noise_vals[n]);
         }
         catch (std::exception const& e)
         {
@@ -307,64 +370,279 @@ Simulation_BFER<B, R>::launch()
                 if (params_BFER.statistics)
                 {
                     std::cout << "#" << std::endl;
-                    spu::tools::Stats::show(this->sequence->get_modules_per_types(), true, true, std::cout);
+                    spu::tools::Stats::show(this->get_modules_per_types(), true, true, std::cout);
                     std::cout << "#" << std::endl;
                 }
             }
 
-        if (params_BFER.mnt_er->err_hist != -1)
+        this->dump_noise_point();
+
+        const auto limit_reached = !params_BFER.crit_nostop && !this->monitor_er_red->fe_limit_achieved() &&
+                                   (this->monitor_er_red->frame_limit_achieved() || this->stop_time_reached());
+
+        if (noise_sweep != nullptr)
         {
-            auto err_hist = monitor_er_red->get_err_hist();
+            noise_sweep->add_result(noise_vals[n],
+                                    this->monitor_er_red->get_n_fe(),
+                                    this->monitor_er_red->get_n_analyzed_fra(),
+                                    limit_reached);
 
-            if (err_hist.get_n_values() != 0)
-            {
-                std::string noise_value;
-                switch (this->noise->get_type())
-                {
-                    case tools::Noise_type::SIGMA:
-                        if (params_BFER.noise->type == "EBN0")
-                            noise_value = std::to_string(dynamic_cast<tools::Sigma<>*>(this->noise.get())->get_ebn0());
-                        else //(params_BFER.noise_type == "ESN0")
-                            noise_value = std::to_string(dynamic_cast<tools::Sigma<>*>(this->noise.get())->get_esn0());
-                        break;
-                    case tools::Noise_type::ROP:
-                    case tools::Noise_type::EP:
-                        noise_value = std::to_string(this->noise->get_value());
-                        break;
-                }
+            float noise_val;
+            if (noise_sweep->next(noise_val)) noise_vals.push_back(noise_val);
+        }
+        else if (limit_reached && !params_BFER.err_track_revert)
+            break;
 
-                std::ofstream file_err_hist(params_BFER.mnt_er->err_hist_path + "_" + noise_value + ".txt");
-                file_err_hist << "\"Number of error bits per wrong frame\"; \"Histogram (noise: " << noise_value
-                              << this->noise->get_unity() << ", on " << err_hist.get_n_values() << " frames)\""
-                              << std::endl;
-
-                int max;
-                if (params_BFER.mnt_er->err_hist == 0)
-                    max = err_hist.get_hist_max();
-                else
-                    max = params_BFER.mnt_er->err_hist;
-                err_hist.dump(file_err_hist, 0, max);
-            }
+        for (auto& mod : this->get_modules<spu::module::Module>())
+            for (auto& tsk : mod->tasks)
+                tsk->reset();
+
+        tools::Monitor_reduction_static::reset_all();
+    }
+
+#ifdef AFF3CT_MPI
+    if (params_BFER.mpi_rank == 0)
+#endif
+        if (noise_sweep != nullptr && !noise_sweep->is_bracketed() && !this->simu_error)
+            std::clog << rang::tag::warning << "The adaptive sweep did not bracket the target FER ("
+                      << params_BFER.noise->adapt_fer << "), the noise range should be extended." << std::endl;
+}
+
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::launch_noise_points_parallel(const std::vector<int>& noise_ids)
+{
+    // the 'n_threads' threads are split between the workers (at least one thread per worker) to not oversubscribe the
+    // cores, the replicas of a sequence are fixed when it is built so the threads of a worker that has no more noise
+    // point to simulate can't be given to the workers that are still running
+    const auto n_workers = std::min({ (size_t)params_BFER.noise_par, noise_ids.size(), (size_t)params_BFER.n_threads });
+
+    // the workers are built one after the other by the current thread: the reduction groups of their monitors have to
+    // exist before the simulation loops start
+    std::vector<std::unique_ptr<Simulation_BFER<B, R>>> workers;
+    for (size_t w = 0; w < n_workers; w++)
+    {
+        const auto n_threads = params_BFER.n_threads / (int)n_workers +
+                               ((int)w < params_BFER.n_threads % (int)n_workers ? 1 : 0);
+        workers.push_back(this->build_noise_worker(this->seed_offset + (int)w * params_BFER.n_threads, n_threads));
+        auto& worker = *workers.back();
+        worker.red_group = w + 1;
+        worker.checkpoint = this->checkpoint;
+
+        worker.create_modules();
+        worker.bind_sockets();
+        worker.create_sequence();
+        worker.configure_sequence_tasks();
+        worker.create_monitors_reduction();
+
+        worker.reporters =
+          worker.build_reporters(worker.noise.get(), worker.monitor_er_red.get(), worker.monitor_mi_red.get());
+        worker.terminal = worker.build_terminal(worker.reporters);
+    }
+
+    if (params_BFER.display_legend && !params_BFER.ter->disabled && !params_BFER.statistics)
+        workers[0]->terminal->legend(std::cout);
+
+    std::atomic<size_t> next_point(0);
+    std::atomic<size_t> stop_point(noise_ids.size());
+    std::mutex mtx_display;
+    std::vector<std::exception_ptr> errors(n_workers);
+
+    std::vector<std::thread> threads;
+    for (size_t w = 0; w < n_workers; w++)
+        threads.push_back(std::thread(
+          [&, w]()
+          {
+              try
+              {
+                  workers[w]->run_noise_points(noise_ids, next_point, stop_point, mtx_display);
+              }
+              catch (...)
+              {
+                  errors[w] = std::current_exception();
+                  stop_point = 0; // cancel the other noise points
+              }
+          }));
+
+    for (auto& t : threads)
+        t.join();
+
+    for (auto& worker : workers)
+        this->simu_error |= worker->simu_error;
+
+    for (auto& e : errors)
+        if (e != nullptr) std::rethrow_exception(e);
+}
+
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::run_noise_points(const std::vector<int>& noise_ids,
+                                        std::atomic<size_t>& next_point,
+                                        std::atomic<size_t>& stop_point,
+                                        std::mutex& mtx_display)
+{
+    tools::Monitor_reduction_static::set_master_thread_id(std::this_thread::get_id(), this->red_group);
+    this->noise_points_stop = &stop_point;
+
+    for (auto p = next_point++; p < stop_point; p = next_point++)
+    {
+        this->noise_point = p;
+
+        auto bit_rate = (float)params_BFER.src->K / (float)params_BFER.cdc->N;
+        params_BFER.noise->template update<>(*this->noise,
+                                             params_BFER.noise->range[noise_ids[p]],
+                                             bit_rate,
+                                             params_BFER.mdm->bps,
+                                             params_BFER.mdm->cpm_upf);
+
+        std::fill(this->channel_params.begin(), this->channel_params.end(), this->noise->get_value());
+
+        tools::Monitor_reduction_static::reset_all(this->red_group);
+        this->t_start_noise_point = std::chrono::steady_clock::now();
+
+        try
+        {
+            this->exec_noise_point(params_BFER.noise->range[noise_ids[p]]);
         }
+        catch (std::exception const& e)
+        {
+            tools::Monitor_reduction_static::last_reduce_all(true, this->red_group); // final reduction
 
-        if (this->dumper_red != nullptr && !this->simu_error)
+            std::lock_guard<std::mutex> lock(mtx_display);
+            terminal->final_report(std::cout);
+            rang::format_on_each_line(std::cerr, std::string(e.what()) + "\n", rang::tag::error);
+            this->simu_error = true;
+        }
+
+        // a lower noise point stopped the simulation in the meantime, this noise point is not reported
+        const auto canceled = p >= stop_point;
+
+        if (!params_BFER.ter->disabled && !this->simu_error && !canceled)
         {
-            std::stringstream s_noise;
-            s_noise << std::setprecision(2) << std::fixed << this->noise->get_value();
+            // the final reports are displayed in the order of completion of the noise points
+            std::lock_guard<std::mutex> lock(mtx_display);
+            if (params_BFER.statistics && params_BFER.display_legend) terminal->legend(std::cout);
+
+            terminal->final_report(std::cout);
 
-            this->dumper_red->dump(params_BFER.err_track_path + "_" + s_noise.str());
-            this->dumper_red->clear();
+            if (params_BFER.statistics)
+            {
+                std::cout << "#" << std::endl;
+                spu::tools::Stats::show(this->get_modules_per_types(), true, true, std::cout);
+                std::cout << "#" << std::endl;
+            }
         }
 
-        if (!params_BFER.crit_nostop && !params_BFER.err_track_revert && !this->monitor_er_red->fe_limit_achieved() &&
+        if (!canceled) this->dump_noise_point();
+
+        // same stop criterion as the sequential simulation: the next noise points are canceled
+        if (!params_BFER.crit_nostop && !canceled && !this->monitor_er_red->fe_limit_achieved() &&
             (this->monitor_er_red->frame_limit_achieved() || this->stop_time_reached()))
-            break;
+        {
+            auto stop = stop_point.load();
+            while (p + 1 < stop && !stop_point.compare_exchange_weak(stop, p + 1))
+                ;
+        }
 
-        for (auto& mod : sequence->get_modules<spu::module::Module>())
+        for (auto& mod : this->get_modules<spu::module::Module>())
             for (auto& tsk : mod->tasks)
                 tsk->reset();
+    }
 
-        tools::Monitor_reduction_static::reset_all();
+    this->noise_points_stop = nullptr;
+}
+
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::exec_noise_point(const float noise_val)
+{
+#ifndef AFF3CT_MPI
+    if (this->counters_er != nullptr) this->counters_er->reset();
+#endif
+
+    if (this->checkpoint != nullptr)
+    {
+        // the saved values are added to the monitor of the first thread, the next reductions take them into account
+        auto monitors = this->get_modules<module::Monitor_BFER<B>>();
+        if (this->checkpoint->restore(noise_val, *monitors[0]))
+            tools::Monitor_reduction_static::reduce_all(true, true, this->red_group);
+        this->t_last_checkpoint = std::chrono::steady_clock::now();
+    }
+
+    bool pause = false;
+    do
+    {
+        if (this->pipeline != nullptr)
+            this->pipeline->exec([this]() { return this->stop_condition(); });
+        else
+            this->sequence->exec([this]() { return this->stop_condition(); });
+        tools::Monitor_reduction_static::last_reduce_all(true, this->red_group); // final reduction
+
+        if (this->checkpoint != nullptr)
+        {
+            // the threads are stopped: the values of the monitors are consistent, even the error histogram
+            this->checkpoint->save(noise_val, *this->monitor_er_red);
+
+            // the sequence has been stopped only to save the checkpoint, the noise point is not done
+            pause = this->checkpoint_due() && !this->stop_time_reached() &&
+                    !this->monitor_er_red->module::Monitor_BFER<B>::is_done() &&
+                    !(this->monitor_mi_red != nullptr && this->monitor_mi_red->module::Monitor_MI<B, R>::is_done()) &&
+                    !(this->noise_points_stop != nullptr && this->noise_point >= *this->noise_points_stop);
+            if (pause)
+            {
+                this->t_last_checkpoint = std::chrono::steady_clock::now();
+                tools::Monitor_reduction_static::resume_all(this->red_group);
+            }
+        }
+    } while (pause);
+}
+
+template<typename B, typename R>
+void
+Simulation_BFER<B, R>::dump_noise_point()
+{
+    if (params_BFER.mnt_er->err_hist != -1)
+    {
+        auto err_hist = monitor_er_red->get_err_hist();
+
+        if (err_hist.get_n_values() != 0)
+        {
+            std::string noise_value;
+            switch (this->noise->get_type())
+            {
+                case tools::Noise_type::SIGMA:
+                    if (params_BFER.noise->type == "EBN0")
+                        noise_value = std::to_string(dynamic_cast<tools::Sigma<>*>(this->noise.get())->get_ebn0());
+                    else //(params_BFER.noise_type == "ESN0")
+                        noise_value = std::to_string(dynamic_cast<tools::Sigma<>*>(this->noise.get())->get_esn0());
+                    break;
+                case tools::Noise_type::ROP:
+                case tools::Noise_type::EP:
+                    noise_value = std::to_string(this->noise->get_value());
+                    break;
+            }
+
+            std::ofstream file_err_hist(params_BFER.mnt_er->err_hist_path + "_" + noise_value + ".txt");
+            file_err_hist << "\"Number of error bits per wrong frame\"; \"Histogram (noise: " << noise_value
+                          << this->noise->get_unity() << ", on " << err_hist.get_n_values() << " frames)\""
+                          << std::endl;
+
+            int max;
+            if (params_BFER.mnt_er->err_hist == 0)
+                max = err_hist.get_hist_max();
+            else
+                max = params_BFER.mnt_er->err_hist;
+            err_hist.dump(file_err_hist, 0, max);
+        }
+    }
+
+    if (this->dumper_red != nullptr && !this->simu_error)
+    {
+        std::stringstream s_noise;
+        s_noise << std::setprecision(2) << std::fixed << this->noise->get_value();
+
+        this->dumper_red->dump(params_BFER.err_track_path + "_" + s_noise.str());
+        this->dumper_red->clear();
     }
 }
 
@@ -376,11 +654,21 @@ Simulation_BFER<B, R>::stop_time_reached()
            (std::chrono::steady_clock::now() - this->t_start_noise_point) >= this->params_BFER.stop_time;
 }
 
+template<typename B, typename R>
+bool
+Simulation_BFER<B, R>::checkpoint_due()
+{
+    return this->checkpoint != nullptr && this->params_BFER.chkpt_freq != std::chrono::seconds(0) &&
+           (std::chrono::steady_clock::now() - this->t_last_checkpoint) >= this->params_BFER.chkpt_freq;
+}
+
 template<typename B, typename R>
 bool
 Simulation_BFER<B, R>::stop_condition()
 {
-    return tools::Monitor_reduction_static::is_done_all() || stop_time_reached();
+    return tools::Monitor_reduction_static::is_done_all(false, this->red_group) || stop_time_reached() ||
+           (this->noise_points_stop != nullptr && this->noise_point >= *this->noise_points_stop) ||
+           this->checkpoint_due();
 }
 
 // ==================================================================================== explicit template instantiation
@@ -1,8 +1,11 @@
 #ifndef SIMULATION_BFER_HPP_
 #define SIMULATION_BFER_HPP_
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include <streampu.hpp>
 #include <vector>
 
@@ -12,6 +15,8 @@
 #include "Tools/Display/Dumper/Dumper.hpp"
 #include "Tools/Display/Dumper/Dumper_reduction.hpp"
 #include "Tools/Math/Distribution/Distributions.hpp"
+#include "Tools/Monitor/Monitor_BFER_counters.hpp"
+#include "Tools/Monitor/Monitor_checkpoint.hpp"
 #include "Tools/Monitor/Monitor_reduction.hpp"
 #ifdef AFF3CT_MPI
 #include "Tools/Monitor/Monitor_reduction_MPI.hpp"
@@ -30,6 +35,7 @@ template<typename B = int, typename R = float>
 class Simulation_BFER : public Simulation
 {
   protected:
+    std::unique_ptr<const factory::BFER> params_worker; // parameters owned by a noise point worker (see below)
     const factory::Simulation& params;
     const factory::BFER& params_BFER;
 
@@ -42,6 +48,7 @@ class Simulation_BFER : public Simulation
     std::unique_ptr<module::Monitor_BFER<B>> monitor_er;
     std::unique_ptr<module::Monitor_MI<B, R>> monitor_mi;
     std::unique_ptr<spu::runtime::Sequence> sequence;
+    std::unique_ptr<spu::runtime::Pipeline> pipeline; // replaces the sequence when the chain is split in stages
 
     std::vector<std::unique_ptr<spu::tools::Reporter>> reporters;
     std::unique_ptr<spu::tools::Terminal> terminal;
@@ -52,6 +59,7 @@ class Simulation_BFER : public Simulation
 #else
     std::unique_ptr<tools::Monitor_reduction<module::Monitor_BFER<B>>> monitor_er_red;
     std::unique_ptr<tools::Monitor_reduction<module::Monitor_MI<B, R>>> monitor_mi_red;
+    std::shared_ptr<tools::Monitor_BFER_counters> counters_er; // frame and error counters shared by the threads
 #endif
 
     // dump frames into files
@@ -60,6 +68,16 @@ class Simulation_BFER : public Simulation
 
     std::chrono::steady_clock::time_point t_start_noise_point;
 
+    // concurrent noise points
+    size_t red_group;                             // reduction group of the monitors
+    size_t noise_point;                           // position of the current noise point in the simulated range
+    const std::atomic<size_t>* noise_points_stop; // the noise points from this position are canceled
+
+    // checkpoint of the monitors values (shared by the concurrent noise points)
+    std::shared_ptr<tools::Monitor_checkpoint> checkpoint;
+    std::chrono::steady_clock::time_point t_last_checkpoint;
+    int seed_offset; // added to 'local_seed' to seed the PRNGs of the sequence
+
   public:
     explicit Simulation_BFER(const factory::BFER& params_BFER);
 
@@ -82,10 +100,54 @@ class Simulation_BFER : public Simulation
     void configure_sequence_tasks();
     void create_monitors_reduction();
 
+    /*
+     * return the modules of the sequence or of the pipeline stages
+     */
+    template<class C = spu::module::Module>
+    std::vector<C*> get_modules() const;
+    std::vector<std::vector<spu::module::Module*>> get_modules_per_types() const;
+
+    /*
+     * build a new simulation with its own modules, sequence and monitors to simulate a part of the noise points, the
+     * sequence of the new simulation is replicated on 'n_threads' threads and its PRNGs are seeded from 'local_seed' +
+     * 'seed_offset'
+     */
+    virtual std::unique_ptr<Simulation_BFER<B, R>> build_noise_worker(const int seed_offset,
+                                                                      const int n_threads) const = 0;
+
+    /*
+     * simulate up to 'noise_par' noise points at the same time, each noise point is simulated by a worker and the
+     * workers take the next noise point to simulate as soon as they are done, the 'n_threads' threads are split
+     * between the workers
+     */
+    void launch_noise_points_parallel(const std::vector<int>& noise_ids);
+    void run_noise_points(const std::vector<int>& noise_ids,
+                          std::atomic<size_t>& next_point,
+                          std::atomic<size_t>& stop_point,
+                          std::mutex& mtx_display);
+
+    /*
+     * run the sequence until the current noise point is done, the values of the checkpoint are restored first and the
+     * sequence is periodically stopped to save the values of the monitors in the checkpoint
+     */
+    void exec_noise_point(const float noise_val);
+
+    void dump_noise_point();
+
     bool stop_time_reached();
+    bool checkpoint_due();
     bool stop_condition();
 };
 
+template<typename B, typename R>
+template<class C>
+std::vector<C*>
+Simulation_BFER<B, R>::get_modules() const
+{
+    if (this->pipeline != nullptr) return this->pipeline->template get_modules<C>();
+    return this->sequence->template get_modules<C>();
+}
+
 }
 }
 
@@ -2,8 +2,10 @@
 #include <functional>
 #include <iostream>
 #include <random>
+#include <sstream>
 #include <streampu.hpp>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "Factory/Module/Coset/Coset.hpp"
@@ -29,6 +31,15 @@ Simulation_BFER_std<B, R, Q>::Simulation_BFER_std(const factory::BFER_std& param
                   << "Multi-threading detected with error tracking revert feature! "
                      "Each thread will play the same frames. Please run with one thread."
                   << std::endl;
+
+    if (!this->params_BFER_std.pl_threads.empty() &&
+        (this->params_BFER_std.err_track_enable || this->params_BFER_std.err_track_revert ||
+         this->params_BFER_std.mnt_mutinfo))
+    {
+        std::stringstream message;
+        message << "The pipeline can't be used with the bad frames tracking or with the mutual information monitor.";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
 }
 
 template<typename B, typename R, typename Q>
@@ -77,6 +88,7 @@ Simulation_BFER_std<B, R, Q>::build_modem(const tools::Distributions<R>* distrib
     {
         auto mdm = std::unique_ptr<module::Modem<B, R, R>>(params_BFER_std.mdm->build<B, R, R>(constellation));
         mdm->set_n_frames(this->params.n_frames);
+        mdm->set_padding(this->params_BFER_std.chn->dec_granularity, this->params_BFER_std.chn->parity_size);
         return mdm;
     }
 }
@@ -231,6 +243,9 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
 
     const auto is_rayleigh = this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos;
     const auto is_optical = this->params_BFER_std.chn->type == "OPTICAL" && this->params_BFER_std.mdm->rop_est_bits > 0;
+    // with the importance sampling, the channel also gives the likelihood ratio of each frame to the monitor
+    const auto is_imp = this->params_BFER_std.chn->is_scale != 1.f;
+    auto& chn_Y_N = is_imp ? chn[chn::sck::add_noise_is::Y_N] : chn[chn::sck::add_noise::Y_N];
     if (is_rayleigh)
     {
         if (this->params_BFER_std.chn->type == "NO")
@@ -294,7 +309,12 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
     }
     else
     {
-        if (this->params_BFER_std.chn->type != "NO")
+        if (is_imp)
+        {
+            chn[chn::sck::add_noise_is::CP] = this->channel_params;
+            chn[chn::sck::add_noise_is::X_N] = mdm[mdm::sck::modulate::X_N2];
+        }
+        else if (this->params_BFER_std.chn->type != "NO")
         {
             chn[chn::sck::add_noise::CP] = this->channel_params;
             chn[chn::sck::add_noise::X_N] = mdm[mdm::sck::modulate::X_N2];
@@ -304,7 +324,7 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
         {
             mdm[mdm::sck::filter::CP] = this->channel_params;
             if (this->params_BFER_std.chn->type != "NO")
-                mdm[mdm::sck::filter::Y_N1] = chn[chn::sck::add_noise::Y_N];
+                mdm[mdm::sck::filter::Y_N1] = chn_Y_N;
             else
                 mdm[mdm::sck::filter::Y_N1] = mdm[mdm::sck::modulate::X_N2];
         }
@@ -315,7 +335,7 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
             if (mdm.is_filter())
                 mdm[mdm::sck::demodulate::Y_N1] = mdm[mdm::sck::filter::Y_N2];
             else if (this->params_BFER_std.chn->type != "NO")
-                mdm[mdm::sck::demodulate::Y_N1] = chn[chn::sck::add_noise::Y_N];
+                mdm[mdm::sck::demodulate::Y_N1] = chn_Y_N;
             else
                 mdm[mdm::sck::demodulate::Y_N1] = mdm[mdm::sck::modulate::X_N2];
         }
@@ -327,7 +347,7 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
             else if (mdm.is_filter())
                 qnt[qnt::sck::process::Y_N1] = mdm[mdm::sck::filter::Y_N2];
             else if (this->params_BFER_std.chn->type != "NO")
-                qnt[qnt::sck::process::Y_N1] = chn[chn::sck::add_noise::Y_N];
+                qnt[qnt::sck::process::Y_N1] = chn_Y_N;
             else
                 qnt[qnt::sck::process::Y_N1] = mdm[mdm::sck::modulate::X_N2];
         }
@@ -351,7 +371,7 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
             if (is_rayleigh)
                 pct[pct::sck::depuncture::Y_N1] = chn[chn::sck::add_noise_wg::Y_N];
             else
-                pct[pct::sck::depuncture::Y_N1] = chn[chn::sck::add_noise::Y_N];
+                pct[pct::sck::depuncture::Y_N1] = chn_Y_N;
         }
         else
             pct[pct::sck::depuncture::Y_N1] = mdm[mdm::sck::modulate::X_N2];
@@ -384,7 +404,7 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
             if (is_rayleigh)
                 csr[cst::sck::apply::in] = chn[chn::sck::add_noise_wg::Y_N];
             else
-                csr[cst::sck::apply::in] = chn[chn::sck::add_noise::Y_N];
+                csr[cst::sck::apply::in] = chn_Y_N;
         }
         else
             csr[cst::sck::apply::in] = mdm[mdm::sck::modulate::X_N2];
@@ -438,7 +458,7 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
                 if (is_rayleigh)
                     dec[dec::sck::decode_siho_cw::Y_N] = chn[chn::sck::add_noise_wg::Y_N];
                 else
-                    dec[dec::sck::decode_siho_cw::Y_N] = chn[chn::sck::add_noise::Y_N];
+                    dec[dec::sck::decode_siho_cw::Y_N] = chn_Y_N;
             }
             else
                 dec[dec::sck::decode_siho_cw::Y_N] = mdm[mdm::sck::modulate::X_N2];
@@ -463,7 +483,7 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
                 if (is_rayleigh)
                     dec[dec::sck::decode_siho::Y_N] = chn[chn::sck::add_noise_wg::Y_N];
                 else
-                    dec[dec::sck::decode_siho::Y_N] = chn[chn::sck::add_noise::Y_N];
+                    dec[dec::sck::decode_siho::Y_N] = chn_Y_N;
             }
             else
                 dec[dec::sck::decode_siho::Y_N] = mdm[mdm::sck::modulate::X_N2];
@@ -472,37 +492,41 @@ Simulation_BFER_std<B, R, Q>::bind_sockets()
         }
     }
 
+    auto& mnt_U = is_imp ? mnt[mnt::sck::check_errors_w::U] : mnt[mnt::sck::check_errors::U];
+    auto& mnt_V = is_imp ? mnt[mnt::sck::check_errors_w::V] : mnt[mnt::sck::check_errors::V];
+    if (is_imp) mnt[mnt::sck::check_errors_w::W] = chn[chn::sck::add_noise_is::W];
+
     if (this->params_BFER_std.coded_monitoring)
     {
         if (this->params_BFER_std.src->type == "AZCW")
-            mnt[mnt::sck::check_errors::U] = enc[enc::sck::encode::X_N].get_dataptr();
+            mnt_U = enc[enc::sck::encode::X_N].get_dataptr();
         else
         {
             if (this->params_BFER_std.cdc->enc->type != "NO")
-                mnt[mnt::sck::check_errors::U] = enc[enc::sck::encode::X_N];
+                mnt_U = enc[enc::sck::encode::X_N];
             else if (this->params_BFER_std.crc->type != "NO")
-                mnt[mnt::sck::check_errors::U] = crc[crc::sck::build::U_K2];
+                mnt_U = crc[crc::sck::build::U_K2];
             else
-                mnt[mnt::sck::check_errors::U] = src[spu::module::src::sck::generate::out_data];
+                mnt_U = src[spu::module::src::sck::generate::out_data];
         }
 
         if (this->params_BFER_std.coset)
-            mnt[mnt::sck::check_errors::V] = csb[cst::sck::apply::out];
+            mnt_V = csb[cst::sck::apply::out];
         else
-            mnt[mnt::sck::check_errors::V] = dec[dec::sck::decode_siho_cw::V_N];
+            mnt_V = dec[dec::sck::decode_siho_cw::V_N];
     }
     else
     {
         if (this->params_BFER_std.src->type == "AZCW")
-            mnt[mnt::sck::check_errors::U] = enc[enc::sck::encode::X_N].get_dataptr();
+            mnt_U = enc[enc::sck::encode::X_N].get_dataptr();
         else
-            mnt[mnt::sck::check_errors::U] = src[spu::module::src::sck::generate::out_data];
+            mnt_U = src[spu::module::src::sck::generate::out_data];
         if (this->params_BFER_std.crc->type != "NO")
-            mnt[mnt::sck::check_errors::V] = crc[crc::sck::extract::V_K2];
+            mnt_V = crc[crc::sck::extract::V_K2];
         else if (this->params_BFER_std.coset)
-            mnt[mnt::sck::check_errors::V] = csb[cst::sck::apply::out];
+            mnt_V = csb[cst::sck::apply::out];
         else
-            mnt[mnt::sck::check_errors::V] = dec[dec::sck::decode_siho::V_K];
+            mnt_V = dec[dec::sck::decode_siho::V_K];
     }
 
     if (this->params_BFER_std.mnt_mutinfo)
@@ -543,51 +567,57 @@ Simulation_BFER_std<B, R, Q>::create_sequence()
 {
     const auto is_rayleigh = this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos;
     const auto is_optical = this->params_BFER_std.chn->type == "OPTICAL" && this->params_BFER_std.mdm->rop_est_bits > 0;
-    const auto t = this->params_BFER.n_threads;
+    spu::runtime::Task* first;
     if (this->params_BFER_std.src->type != "AZCW")
-        this->sequence.reset(new spu::runtime::Sequence((*this->source)[spu::module::src::tsk::generate], t));
+        first = &(*this->source)[spu::module::src::tsk::generate];
     else if (this->params_BFER_std.chn->type != "NO")
     {
         if (is_rayleigh)
-            this->sequence.reset(new spu::runtime::Sequence((*this->channel)[module::chn::tsk::add_noise_wg], t));
+            first = &(*this->channel)[module::chn::tsk::add_noise_wg];
+        else if (this->params_BFER_std.chn->is_scale != 1.f)
+            first = &(*this->channel)[module::chn::tsk::add_noise_is];
         else
-            this->sequence.reset(new spu::runtime::Sequence((*this->channel)[module::chn::tsk::add_noise], t));
+            first = &(*this->channel)[module::chn::tsk::add_noise];
     }
     else if (this->modem->is_demodulator())
     {
         if (is_rayleigh || is_optical)
-            this->sequence.reset(new spu::runtime::Sequence((*this->modem)[module::mdm::tsk::demodulate_wg], t));
+            first = &(*this->modem)[module::mdm::tsk::demodulate_wg];
         else
-            this->sequence.reset(new spu::runtime::Sequence((*this->modem)[module::mdm::tsk::demodulate], t));
+            first = &(*this->modem)[module::mdm::tsk::demodulate];
     }
     else if (this->modem->is_filter())
-        this->sequence.reset(new spu::runtime::Sequence((*this->modem)[module::mdm::tsk::filter], t));
+        first = &(*this->modem)[module::mdm::tsk::filter];
     else if (this->params_BFER_std.qnt->type != "NO")
-        this->sequence.reset(new spu::runtime::Sequence((*this->quantizer)[module::qnt::tsk::process], t));
+        first = &(*this->quantizer)[module::qnt::tsk::process];
     else if (this->params_BFER_std.cdc->pct != nullptr && this->params_BFER_std.cdc->pct->type != "NO")
-        this->sequence.reset(new spu::runtime::Sequence(this->codec->get_puncturer()[module::pct::tsk::puncture], t));
+        first = &this->codec->get_puncturer()[module::pct::tsk::puncture];
     else if (this->params_BFER_std.coset)
-        this->sequence.reset(new spu::runtime::Sequence((*this->coset_real)[module::cst::tsk::apply], t));
+        first = &(*this->coset_real)[module::cst::tsk::apply];
     else
-        this->sequence.reset(
-          new spu::runtime::Sequence(this->codec->get_decoder_siho()[module::dec::tsk::decode_siho], t));
+        first = &this->codec->get_decoder_siho()[module::dec::tsk::decode_siho];
+
+    if (this->params_BFER_std.pl_threads.empty())
+        this->sequence.reset(new spu::runtime::Sequence(*first, this->params_BFER.n_threads));
+    else
+        this->create_pipeline(*first);
 
     // set the noise
     this->codec->set_noise(*this->noise);
-    for (auto& m : this->sequence->template get_modules<tools::Interface_get_set_noise>())
+    for (auto& m : this->template get_modules<tools::Interface_get_set_noise>())
         m->set_noise(*this->noise);
 
     // registering to noise updates
     this->noise->record_callback_update([this]() { this->codec->notify_noise_update(); });
-    for (auto& m : this->sequence->template get_modules<tools::Interface_notify_noise_update>())
+    for (auto& m : this->template get_modules<tools::Interface_notify_noise_update>())
         this->noise->record_callback_update([m]() { m->notify_noise_update(); });
 
     // set different seeds in the modules that uses PRNG
-    std::mt19937 prng(params_BFER_std.local_seed);
-    for (auto& m : this->sequence->template get_modules<spu::tools::Interface_set_seed>())
+    std::mt19937 prng(params_BFER_std.local_seed + this->seed_offset);
+    for (auto& m : this->template get_modules<spu::tools::Interface_set_seed>())
         m->set_seed(prng());
 
-    auto fb_modules = this->sequence->template get_modules<tools::Interface_get_set_frozen_bits>();
+    auto fb_modules = this->template get_modules<tools::Interface_get_set_frozen_bits>();
     if (fb_modules.size())
     {
         this->noise->record_callback_update(
@@ -616,7 +646,7 @@ Simulation_BFER_std<B, R, Q>::create_sequence()
 
     if (this->params_BFER_std.err_track_enable)
     {
-        auto sources = this->sequence->template get_modules<spu::module::Source<B>>();
+        auto sources = this->template get_modules<spu::module::Source<B>>();
         for (size_t tid = 0; tid < (size_t)this->params_BFER.n_threads; tid++)
         {
             auto& source = sources.size() ? *sources[tid] : *this->source;
@@ -632,7 +662,7 @@ Simulation_BFER_std<B, R, Q>::create_sequence()
                                              {});
         }
 
-        auto encoders = this->sequence->template get_modules<module::Encoder<B>>();
+        auto encoders = this->template get_modules<module::Encoder<B>>();
         for (size_t tid = 0; tid < (size_t)this->params_BFER.n_threads; tid++)
         {
             auto& encoder = encoders.size() ? *encoders[tid] : this->codec->get_encoder();
@@ -648,7 +678,7 @@ Simulation_BFER_std<B, R, Q>::create_sequence()
                                              { (unsigned)this->params_BFER_std.cdc->enc->K });
         }
 
-        auto channels = this->sequence->template get_modules<module::Channel<R>>();
+        auto channels = this->template get_modules<module::Channel<R>>();
         for (size_t tid = 0; tid < (size_t)this->params_BFER.n_threads; tid++)
         {
             auto& channel = channels.size() ? *channels[tid] : *this->channel;
@@ -660,7 +690,7 @@ Simulation_BFER_std<B, R, Q>::create_sequence()
                                              {});
         }
 
-        auto monitors_er = this->sequence->template get_modules<module::Monitor_BFER<B>>();
+        auto monitors_er = this->template get_modules<module::Monitor_BFER<B>>();
         for (size_t tid = 0; tid < (size_t)this->params_BFER.n_threads; tid++)
         {
             monitors_er[tid]->record_callback_fe(
@@ -669,6 +699,91 @@ Simulation_BFER_std<B, R, Q>::create_sequence()
     }
 }
 
+template<typename B, typename R, typename Q>
+void
+Simulation_BFER_std<B, R, Q>::create_pipeline(spu::runtime::Task& first)
+{
+    using namespace module;
+
+    auto& crc = *this->crc;
+    auto& mdm = *this->modem;
+    auto& dec = this->codec->get_decoder_siho();
+    auto& csb = *this->coset_bit;
+    auto& mnt = *this->monitor_er;
+
+    const auto is_rayleigh = this->params_BFER_std.chn->type.find("RAYLEIGH") != std::string::npos;
+    const auto is_optical = this->params_BFER_std.chn->type == "OPTICAL" && this->params_BFER_std.mdm->rop_est_bits > 0;
+    const auto coded = this->params_BFER_std.coded_monitoring;
+
+    // the decoding stage starts at the decoder or at the modem, the TX stage ends with the task feeding it
+    auto& dec_task = coded ? dec[dec::tsk::decode_siho_cw] : dec[dec::tsk::decode_siho];
+    auto* dec_first = &dec_task;
+    auto* dec_in = coded ? &dec[dec::sck::decode_siho_cw::Y_N] : &dec[dec::sck::decode_siho::Y_N];
+    if (this->params_BFER_std.pl_split == "DEMOD")
+    {
+        if (mdm.is_filter())
+        {
+            dec_first = &mdm[mdm::tsk::filter];
+            dec_in = &mdm[mdm::sck::filter::Y_N1];
+        }
+        else if ((mdm.is_demodulator() || is_optical) && (is_rayleigh || is_optical))
+        {
+            dec_first = &mdm[mdm::tsk::demodulate_wg];
+            dec_in = &mdm[mdm::sck::demodulate_wg::Y_N1];
+        }
+        else if (mdm.is_demodulator())
+        {
+            dec_first = &mdm[mdm::tsk::demodulate];
+            dec_in = &mdm[mdm::sck::demodulate::Y_N1];
+        }
+    }
+
+    if (dec_first == &first)
+    {
+        std::stringstream message;
+        message << "The chain can't be split in stages, the first task is already in the decoding stage ('pl_split' = "
+                << this->params_BFER_std.pl_split << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    // the monitoring stage starts with the first task after the decoder
+    spu::runtime::Task* mnt_first;
+    if (this->params_BFER_std.coset)
+        mnt_first = &csb[cst::tsk::apply];
+    else if (!coded && this->params_BFER_std.crc->type != "NO")
+        mnt_first = &crc[crc::tsk::extract];
+    else if (this->params_BFER_std.chn->is_scale != 1.f)
+        mnt_first = &mnt[mnt::tsk::check_errors_w];
+    else
+        mnt_first = &mnt[mnt::tsk::check_errors];
+
+    const auto& n_threads = this->params_BFER_std.pl_threads;
+    const auto buffer_size = this->params_BFER_std.pl_buffer;
+    this->pipeline.reset(new spu::runtime::Pipeline(first,
+                                                    {
+                                                      { { &first }, { &dec_in->get_bound_socket().get_task() } },
+                                                      { { dec_first }, { &dec_task } },
+                                                      { { mnt_first }, {} },
+                                                    },
+                                                    { n_threads[0], n_threads[1], n_threads[2] },
+                                                    { buffer_size, buffer_size },
+                                                    { false, false }));
+}
+
+template<typename B, typename R, typename Q>
+std::unique_ptr<Simulation_BFER<B, R>>
+Simulation_BFER_std<B, R, Q>::build_noise_worker(const int seed_offset, const int n_threads) const
+{
+    // the worker owns a copy of the parameters with its share of the threads
+    std::unique_ptr<factory::BFER_std> params_worker(params_BFER_std.clone());
+    params_worker->n_threads = n_threads;
+
+    auto worker = std::unique_ptr<Simulation_BFER_std<B, R, Q>>(new Simulation_BFER_std<B, R, Q>(*params_worker));
+    worker->params_worker = std::move(params_worker);
+    worker->seed_offset = seed_offset;
+    return std::move(worker);
+}
+
 // ==================================================================================== explicit template instantiation
 #include "Tools/types.h"
 #ifdef AFF3CT_MULTI_PREC
@@ -54,6 +54,9 @@ class Simulation_BFER_std : public Simulation_BFER<B, R>
     virtual void create_modules();
     virtual void bind_sockets();
     virtual void create_sequence();
+    void create_pipeline(spu::runtime::Task& first);
+
+    virtual std::unique_ptr<Simulation_BFER<B, R>> build_noise_worker(const int seed_offset, const int n_threads) const;
 };
 
 }
@@ -85,9 +85,6 @@ Gaussian_noise_generator_fast<R>::generate(R* noise,
                                            const R sigma,
                                            const R mu) // TODO: integrate mu in the computation
 {
-    if (!mipp::isAligned(noise))
-        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, "'noise' is misaligned memory.");
-
     const auto twopi = (R)(2.0 * 3.14159265358979323846);
 
     // SIMD version of the Box Muller method in the polar form
@@ -106,8 +103,9 @@ Gaussian_noise_generator_fast<R>::generate(R* noise,
         auto awgn1 = radius * costheta + mu;
         auto awgn2 = radius * sintheta + mu;
 
-        awgn1.store(&noise[i]);
-        awgn2.store(&noise[i + mipp::nElReg<R>()]);
+        // the noise can start anywhere in a frame (zero padded frames)
+        awgn1.storeu(&noise[i]);
+        awgn2.storeu(&noise[i + mipp::nElReg<R>()]);
     }
 
     // seq version of the Box Muller method in the polar form
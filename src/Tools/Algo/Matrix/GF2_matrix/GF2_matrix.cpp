@@ -0,0 +1,325 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <streampu.hpp>
+
+#include "Tools/Algo/Matrix/GF2_matrix/GF2_matrix.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+static const char gf2_matrix_magic[8] = { 'A', 'F', 'F', '3', 'C', 'T', 'G', '2' };
+static const uint32_t gf2_matrix_version = 1;
+
+constexpr size_t GF2_matrix::word_size;
+constexpr size_t GF2_matrix::k_m4r;
+
+GF2_matrix ::GF2_matrix(const size_t n_rows, const size_t n_cols)
+  : n_rows(n_rows)
+  , n_cols(n_cols)
+  , n_words((n_cols + word_size - 1) / word_size)
+  , data(n_rows * n_words, 0)
+{
+}
+
+GF2_matrix
+GF2_matrix ::from_sparse(const Sparse_matrix& mat, const size_t col_begin, const size_t col_end)
+{
+    const auto end = col_end ? col_end : mat.get_n_cols();
+    if (col_begin > end || end > mat.get_n_cols())
+    {
+        std::stringstream message;
+        message << "'col_begin' and 'col_end' have to define a range of columns of 'mat' ('col_begin' = " << col_begin
+                << ", 'col_end' = " << col_end << ", 'mat.get_n_cols()' = " << mat.get_n_cols() << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    GF2_matrix packed(mat.get_n_rows(), end - col_begin);
+    for (size_t r = 0; r < mat.get_n_rows(); r++)
+        for (auto c : mat.get_cols_from_row(r))
+            if (c >= col_begin && c < end) packed.set(r, c - col_begin);
+
+    return packed;
+}
+
+GF2_matrix
+GF2_matrix ::from_full(const Full_matrix<int8_t>& mat)
+{
+    GF2_matrix packed(mat.get_n_rows(), mat.get_n_cols());
+    for (size_t r = 0; r < mat.get_n_rows(); r++)
+        for (size_t c = 0; c < mat.get_n_cols(); c++)
+            if (mat[r][c]) packed.set(r, c);
+
+    return packed;
+}
+
+Full_matrix<int8_t>
+GF2_matrix ::to_full() const
+{
+    Full_matrix<int8_t> mat((unsigned)this->n_rows, (unsigned)this->n_cols);
+    for (size_t r = 0; r < this->n_rows; r++)
+        for (size_t c = 0; c < this->n_cols; c++)
+            if (this->at(r, c)) mat.add_connection(r, c);
+
+    return mat;
+}
+
+Sparse_matrix
+GF2_matrix ::to_sparse() const
+{
+    Sparse_matrix mat(this->n_rows, this->n_cols);
+    for (size_t r = 0; r < this->n_rows; r++)
+    {
+        auto row = this->get_row(r);
+        for (size_t w = 0; w < this->n_words; w++)
+            if (row[w])
+                for (size_t b = 0; b < word_size; b++)
+                    if ((row[w] >> b) & (word_t)1) mat.add_connection(r, w * word_size + b);
+    }
+
+    return mat;
+}
+
+void
+GF2_matrix ::swap_rows(const size_t row_index1, const size_t row_index2)
+{
+    if (row_index1 == row_index2) return;
+
+    std::swap_ranges(this->get_row(row_index1), this->get_row(row_index1) + this->n_words, this->get_row(row_index2));
+}
+
+void
+GF2_matrix ::xor_rows(const size_t dst, const size_t src, const size_t first_word)
+{
+    auto d = this->get_row(dst);
+    auto s = this->get_row(src);
+    for (size_t w = first_word; w < this->n_words; w++)
+        d[w] ^= s[w];
+}
+
+GF2_matrix
+GF2_matrix ::transpose() const
+{
+    GF2_matrix t(this->n_cols, this->n_rows);
+    for (size_t r = 0; r < this->n_rows; r++)
+    {
+        auto row = this->get_row(r);
+        for (size_t w = 0; w < this->n_words; w++)
+            if (row[w])
+                for (size_t b = 0; b < word_size; b++)
+                    if ((row[w] >> b) & (word_t)1) t.set(w * word_size + b, r);
+    }
+
+    return t;
+}
+
+void
+GF2_matrix ::build_m4r_table(const std::vector<const word_t*>& rows,
+                             const size_t n_words,
+                             const size_t first_word,
+                             std::vector<word_t>& table)
+{
+    const auto n_w = n_words - first_word;
+    table.assign(((size_t)1 << rows.size()) * n_w, 0);
+
+    // the combinations with the highest bit 'j' are the previous ones plus the row 'j' (one XOR per combination)
+    for (size_t j = 0; j < rows.size(); j++)
+    {
+        const auto half = (size_t)1 << j;
+        for (size_t i = half; i < 2 * half; i++)
+        {
+            auto dst = table.data() + i * n_w;
+            auto src = table.data() + (i - half) * n_w;
+            auto row = rows[j] + first_word;
+            for (size_t w = 0; w < n_w; w++)
+                dst[w] = src[w] ^ row[w];
+        }
+    }
+}
+
+GF2_matrix
+GF2_matrix ::inverse() const
+{
+    if (this->n_rows != this->n_cols)
+    {
+        std::stringstream message;
+        message << "The matrix has to be square ('n_rows' = " << this->n_rows << ", 'n_cols' = " << this->n_cols
+                << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    // [A | I] with the identity starting on a new word, the windows of A never see the bits of I
+    const auto n = this->n_rows;
+    const auto id_col = this->n_words * word_size;
+    GF2_matrix aug(n, 2 * id_col);
+    for (size_t r = 0; r < n; r++)
+    {
+        std::copy(this->get_row(r), this->get_row(r) + this->n_words, aug.get_row(r));
+        aug.set(r, id_col + r);
+    }
+
+    std::vector<const word_t*> pivots;
+    std::vector<unsigned> pivots_win;
+    std::vector<word_t> table;
+    for (size_t c0 = 0; c0 < n; c0 += k_m4r)
+    {
+        const auto k = std::min(k_m4r, n - c0);
+        const auto first_word = c0 / word_size;
+
+        // find the pivot of each column of the block, the windows of the candidates are reduced on the fly by the
+        // previous pivots of the block
+        pivots_win.assign(k, 0);
+        for (size_t j = 0; j < k; j++)
+        {
+            auto p = n;
+            for (auto r = c0 + j; r < n && p == n; r++)
+            {
+                auto win = aug.get_window(r, c0);
+                for (size_t i = 0; i < j; i++)
+                    if ((win >> i) & 1u) win ^= pivots_win[i];
+                if ((win >> j) & 1u) p = r;
+            }
+
+            if (p == n)
+            {
+                std::stringstream message;
+                message << "The matrix is not invertible ('column' = " << (c0 + j) << ").";
+                throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+            }
+
+            aug.swap_rows(c0 + j, p);
+            for (size_t i = 0; i < j; i++)
+                if ((aug.get_window(c0 + j, c0) >> i) & 1u) aug.xor_rows(c0 + j, c0 + i, first_word);
+            pivots_win[j] = aug.get_window(c0 + j, c0);
+        }
+
+        // make the block of the pivots an identity
+        for (size_t i = 0; i < k; i++)
+            for (auto j = i + 1; j < k; j++)
+                if ((aug.get_window(c0 + i, c0) >> j) & 1u) aug.xor_rows(c0 + i, c0 + j, first_word);
+
+        pivots.resize(k);
+        for (size_t j = 0; j < k; j++)
+            pivots[j] = aug.get_row(c0 + j);
+        build_m4r_table(pivots, aug.n_words, first_word, table);
+
+        // eliminate the columns of the block in all the other rows with a single XOR per row
+        const auto n_w = aug.n_words - first_word;
+        for (size_t r = 0; r < n; r++)
+        {
+            if (r >= c0 && r < c0 + k) continue;
+
+            const auto win = aug.get_window(r, c0);
+            if (!win) continue;
+
+            auto dst = aug.get_row(r) + first_word;
+            auto src = table.data() + win * n_w;
+            for (size_t w = 0; w < n_w; w++)
+                dst[w] ^= src[w];
+        }
+    }
+
+    GF2_matrix inv(n, n);
+    for (size_t r = 0; r < n; r++)
+        std::copy(aug.get_row(r) + this->n_words, aug.get_row(r) + 2 * this->n_words, inv.get_row(r));
+
+    return inv;
+}
+
+GF2_matrix
+GF2_matrix ::mul(const GF2_matrix& mat) const
+{
+    if (this->n_cols != mat.n_rows)
+    {
+        std::stringstream message;
+        message << "'n_cols' has to be equal to 'mat.n_rows' ('n_cols' = " << this->n_cols
+                << ", 'mat.n_rows' = " << mat.n_rows << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    GF2_matrix res(this->n_rows, mat.n_cols);
+
+    std::vector<const word_t*> rows;
+    std::vector<word_t> table;
+    for (size_t b0 = 0; b0 < this->n_cols; b0 += k_m4r)
+    {
+        const auto k = std::min(k_m4r, this->n_cols - b0);
+
+        rows.resize(k);
+        for (size_t j = 0; j < k; j++)
+            rows[j] = mat.get_row(b0 + j);
+        build_m4r_table(rows, mat.n_words, 0, table);
+
+        for (size_t r = 0; r < this->n_rows; r++)
+        {
+            const auto win = this->get_window(r, b0);
+            if (!win) continue;
+
+            auto dst = res.get_row(r);
+            auto src = table.data() + win * res.n_words;
+            for (size_t w = 0; w < res.n_words; w++)
+                dst[w] ^= src[w];
+        }
+    }
+
+    return res;
+}
+
+void
+GF2_matrix ::save(const std::string& path, const uint64_t key) const
+{
+    const auto tmp_path = path + ".tmp";
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        std::stringstream message;
+        message << "Impossible to write the matrix file ('tmp_path' = " << tmp_path << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    const uint64_t n_rows = this->n_rows, n_cols = this->n_cols;
+    file.write(gf2_matrix_magic, sizeof(gf2_matrix_magic));
+    file.write((const char*)&gf2_matrix_version, sizeof(gf2_matrix_version));
+    file.write((const char*)&key, sizeof(key));
+    file.write((const char*)&n_rows, sizeof(n_rows));
+    file.write((const char*)&n_cols, sizeof(n_cols));
+    file.write((const char*)this->data.data(), this->data.size() * sizeof(word_t));
+    file.close();
+
+    // the previous file is replaced only when the new one is complete
+    if (!file || std::rename(tmp_path.c_str(), path.c_str()))
+    {
+        std::stringstream message;
+        message << "Impossible to write the matrix file ('path' = " << path << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+}
+
+bool
+GF2_matrix ::load(const std::string& path, const uint64_t key)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    char magic[sizeof(gf2_matrix_magic)];
+    uint32_t version = 0;
+    uint64_t file_key = 0, n_rows = 0, n_cols = 0;
+    file.read(magic, sizeof(magic));
+    file.read((char*)&version, sizeof(version));
+    file.read((char*)&file_key, sizeof(file_key));
+    file.read((char*)&n_rows, sizeof(n_rows));
+    file.read((char*)&n_cols, sizeof(n_cols));
+
+    if (!file || std::memcmp(magic, gf2_matrix_magic, sizeof(magic)) || version != gf2_matrix_version ||
+        file_key != key)
+        return false;
+
+    GF2_matrix mat((size_t)n_rows, (size_t)n_cols);
+    file.read((char*)mat.data.data(), mat.data.size() * sizeof(word_t));
+    if (!file) return false;
+
+    *this = std::move(mat);
+    return true;
+}
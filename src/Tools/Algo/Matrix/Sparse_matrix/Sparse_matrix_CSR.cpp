@@ -0,0 +1,66 @@
+#include <algorithm>
+#include <limits>
+#include <sstream>
+#include <streampu.hpp>
+
+#include "Tools/Algo/Matrix/Sparse_matrix/Sparse_matrix_CSR.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Sparse_matrix_CSR ::Sparse_matrix_CSR(const std::vector<std::vector<Sparse_matrix::Idx_t>>& lists,
+                                      const size_t n_indexes,
+                                      const bool compact)
+  : n_indexes(n_indexes)
+  , max_degree(0)
+  , compact(compact && n_indexes <= (size_t)std::numeric_limits<uint16_t>::max() + 1)
+  , offsets(lists.size() + 1, 0)
+{
+    for (size_t i = 0; i < lists.size(); i++)
+    {
+        this->offsets[i + 1] = this->offsets[i] + (uint32_t)lists[i].size();
+        this->max_degree = std::max(this->max_degree, lists[i].size());
+    }
+
+    if (this->compact)
+        this->indexes_16.resize(this->offsets.back());
+    else
+        this->indexes_32.resize(this->offsets.back());
+
+    for (size_t i = 0; i < lists.size(); i++)
+        for (size_t j = 0; j < lists[i].size(); j++)
+        {
+            const auto idx = lists[i][j];
+            if ((size_t)idx >= n_indexes)
+            {
+                std::stringstream message;
+                message << "'idx' has to be smaller than 'n_indexes' ('idx' = " << idx
+                        << ", 'n_indexes' = " << n_indexes << ", 'i' = " << i << ", 'j' = " << j << ").";
+                throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+            }
+
+            if (this->compact)
+                this->indexes_16[this->offsets[i] + j] = (uint16_t)idx;
+            else
+                this->indexes_32[this->offsets[i] + j] = (uint32_t)idx;
+        }
+}
+
+Sparse_matrix_CSR
+Sparse_matrix_CSR ::from_rows(const Sparse_matrix& matrix, const bool compact)
+{
+    return Sparse_matrix_CSR(matrix.get_row_to_cols(), matrix.get_n_cols(), compact);
+}
+
+Sparse_matrix_CSR
+Sparse_matrix_CSR ::from_cols(const Sparse_matrix& matrix, const bool compact)
+{
+    return Sparse_matrix_CSR(matrix.get_col_to_rows(), matrix.get_n_rows(), compact);
+}
+
+bool
+Sparse_matrix_CSR ::fits_compact(const Sparse_matrix& matrix)
+{
+    const auto max_n_indexes = (size_t)std::numeric_limits<uint16_t>::max() + 1;
+    return matrix.get_n_rows() <= max_n_indexes && matrix.get_n_cols() <= max_n_indexes;
+}
@@ -0,0 +1,96 @@
+#include <sstream>
+#include <streampu.hpp>
+
+#include "Tools/Algo/Thread_pool/Thread_pool.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Thread_pool ::Thread_pool(const size_t n_threads)
+  : n_threads(n_threads)
+  , generation(0)
+  , n_running(0)
+  , stop(false)
+{
+    if (n_threads == 0)
+    {
+        std::stringstream message;
+        message << "'n_threads' has to be greater than 0.";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    for (size_t t = 1; t < n_threads; t++)
+        this->threads.push_back(std::thread(&Thread_pool::worker, this, t));
+}
+
+Thread_pool ::~Thread_pool()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mtx);
+        this->stop = true;
+    }
+    this->cv_run.notify_all();
+    for (auto& t : this->threads)
+        t.join();
+}
+
+size_t
+Thread_pool ::get_n_threads() const
+{
+    return this->n_threads;
+}
+
+void
+Thread_pool ::run(const std::function<void(const size_t tid)>& task)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->mtx);
+        this->task = task;
+        this->exception = nullptr;
+        this->n_running = this->threads.size();
+        this->generation++;
+    }
+    this->cv_run.notify_all();
+
+    try
+    {
+        task(0);
+    }
+    catch (...)
+    {
+        std::lock_guard<std::mutex> lock(this->mtx);
+        if (!this->exception) this->exception = std::current_exception();
+    }
+
+    std::unique_lock<std::mutex> lock(this->mtx);
+    this->cv_done.wait(lock, [this]() { return this->n_running == 0; });
+    if (this->exception) std::rethrow_exception(this->exception);
+}
+
+void
+Thread_pool ::worker(const size_t tid)
+{
+    size_t last_generation = 0;
+    while (true)
+    {
+        std::unique_lock<std::mutex> lock(this->mtx);
+        this->cv_run.wait(lock, [&]() { return this->stop || this->generation != last_generation; });
+        if (this->stop) return;
+        last_generation = this->generation;
+        lock.unlock();
+
+        try
+        {
+            this->task(tid);
+        }
+        catch (...)
+        {
+            lock.lock();
+            if (!this->exception) this->exception = std::current_exception();
+            lock.unlock();
+        }
+
+        lock.lock();
+        if (--this->n_running == 0) this->cv_done.notify_one();
+    }
+}
@@ -1,6 +1,6 @@
 #include <algorithm>
 #include <functional>
-#include <mipp.h>
+#include <iomanip>
 #include <numeric>
 #include <sstream>
 #include <stdexcept>
@@ -16,6 +16,14 @@
 using namespace aff3ct;
 using namespace aff3ct::tools;
 
+static std::string
+cache_file(const std::string& cache_path, const uint64_t key, const std::string& name)
+{
+    std::stringstream file;
+    file << cache_path << "/H_" << std::hex << std::setw(16) << std::setfill('0') << key << "_" << name << ".gf2";
+    return file.str();
+}
+
 LDPC_matrix_handler::Matrix_format
 LDPC_matrix_handler ::get_matrix_format(const std::string& filename)
 {
@@ -165,14 +173,39 @@ LDPC_matrix_handler ::check_info_pos(const Positions_vector& info_bits_pos, int
 }
 
 Sparse_matrix
-LDPC_matrix_handler ::transform_H_to_G_decomp_LU(const Sparse_matrix& H, Positions_vector& info_bits_pos)
+LDPC_matrix_handler ::transform_H_to_G_decomp_LU(const Sparse_matrix& H,
+                                                 Positions_vector& info_bits_pos,
+                                                 const std::string& cache_path)
 {
     H.is_of_way_throw(Matrix::Way::HORIZONTAL);
-    LDPC_matrix Hf = sparse_to_full<LDPC_matrix::value_type>(H);
 
-    auto Gf = LDPC_matrix_handler::transform_H_to_G_decomp_LU(Hf, info_bits_pos);
+    auto M = H.get_n_rows();
+    auto N = H.get_n_cols();
+    auto K = N - M;
 
-    return full_to_sparse(Gf);
+    // transposed parity part of G: (inv(H2) * H1)^T -> K * M
+    GF2_matrix Pt;
+    const auto key = LDPC_matrix_handler::hash(H);
+    const auto file = cache_file(cache_path, key, "G_parity");
+    if (cache_path.empty() || !Pt.load(file, key))
+    {
+        Pt = LDPC_matrix_handler::inverse_H2(H, cache_path).mul(GF2_matrix::from_sparse(H, 0, K)).transpose();
+        if (!cache_path.empty()) Pt.save(file, key);
+    }
+
+    // G = [I | P^T] -> K * N
+    Sparse_matrix G(K, N);
+    for (size_t r = 0; r < K; r++)
+    {
+        G.add_connection(r, r);
+        for (size_t m = 0; m < M; m++)
+            if (Pt.at(r, m)) G.add_connection(r, K + m);
+    }
+
+    info_bits_pos.resize(K);
+    std::iota(info_bits_pos.begin(), info_bits_pos.end(), 0);
+
+    return G;
 }
 
 Sparse_matrix
@@ -199,93 +232,6 @@ swap_columns(LDPC_matrix_handler::LDPC_matrix& mat, size_t idx1, size_t idx2)
         mat[l][idx2] = tmp[l];
 }
 
-LDPC_matrix_handler::LDPC_matrix
-LU_decomp(const LDPC_matrix_handler::LDPC_matrix& Hp)
-{
-    using V = LDPC_matrix_handler::LDPC_matrix::value_type;
-
-    Hp.is_of_way_throw(Matrix::Way::HORIZONTAL);
-
-    auto M = Hp.get_n_rows();
-
-    LDPC_matrix_handler::LDPC_matrix Hinv = Hp.resize(M, 2 * M, Matrix::Origin::TOP_LEFT);
-
-    // Create identity on right part
-    for (size_t i = 0; i < M; i++)
-        Hinv[i][M + i] = 1;
-
-    // Gaussian elimination (Forward)
-    for (size_t r = 0; r < M; r++)
-    {
-        if (Hinv[r][r] == 0)
-        {
-            size_t r_swap = 0;
-            for (auto r2 = r + 1; r2 < M; r2++)
-            {
-                if (Hinv[r2][r] != 0)
-                {
-                    r_swap = r2;
-                    break;
-                }
-            }
-
-            if (r_swap == 0)
-            {
-                std::stringstream message;
-                message << "Matrix H2 (H = [H1 H2]) is not invertible";
-                throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
-            }
-
-            std::swap(Hinv[r], Hinv[r_swap]);
-        }
-
-        // XOR on lines
-        for (auto r2 = r + 1; r2 < M; r2++)
-        {
-            if (Hinv[r2][r] != 0)
-            {
-                const auto loop_size1 = (size_t)(2 * M / mipp::nElReg<V>());
-                for (size_t i = 0; i < loop_size1; i++)
-                {
-                    const auto rLgn = mipp::Reg<V>(&Hinv[r][i * mipp::nElReg<V>()]);
-                    const auto rLgn2 = mipp::Reg<V>(&Hinv[r2][i * mipp::nElReg<V>()]);
-                    auto rLgn3 = rLgn2 ^ rLgn;
-                    rLgn3.store(&Hinv[r2][i * mipp::nElReg<V>()]);
-                }
-                for (size_t i = loop_size1 * (size_t)mipp::nElReg<V>(); i < 2 * M; i++)
-                    Hinv[r2][i] = Hinv[r2][i] ^ Hinv[r][i];
-            }
-        }
-    }
-
-    // Gaussian elimination (Backward)
-    for (auto r = M - 1; r > 0; r--)
-    {
-        // XOR on lines
-        for (auto r2 = r; r2 > 0; r2--)
-        {
-            auto rm1 = r2 - 1;
-            if (Hinv[rm1][r] != 0)
-            {
-                const auto loop_size1 = (size_t)(2 * M / mipp::nElReg<V>());
-                for (size_t i = 0; i < loop_size1; i++)
-                {
-                    const auto rLgn = mipp::Reg<V>(&Hinv[r][i * mipp::nElReg<V>()]);
-                    const auto rLgn2 = mipp::Reg<V>(&Hinv[rm1][i * mipp::nElReg<V>()]);
-                    auto rLgn3 = rLgn2 ^ rLgn;
-                    rLgn3.store(&Hinv[rm1][i * mipp::nElReg<V>()]);
-                }
-                for (auto i = loop_size1 * mipp::nElReg<V>(); i < 2 * M; i++)
-                    Hinv[rm1][i] = Hinv[rm1][i] ^ Hinv[r][i];
-            }
-        }
-    }
-
-    Hinv.self_resize(M, M, Matrix::Origin::TOP_RIGHT);
-
-    return Hinv;
-}
-
 /* // Benjamin's version
 template<bool allow_rank_deficient = true>
 LDPC_matrix_handler::LDPC_matrix LU_decomp2(const LDPC_matrix_handler::LDPC_matrix& Hp)
@@ -419,14 +365,7 @@ it for now."); break;
 LDPC_matrix_handler::LDPC_matrix
 LDPC_matrix_handler ::LU_decomposition(const Sparse_matrix& H)
 {
-    using V = LDPC_matrix::value_type;
-
-    auto Ht = H.turn(Matrix::Way::HORIZONTAL);
-
-    auto M = Ht.get_n_rows();
-    Ht.self_resize(M, M, Matrix::Origin::TOP_RIGHT);
-
-    return LU_decomp(tools::sparse_to_full<V>(Ht));
+    return LDPC_matrix_handler::inverse_H2(H).to_full();
 }
 
 LDPC_matrix_handler::LDPC_matrix
@@ -437,49 +376,82 @@ LDPC_matrix_handler ::LU_decomposition(const LDPC_matrix& H)
     auto M = H.get_n_rows();
     auto Hp = H.resize(M, M, Matrix::Origin::TOP_RIGHT); // parity part of H -> Horizontal M * M
 
-    return LU_decomp(Hp);
+    return GF2_matrix::from_full(Hp).inverse().to_full();
+}
+
+GF2_matrix
+LDPC_matrix_handler ::inverse_H2(const Sparse_matrix& H, const std::string& cache_path)
+{
+    auto Ht = H.turn(Matrix::Way::HORIZONTAL);
+
+    auto M = Ht.get_n_rows();
+    auto N = Ht.get_n_cols();
+
+    GF2_matrix invH2;
+    const auto key = LDPC_matrix_handler::hash(Ht);
+    const auto file = cache_file(cache_path, key, "inv_H2");
+    if (!cache_path.empty() && invH2.load(file, key)) return invH2;
+
+    invH2 = GF2_matrix::from_sparse(Ht, N - M, N).inverse();
+    if (!cache_path.empty()) invH2.save(file, key);
+
+    return invH2;
+}
+
+uint64_t
+LDPC_matrix_handler ::hash(const Sparse_matrix& H)
+{
+    uint64_t h = 0xcbf29ce484222325ull; // FNV-1a offset basis
+    auto add = [&h](uint64_t v)
+    {
+        for (auto b = 0; b < 8; b++)
+        {
+            h ^= (v >> (8 * b)) & 0xFF;
+            h *= 0x100000001b3ull; // FNV-1a prime
+        }
+    };
+
+    add(H.get_n_rows());
+    add(H.get_n_cols());
+    for (size_t r = 0; r < H.get_n_rows(); r++)
+    {
+        // the hash does not depend on the order of the connections of a row
+        auto cols = H.get_cols_from_row(r);
+        std::sort(cols.begin(), cols.end());
+        add(cols.size());
+        for (auto c : cols)
+            add(c);
+    }
+
+    return h;
 }
 
 // Benjamin's version
 LDPC_matrix_handler::LDPC_matrix
 LDPC_matrix_handler ::transform_H_to_G_decomp_LU(const LDPC_matrix& H, Positions_vector& info_bits_pos)
 {
+    H.is_of_way_throw(Matrix::Way::HORIZONTAL);
+
     auto M = H.get_n_rows();
     auto N = H.get_n_cols();
     auto K = N - M;
 
-    LDPC_matrix Gp = LU_decomposition(H); // Gp is VERTICAL -> M * M
-
-    auto Hs = H.resize(M, K, Matrix::Origin::TOP_LEFT); // systematic part of H
-    Hs.self_transpose();
-    auto GH = bgemmt(Gp, Hs); // Gp * Hs -> horizontal M * K
-    // GH.self_resize(GH.get_n_rows(), GH.get_n_cols() - M, Matrix::Origin::TOP_LEFT); // remove right part
-    GH.self_transpose(); // now vertical K * M
+    auto Hp = GF2_matrix::from_full(H.resize(M, M, Matrix::Origin::TOP_RIGHT)); // parity part of H
+    auto Hs = GF2_matrix::from_full(H.resize(M, K, Matrix::Origin::TOP_LEFT));  // systematic part of H
+    auto P = Hp.inverse().mul(Hs);                                               // inv(H2) * H1 -> M * K
 
-    // add identity on the left part
-    GH.self_resize(K, N, Matrix::Origin::TOP_RIGHT);
+    // G = [I | P^T] -> K * N
+    LDPC_matrix G((unsigned)K, (unsigned)N);
     for (size_t r = 0; r < K; r++)
-        GH[r][r] = 1;
-
-    // GH is now G -> K * N
-
-    // // check that G is good
-    // Hp.self_transpose(); // now vertical M*M
-    // auto GHp = bgemmt(Gp, Hp); // Gp * Hp
-
-    // // remove the identy
-    // auto min_size = std::min(GHp.get_n_rows(), GHp.get_n_cols());
-    // for (size_t r = 0; r < min_size; r++)
-    // 	GHp[r][r] = !GHp[r][r];
-
-    // if (!all_zeros(GHp))
-    // 	throw spu::tools::runtime_error(__FILE__, __LINE__, __func__,
-    // 	                                Generated Gp from H is not good (Gp * Hp != Identity).");
+        G.add_connection(r, r);
+    for (size_t m = 0; m < M; m++)
+        for (size_t k = 0; k < K; k++)
+            if (P.at(m, k)) G.add_connection(k, K + m);
 
     info_bits_pos.resize(K);
     std::iota(info_bits_pos.begin(), info_bits_pos.end(), 0);
 
-    return GH;
+    return G;
 }
 
 // Valentin's version
@@ -935,6 +907,69 @@ LDPC_matrix_handler ::interleave_info_bits_pos(const Positions_vector& info_bits
     return itl_vec;
 }
 
+Sparse_matrix
+LDPC_matrix_handler ::shorten(const Sparse_matrix& H,
+                              Positions_vector& info_bits_pos,
+                              const size_t n_info,
+                              Positions_vector& kept_pos)
+{
+    if (n_info > info_bits_pos.size())
+    {
+        std::stringstream message;
+        message << "'n_info' has to be smaller than or equal to 'info_bits_pos.size()' ('n_info' = " << n_info
+                << ", 'info_bits_pos.size()' = " << info_bits_pos.size() << ").";
+        throw spu::tools::length_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    const auto n_var_nodes = H.get_n_rows();
+    const auto n_chk_nodes = H.get_n_cols();
+
+    std::vector<bool> padded(n_var_nodes, false);
+    for (auto k = n_info; k < info_bits_pos.size(); k++)
+    {
+        if (info_bits_pos[k] >= n_var_nodes)
+        {
+            std::stringstream message;
+            message << "'info_bits_pos[k]' has to be smaller than 'H.get_n_rows()' ('k' = " << k
+                    << ", 'info_bits_pos[k]' = " << info_bits_pos[k] << ", 'H.get_n_rows()' = " << n_var_nodes << ").";
+            throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+        }
+        padded[info_bits_pos[k]] = true;
+    }
+
+    Positions_vector new_var_pos(n_var_nodes, 0);
+    kept_pos.clear();
+    for (size_t v = 0; v < n_var_nodes; v++)
+        if (!padded[v])
+        {
+            new_var_pos[v] = (uint32_t)kept_pos.size();
+            kept_pos.push_back((uint32_t)v);
+        }
+
+    // a check node only connected to zero padded bits is always satisfied
+    Positions_vector new_chk_pos(n_chk_nodes, 0);
+    std::vector<bool> kept_chk(n_chk_nodes, false);
+    size_t n_kept_chk = 0;
+    for (size_t c = 0; c < n_chk_nodes; c++)
+    {
+        const auto& vars = H.get_rows_from_col(c);
+        kept_chk[c] = std::any_of(vars.begin(), vars.end(), [&padded](const uint32_t v) { return !padded[v]; });
+        if (kept_chk[c]) new_chk_pos[c] = (uint32_t)n_kept_chk++;
+    }
+
+    Sparse_matrix H_short(kept_pos.size(), n_kept_chk);
+    for (size_t c = 0; c < n_chk_nodes; c++)
+        if (kept_chk[c])
+            for (const auto v : H.get_rows_from_col(c))
+                if (!padded[v]) H_short.add_connection(new_var_pos[v], new_chk_pos[c]);
+
+    info_bits_pos.resize(n_info);
+    for (auto& pos : info_bits_pos)
+        pos = new_var_pos[pos];
+
+    return H_short;
+}
+
 bool
 LDPC_matrix_handler ::check_GH(const Sparse_matrix& H, const Sparse_matrix& G)
 {
@@ -1,4 +1,5 @@
 #include <cstdint>
+#include <limits>
 #include <mipp.h>
 #include <sstream>
 #include <stdexcept>
@@ -17,7 +18,7 @@ QC ::read(std::istream& stream)
 {
     try
     {
-        return QC::_read(stream);
+        return QC::expand(QC::_read_base(stream));
     }
     catch (std::exception const&)
     {
@@ -27,8 +28,23 @@ QC ::read(std::istream& stream)
     }
 }
 
-Sparse_matrix
-QC ::_read(std::istream& stream)
+QC::Base_matrix
+QC ::read_base(std::istream& stream)
+{
+    try
+    {
+        return QC::_read_base(stream);
+    }
+    catch (std::exception const&)
+    {
+        std::stringstream message;
+        message << "The given stream does not refer to a QC format file.";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+}
+
+QC::Base_matrix
+QC ::_read_base(std::istream& stream)
 {
     // ----------------------------------------------------------------------------------------- read matrix from file
     std::string line;
@@ -42,53 +58,61 @@ QC ::_read(std::istream& stream)
         throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
-    unsigned N_red = 0, M_red = 0, Z = 0;
+    Base_matrix base;
 
-    N_red = std::stoi(values[0]);
-    M_red = std::stoi(values[1]);
-    Z = std::stoi(values[2]);
+    base.N_red = std::stoi(values[0]);
+    base.M_red = std::stoi(values[1]);
+    base.Z = std::stoi(values[2]);
 
-    if (N_red == 0 || M_red == 0 || Z == 0)
+    if (base.N_red == 0 || base.M_red == 0 || base.Z == 0)
     {
         std::stringstream message;
-        message << "'N_red', 'M_red' and 'Z' have to be greater than 0 ('N_red' = " << N_red << ", 'M_red' = " << M_red
-                << ", 'Z' = " << Z << ").";
+        message << "'N_red', 'M_red' and 'Z' have to be greater than 0 ('N_red' = " << base.N_red
+                << ", 'M_red' = " << base.M_red << ", 'Z' = " << base.Z << ").";
         throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
-    std::vector<mipp::vector<int16_t>> H_red(M_red, mipp::vector<int16_t>(N_red, -1));
+    base.shifts.resize(base.M_red, std::vector<int16_t>(base.N_red, -1));
 
-    for (unsigned i = 0; i < M_red; i++)
+    for (unsigned i = 0; i < base.M_red; i++)
     {
         getline(stream, line);
         values = split(line);
 
-        if (values.size() < N_red)
+        if (values.size() < base.N_red)
         {
             std::stringstream message;
             message << "'values.size()' has to be greater or equal to 'N_red' ('values.size()' = " << values.size()
-                    << ", 'i' = " << i << ", 'N_red' = " << N_red << ").";
+                    << ", 'i' = " << i << ", 'N_red' = " << base.N_red << ").";
             throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
         }
 
-        for (unsigned j = 0; j < N_red; j++)
+        for (unsigned j = 0; j < base.N_red; j++)
         {
             auto col_value = (j < values.size()) ? std::stoi(values[j]) : -1;
-            H_red[i][j] = col_value;
+            base.shifts[i][j] = col_value;
         }
     }
 
+    return base;
+}
+
+Sparse_matrix
+QC ::expand(const Base_matrix& base)
+{
+    const auto Z = base.Z;
+
     // ---------------------------------------------------------------------------- expand QC format into sparse format
-    unsigned N = M_red * Z;
-    unsigned M = N_red * Z;
+    unsigned N = base.M_red * Z;
+    unsigned M = base.N_red * Z;
 
     Sparse_matrix H(N, M);
 
-    for (unsigned i = 0; i < M_red; i++)
+    for (unsigned i = 0; i < base.M_red; i++)
     {
-        for (unsigned j = 0; j < N_red; j++)
+        for (unsigned j = 0; j < base.N_red; j++)
         {
-            auto value = H_red[i][j];
+            auto value = base.shifts[i][j];
 
             unsigned idxLgn = i * Z;
             unsigned idxCol = j * Z;
@@ -114,6 +138,71 @@ QC ::_read(std::istream& stream)
     return H.transpose();
 }
 
+bool
+QC ::extract_base(const Sparse_matrix& H, Base_matrix& base)
+{
+    // H is in vertical way: the rows are the variable nodes and the columns are the check nodes
+    const auto n_vars = (unsigned)H.get_n_rows();
+    const auto n_chks = (unsigned)H.get_n_cols();
+
+    if (n_vars == 0 || n_chks == 0) return false;
+
+    unsigned gcd = n_vars, b = n_chks;
+    while (b != 0)
+    {
+        const auto t = gcd % b;
+        gcd = b;
+        b = t;
+    }
+
+    // the largest lifting size gives the most compact representation, Z = 1 is not a QC structure (the base matrix
+    // would be H itself)
+    for (unsigned Z = gcd; Z >= 2; Z--)
+        if (gcd % Z == 0 && QC::_extract_base(H, Z, base)) return true;
+
+    return false;
+}
+
+bool
+QC ::_extract_base(const Sparse_matrix& H, const unsigned Z, Base_matrix& base)
+{
+    base.N_red = (unsigned)H.get_n_rows() / Z;
+    base.M_red = (unsigned)H.get_n_cols() / Z;
+    base.Z = Z;
+    base.shifts.assign(base.M_red, std::vector<int16_t>(base.N_red, -1));
+
+    if (Z > (unsigned)std::numeric_limits<int16_t>::max()) return false;
+
+    for (unsigned i = 0; i < base.M_red; i++)
+    {
+        // the first check node of the block row gives the shifts
+        unsigned n_blocks = 0;
+        for (auto v : H.get_rows_from_col(i * Z))
+        {
+            const auto j = v / Z;
+            if (base.shifts[i][j] != -1) return false; // two connections in the same block
+            base.shifts[i][j] = (int16_t)(v - j * Z);
+            n_blocks++;
+        }
+
+        // the other check nodes of the block row have to follow the same circulant permutations
+        for (unsigned k = 1; k < Z; k++)
+        {
+            const auto& vars = H.get_rows_from_col(i * Z + k);
+            if (vars.size() != n_blocks) return false;
+
+            for (auto v : vars)
+            {
+                const auto j = v / Z;
+                const auto s = base.shifts[i][j];
+                if (s == -1 || v != j * Z + (k + (unsigned)s) % Z) return false;
+            }
+        }
+    }
+
+    return true;
+}
+
 std::vector<bool>
 QC ::read_pct_pattern(std::istream& stream, int N_red)
 {
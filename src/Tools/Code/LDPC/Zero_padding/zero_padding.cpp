@@ -0,0 +1,22 @@
+#include "Tools/Code/LDPC/Zero_padding/zero_padding.h"
+
+namespace
+{
+bool
+is_padded(const int N, const int dec_granularity, const int parity_size)
+{
+    return dec_granularity > 0 && parity_size > 0 && dec_granularity + parity_size < N;
+}
+}
+
+int
+aff3ct::tools::zero_padding_begin(const int N, const int dec_granularity, const int parity_size)
+{
+    return is_padded(N, dec_granularity, parity_size) ? dec_granularity : N;
+}
+
+int
+aff3ct::tools::zero_padding_end(const int N, const int dec_granularity, const int parity_size)
+{
+    return is_padded(N, dec_granularity, parity_size) ? N - parity_size : N;
+}
@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <cstdio>
 #include <fstream>
 #include <iomanip>
 #include <ios>
@@ -8,11 +9,28 @@
 
 #include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator.hpp"
 #include "Tools/Noise/noise_utils.h"
+#include "Tools/general_utils.h"
 
 using namespace aff3ct;
 using namespace aff3ct::tools;
 
 std::thread::id Frozenbits_generator::master_thread_id = std::this_thread::get_id();
+std::mutex Frozenbits_generator::cache_mutex;
+std::map<std::string, std::vector<uint32_t>> Frozenbits_generator::cache;
+std::deque<std::string> Frozenbits_generator::cache_keys;
+const size_t Frozenbits_generator::cache_max_size = 32;
+
+static uint64_t
+hash_cache_key(const std::string& key)
+{
+    uint64_t h = 0xcbf29ce484222325ull; // FNV-1a offset basis
+    for (auto c : key)
+    {
+        h ^= (uint64_t)(unsigned char)c;
+        h *= 0x100000001b3ull; // FNV-1a prime
+    }
+    return h;
+}
 
 Frozenbits_generator ::Frozenbits_generator(const int K,
                                             const int N,
@@ -59,6 +77,24 @@ Frozenbits_generator ::get_noise() const
     return *this->noise;
 }
 
+void
+Frozenbits_generator ::set_cache_path(const std::string& cache_path)
+{
+    this->cache_path = cache_path;
+}
+
+const std::string&
+Frozenbits_generator ::get_cache_path() const
+{
+    return this->cache_path;
+}
+
+std::string
+Frozenbits_generator ::get_construction() const
+{
+    return "";
+}
+
 void
 Frozenbits_generator ::generate(std::vector<bool>& frozen_bits)
 {
@@ -70,7 +106,44 @@ Frozenbits_generator ::generate(std::vector<bool>& frozen_bits)
         throw spu::tools::length_error(__FILE__, __LINE__, __func__, message.str());
     }
 
-    this->evaluate();
+    if (this->get_construction().empty())
+        this->evaluate();
+    else
+    {
+        this->check_noise();
+        const auto key = this->get_cache_key();
+
+        bool is_cached;
+        {
+            std::lock_guard<std::mutex> lock(Frozenbits_generator::cache_mutex);
+            auto it = Frozenbits_generator::cache.find(key);
+            is_cached = it != Frozenbits_generator::cache.end();
+            if (is_cached) this->best_channels = it->second;
+        }
+
+        // the evaluation is done without the lock: the generators of the other keys are not blocked, the threads that
+        // miss the same key at the same time compute the same best channels
+        if (!is_cached)
+        {
+            if (!this->load_best_channels(key))
+            {
+                this->evaluate();
+                this->save_best_channels(key);
+            }
+
+            std::lock_guard<std::mutex> lock(Frozenbits_generator::cache_mutex);
+            if (Frozenbits_generator::cache.find(key) == Frozenbits_generator::cache.end())
+            {
+                if (Frozenbits_generator::cache_keys.size() >= Frozenbits_generator::cache_max_size)
+                {
+                    Frozenbits_generator::cache.erase(Frozenbits_generator::cache_keys.front());
+                    Frozenbits_generator::cache_keys.pop_front();
+                }
+                Frozenbits_generator::cache[key] = this->best_channels;
+                Frozenbits_generator::cache_keys.push_back(key);
+            }
+        }
+    }
 
     // init frozen_bits vector, true means frozen bits, false means information bits
     std::fill(frozen_bits.begin(), frozen_bits.end(), true);
@@ -161,4 +234,71 @@ Frozenbits_generator ::dump_best_channels(const std::string& dump_channels_full_
     for (auto c : this->best_channels)
         file << c << " ";
     file << std::endl;
-}
\ No newline at end of file
+}
+
+std::string
+Frozenbits_generator ::get_cache_key() const
+{
+    // the best channels do not depend on K. The noise value is rounded to avoid recomputing the best channels for
+    // the floating-point noise
+    std::stringstream key;
+    key << this->get_construction() << "_N" << this->N << "_"
+        << Noise<>::type_to_str(this->noise->get_type()) << "_" << std::setprecision(6) << this->noise->get_value();
+    return key.str();
+}
+
+bool
+Frozenbits_generator ::load_best_channels(const std::string& key)
+{
+    if (this->cache_path.empty()) return false;
+
+    std::stringstream file_path;
+    file_path << this->cache_path << "/fb_" << std::hex << std::setw(16) << std::setfill('0') << hash_cache_key(key)
+              << ".pc";
+    std::ifstream file(file_path.str());
+    if (!file.is_open()) return false;
+
+    int N = 0;
+    std::string noise_type, noise_value, file_key;
+    file >> N >> noise_type >> noise_value;
+    if (!file || N != this->N) return false;
+
+    std::vector<uint32_t> best_channels(this->N);
+    for (auto& c : best_channels)
+        if (!(file >> c) || c >= (uint32_t)this->N) return false;
+
+    // the key is written after the channels to keep the format of the files read by Frozenbits_generator_file
+    file >> file_key;
+    if (!file || file_key != key) return false;
+
+    this->best_channels = std::move(best_channels);
+    return true;
+}
+
+void
+Frozenbits_generator ::save_best_channels(const std::string& key)
+{
+    if (this->cache_path.empty()) return;
+
+    std::stringstream file_path;
+    file_path << this->cache_path << "/fb_" << std::hex << std::setw(16) << std::setfill('0') << hash_cache_key(key)
+              << ".pc";
+    // several generators (threads or processes) can save the same best channels at the same time
+    const auto tmp_path = unique_tmp_path(file_path.str());
+
+    // a file that cannot be written is not an error: the best channels are simply not cached
+    try
+    {
+        this->dump_best_channels(tmp_path);
+    }
+    catch (spu::tools::runtime_error&)
+    {
+        return;
+    }
+    std::ofstream file(tmp_path, std::ios::app);
+    file << key << std::endl;
+    file.close();
+
+    // the previous file is replaced only when the new one is complete
+    if (!file || std::rename(tmp_path.c_str(), file_path.str().c_str())) std::remove(tmp_path.c_str());
+}
@@ -53,6 +53,12 @@ Frozenbits_generator_BEC ::evaluate()
     std::sort(this->best_channels.begin(), this->best_channels.end(), [this](int i1, int i2) { return z[i1] < z[i2]; });
 }
 
+std::string
+Frozenbits_generator_BEC ::get_construction() const
+{
+    return "BEC";
+}
+
 void
 Frozenbits_generator_BEC ::check_noise()
 {
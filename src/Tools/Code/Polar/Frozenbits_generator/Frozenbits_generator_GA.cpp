@@ -4,6 +4,7 @@
 #include <algorithm>
 #include <cmath>
 #include <numeric>
+#include <sstream>
 #include <streampu.hpp>
 
 #include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_GA.hpp"
@@ -31,6 +32,21 @@ Frozenbits_generator_GA ::Frozenbits_generator_GA(const int K,
   , fake_frozen_bits(init_fb(K, code.get_codeword_size()))
   , decoder_sc(K, code.get_codeword_size(), code, fake_frozen_bits)
 {
+    // the best channels depend on the kernels of the code, they are part of the name of the construction
+    std::stringstream construction;
+    construction << "GA";
+    for (auto& kernel_matrix : code.get_kernel_matrices())
+    {
+        construction << "_";
+        for (auto& row : kernel_matrix)
+            for (auto bit : row)
+                construction << bit;
+    }
+    construction << "_s";
+    for (auto stage : code.get_stages())
+        construction << stage << ".";
+    this->construction = construction.str();
+
     recursive_override_frozen_bits(decoder_sc.polar_tree.get_root());
 
     for (size_t l = 0; l < decoder_sc.lambdas.size(); l++)
@@ -65,6 +81,12 @@ Frozenbits_generator_GA ::evaluate()
     std::sort(this->best_channels.begin(), this->best_channels.end(), [this](int i1, int i2) { return z[i1] > z[i2]; });
 }
 
+std::string
+Frozenbits_generator_GA ::get_construction() const
+{
+    return this->construction;
+}
+
 double
 Frozenbits_generator_GA ::phi(double t)
 {
@@ -58,6 +58,12 @@ Frozenbits_generator_GA_Arikan ::evaluate()
     std::sort(this->best_channels.begin(), this->best_channels.end(), [this](int i1, int i2) { return z[i1] > z[i2]; });
 }
 
+std::string
+Frozenbits_generator_GA_Arikan ::get_construction() const
+{
+    return "GA_Arikan";
+}
+
 double
 Frozenbits_generator_GA_Arikan ::phi(double t)
 {
@@ -0,0 +1,260 @@
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <sstream>
+#include <streampu.hpp>
+#include <thread>
+
+#include "Tools/Code/Polar/Frozenbits_generator/Frozenbits_generator_TV_merge.hpp"
+#include "Tools/Noise/Noise.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+static double
+binary_entropy(const double p)
+{
+    if (p <= 0.0 || p >= 1.0) return 0.0;
+    return -p * std::log2(p) - (1.0 - p) * std::log2(1.0 - p);
+}
+
+Frozenbits_generator_TV_merge ::Frozenbits_generator_TV_merge(const int K,
+                                                              const int N,
+                                                              const int mu,
+                                                              const bool bsc,
+                                                              const int n_threads,
+                                                              const std::string& dump_channels_path,
+                                                              const bool dump_channels_single_thread)
+  : Frozenbits_generator(K, N, dump_channels_path, dump_channels_single_thread)
+  , m((int)std::log2(N))
+  , mu(mu)
+  , bsc(bsc)
+  , n_threads(n_threads ? n_threads : std::max(1, (int)std::thread::hardware_concurrency()))
+  , pe(N)
+{
+    if (mu < 2 || mu % 2)
+    {
+        std::stringstream message;
+        message << "'mu' has to be an even number greater or equal to 2 ('mu' = " << mu << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (n_threads < 0)
+    {
+        std::stringstream message;
+        message << "'n_threads' has to be positive ('n_threads' = " << n_threads << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->init_thresholds();
+}
+
+Frozenbits_generator_TV_merge*
+Frozenbits_generator_TV_merge ::clone() const
+{
+    auto t = new Frozenbits_generator_TV_merge(*this);
+    return t;
+}
+
+void
+Frozenbits_generator_TV_merge ::init_thresholds()
+{
+    // the conditional entropy of a pair of symbols is an increasing function of the ratio W(y|1) / W(y|0) in [0, 1],
+    // the thresholds split the entropy in 'mu' / 2 bins of the same width
+    const int n_bins = this->mu / 2;
+    this->thresholds.resize(n_bins - 1);
+    for (auto k = 1; k < n_bins; k++)
+    {
+        double r_min = 0.0, r_max = 1.0;
+        for (auto i = 0; i < 64; i++)
+        {
+            const auto r = (r_min + r_max) / 2.0;
+            if (binary_entropy(r / (1.0 + r)) < (double)k / (double)n_bins)
+                r_min = r;
+            else
+                r_max = r;
+        }
+        this->thresholds[k - 1] = (r_min + r_max) / 2.0;
+    }
+}
+
+void
+Frozenbits_generator_TV_merge ::init_channel(channel_t& W) const
+{
+    const auto n_bins = this->mu / 2;
+    const auto noise = (double)this->noise->get_value();
+
+    W.clear();
+    if (this->noise->get_type() == Noise_type::SIGMA)
+    {
+        // BPSK on the AWGN channel: the positive outputs are quantized on the edges of the entropy bins
+        const auto sqrt2_sigma = std::sqrt(2.0) * noise;
+        std::vector<double> edges(1, 0.0);
+        for (auto k = n_bins - 2; k >= 0; k--)
+            edges.push_back(-noise * noise / 2.0 * std::log(this->thresholds[k]));
+        edges.push_back(std::numeric_limits<double>::infinity());
+
+        for (size_t k = 0; k < edges.size() - 1; k++)
+        {
+            const auto a =
+              0.5 * (std::erfc((edges[k] - 1.0) / sqrt2_sigma) - std::erfc((edges[k + 1] - 1.0) / sqrt2_sigma));
+            const auto b =
+              0.5 * (std::erfc((edges[k] + 1.0) / sqrt2_sigma) - std::erfc((edges[k + 1] + 1.0) / sqrt2_sigma));
+            if (a + b > 0.0) W.push_back(std::make_pair(a, b));
+        }
+    }
+    else if (this->bsc)
+        W.push_back(std::make_pair(std::max(1.0 - noise, noise), std::min(1.0 - noise, noise)));
+    else
+    {
+        // the erasure symbol is its own conjugate, it is split in a pair of two symbols
+        if (noise < 1.0) W.push_back(std::make_pair(1.0 - noise, 0.0));
+        if (noise > 0.0) W.push_back(std::make_pair(noise / 2.0, noise / 2.0));
+    }
+}
+
+void
+Frozenbits_generator_TV_merge ::transform(const channel_t& W,
+                                          channel_t& W_child,
+                                          const bool plus,
+                                          std::vector<double>& bins) const
+{
+    std::fill(bins.begin(), bins.end(), 0.0);
+    auto merge = [&](double a, double b)
+    {
+        if (a < b) std::swap(a, b);
+        if (a == 0.0) return;
+        const auto k = std::upper_bound(this->thresholds.begin(), this->thresholds.end(), b / a) -
+                       this->thresholds.begin();
+        bins[2 * k + 0] += a;
+        bins[2 * k + 1] += b;
+    };
+
+    // the outputs (y_i, y_j) and (y_j, y_i) have the same likelihoods, only the pairs i <= j are computed
+    for (size_t i = 0; i < W.size(); i++)
+        for (size_t j = i; j < W.size(); j++)
+        {
+            const auto w = (i == j) ? 1.0 : 2.0;
+            const auto ai = W[i].first, bi = W[i].second, aj = W[j].first, bj = W[j].second;
+            if (!plus)
+                merge(w * (ai * aj + bi * bj), w * (ai * bj + bi * aj));
+            else
+            {
+                merge(w * ai * aj, w * bi * bj);
+                merge(w * ai * bj, w * bi * aj);
+            }
+        }
+
+    W_child.clear();
+    for (size_t k = 0; k < bins.size() / 2; k++)
+        if (bins[2 * k + 0] + bins[2 * k + 1] > 0.0)
+            W_child.push_back(std::make_pair(bins[2 * k + 0], bins[2 * k + 1]));
+}
+
+double
+Frozenbits_generator_TV_merge ::error_probability(const channel_t& W, const bool plus)
+{
+    // the merge does not change the error probability, the leaves are not merged
+    double pe = 0.0;
+    for (size_t i = 0; i < W.size(); i++)
+        for (size_t j = i; j < W.size(); j++)
+        {
+            const auto w = (i == j) ? 1.0 : 2.0;
+            const auto ai = W[i].first, bi = W[i].second, aj = W[j].first, bj = W[j].second;
+            pe += !plus ? w * (ai * bj + bi * aj) : w * (bi * bj + std::min(ai * bj, bi * aj));
+        }
+    return pe;
+}
+
+void
+Frozenbits_generator_TV_merge ::recursive_evaluate(const int lvl,
+                                                   const int idx,
+                                                   std::vector<channel_t>& W,
+                                                   std::vector<double>& bins)
+{
+    if (lvl == this->m)
+    {
+        this->pe[idx] = 0.0;
+        for (auto& y : W[lvl])
+            this->pe[idx] += y.second;
+    }
+    else if (lvl == this->m - 1)
+    {
+        this->pe[idx + 0] = error_probability(W[lvl], false);
+        this->pe[idx + 1] = error_probability(W[lvl], true);
+    }
+    else
+    {
+        this->transform(W[lvl], W[lvl + 1], false, bins);
+        this->recursive_evaluate(lvl + 1, idx, W, bins);
+        this->transform(W[lvl], W[lvl + 1], true, bins);
+        this->recursive_evaluate(lvl + 1, idx + (1 << (this->m - lvl - 1)), W, bins);
+    }
+}
+
+void
+Frozenbits_generator_TV_merge ::evaluate()
+{
+    this->check_noise();
+
+    // the first levels are evaluated breadth first to get enough sub-trees for the threads
+    int lvl = 0;
+    std::vector<std::pair<int, channel_t>> roots(1);
+    this->init_channel(roots[0].second);
+
+    std::vector<double> bins(this->mu);
+    while (lvl < this->m - 1 && (int)roots.size() < 8 * this->n_threads)
+    {
+        std::vector<std::pair<int, channel_t>> children(2 * roots.size());
+        for (size_t r = 0; r < roots.size(); r++)
+        {
+            children[2 * r + 0].first = roots[r].first;
+            children[2 * r + 1].first = roots[r].first + (1 << (this->m - lvl - 1));
+            this->transform(roots[r].second, children[2 * r + 0].second, false, bins);
+            this->transform(roots[r].second, children[2 * r + 1].second, true, bins);
+        }
+        roots = std::move(children);
+        lvl++;
+    }
+
+    std::atomic<size_t> next_root(0);
+    auto evaluate_roots = [&]()
+    {
+        std::vector<channel_t> W(this->m + 1);
+        std::vector<double> bins(this->mu);
+        for (auto r = next_root++; r < roots.size(); r = next_root++)
+        {
+            W[lvl] = roots[r].second;
+            this->recursive_evaluate(lvl, roots[r].first, W, bins);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (auto t = 1; t < std::min(this->n_threads, (int)roots.size()); t++)
+        threads.push_back(std::thread(evaluate_roots));
+    evaluate_roots();
+    for (auto& t : threads)
+        t.join();
+
+    std::iota(this->best_channels.begin(), this->best_channels.end(), 0);
+    std::stable_sort(this->best_channels.begin(),
+                     this->best_channels.end(),
+                     [this](uint32_t i1, uint32_t i2) { return this->pe[i1] < this->pe[i2]; });
+}
+
+std::string
+Frozenbits_generator_TV_merge ::get_construction() const
+{
+    return "TV_merge_mu" + std::to_string(this->mu) + (this->bsc ? "_BSC" : "");
+}
+
+void
+Frozenbits_generator_TV_merge ::check_noise()
+{
+    Frozenbits_generator::check_noise();
+
+    if (this->bsc || !this->noise->is_of_type(tools::Noise_type::SIGMA))
+        this->noise->is_of_type_throw(tools::Noise_type::EP);
+}
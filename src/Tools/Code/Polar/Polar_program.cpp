@@ -0,0 +1,277 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include "Tools/Code/Polar/Polar_program.hpp"
+#include "Tools/general_utils.h"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+static const char polar_program_magic[8] = { 'A', 'F', 'F', '3', 'C', 'T', 'P', 'P' };
+static const uint32_t polar_program_version = 1;
+
+// number of 'l' and 's' offsets of each 'polar_op_t' instruction (the 'l' offsets come first)
+static const int polar_program_n_l[10] = { 3, 3, 3, 3, 1, 0, 1, 1, 0, 0 };
+static const int polar_program_n_s[10] = { 0, 1, 0, 1, 1, 1, 1, 1, 3, 2 };
+
+Polar_program ::Polar_program()
+  : N(0)
+{
+}
+
+Polar_program ::Polar_program(const Pattern_polar_parser& polar_patterns)
+  : N((int)polar_patterns.get_frozen_bits().size())
+  , leaves_pattern_types(polar_patterns.get_leaves_pattern_types())
+{
+    int node_id = 0;
+    this->recursive_compile(polar_patterns, 0, 0, (int)std::log2(this->N), node_id);
+}
+
+int
+Polar_program ::get_N() const
+{
+    return this->N;
+}
+
+const std::vector<polar_instr_t>&
+Polar_program ::get_instructions() const
+{
+    return this->instructions;
+}
+
+const std::vector<std::pair<unsigned char, int>>&
+Polar_program ::get_leaves_pattern_types() const
+{
+    return this->leaves_pattern_types;
+}
+
+void
+Polar_program ::emit(const polar_op_t op,
+                     const int n_elmts,
+                     const int off0,
+                     const int off1,
+                     const int off2,
+                     const int off3)
+{
+    this->instructions.push_back({ op, n_elmts, { off0, off1, off2, off3 } });
+}
+
+void
+Polar_program ::recursive_compile(const Pattern_polar_parser& polar_patterns,
+                                  const int off_l,
+                                  const int off_s,
+                                  const int reverse_depth,
+                                  int& node_id)
+{
+    const int n_elmts = 1 << reverse_depth;
+    const int n_elm_2 = n_elmts >> 1;
+    const auto node_type = polar_patterns.get_node_type(node_id);
+
+    const bool is_terminal_pattern = (node_type == polar_node_t::RATE_0) || (node_type == polar_node_t::RATE_1) ||
+                                     (node_type == polar_node_t::REP) || (node_type == polar_node_t::SPC);
+
+    if (!is_terminal_pattern && reverse_depth)
+    {
+        // f
+        if (node_type == polar_node_t::STANDARD || node_type == polar_node_t::REP_LEFT)
+            this->emit(polar_op_t::F, n_elm_2, off_l, off_l + n_elm_2, off_l + n_elmts);
+
+        // the hard decisions of a rate 0 left child are overwritten by 'xo0': they are not computed
+        if (node_type == polar_node_t::RATE_0_LEFT && polar_patterns.get_node_type(node_id + 1) == polar_node_t::RATE_0)
+            ++node_id;
+        else
+            this->recursive_compile(polar_patterns, off_l + n_elmts, off_s, reverse_depth - 1, ++node_id);
+
+        // g
+        switch (node_type)
+        {
+            case polar_node_t::STANDARD:
+                this->emit(polar_op_t::G, n_elm_2, off_l, off_l + n_elm_2, off_l + n_elmts, off_s);
+                break;
+            case polar_node_t::RATE_0_LEFT:
+                this->emit(polar_op_t::G0, n_elm_2, off_l, off_l + n_elm_2, off_l + n_elmts);
+                break;
+            case polar_node_t::REP_LEFT:
+                this->emit(polar_op_t::GR, n_elm_2, off_l, off_l + n_elm_2, off_l + n_elmts, off_s);
+                break;
+            default:
+                break;
+        }
+
+        this->recursive_compile(polar_patterns, off_l + n_elmts, off_s + n_elm_2, reverse_depth - 1, ++node_id);
+
+        // xor
+        switch (node_type)
+        {
+            case polar_node_t::STANDARD:
+            case polar_node_t::REP_LEFT:
+                this->emit(polar_op_t::XO, n_elm_2, off_s, off_s + n_elm_2, off_s);
+                break;
+            case polar_node_t::RATE_0_LEFT:
+                this->emit(polar_op_t::XO0, n_elm_2, off_s + n_elm_2, off_s);
+                break;
+            default:
+                break;
+        }
+    }
+    else
+    {
+        // h
+        switch (node_type)
+        {
+            case polar_node_t::RATE_0:
+                this->emit(polar_op_t::H0, n_elmts, off_s);
+                break;
+            case polar_node_t::RATE_1:
+                this->emit(polar_op_t::H, n_elmts, off_l, off_s);
+                break;
+            case polar_node_t::REP:
+                this->emit(polar_op_t::REP, n_elmts, off_l, off_s);
+                break;
+            case polar_node_t::SPC:
+                this->emit(polar_op_t::SPC, n_elmts, off_l, off_s);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+bool
+Polar_program ::save(const std::string& path, const uint64_t key) const
+{
+    // several decoders (threads or processes) can save the same program at the same time
+    const auto tmp_path = unique_tmp_path(path);
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+
+    const uint64_t N = this->N, n_instr = this->instructions.size(), n_leaves = this->leaves_pattern_types.size();
+    file.write(polar_program_magic, sizeof(polar_program_magic));
+    file.write((const char*)&polar_program_version, sizeof(polar_program_version));
+    file.write((const char*)&key, sizeof(key));
+    file.write((const char*)&N, sizeof(N));
+    file.write((const char*)&n_instr, sizeof(n_instr));
+    file.write((const char*)&n_leaves, sizeof(n_leaves));
+    for (auto& i : this->instructions)
+    {
+        const int32_t instr[6] = { (int32_t)i.op, i.n_elmts, i.off[0], i.off[1], i.off[2], i.off[3] };
+        file.write((const char*)instr, sizeof(instr));
+    }
+    for (auto& l : this->leaves_pattern_types)
+    {
+        const int32_t leaf[2] = { (int32_t)l.first, (int32_t)l.second };
+        file.write((const char*)leaf, sizeof(leaf));
+    }
+    file.close();
+
+    // the previous file is replaced only when the new one is complete
+    if (!file || std::rename(tmp_path.c_str(), path.c_str()))
+    {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool
+Polar_program ::load(const std::string& path, const uint64_t key)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    char magic[sizeof(polar_program_magic)];
+    uint32_t version = 0;
+    uint64_t file_key = 0, N = 0, n_instr = 0, n_leaves = 0;
+    file.read(magic, sizeof(magic));
+    file.read((char*)&version, sizeof(version));
+    file.read((char*)&file_key, sizeof(file_key));
+    file.read((char*)&N, sizeof(N));
+    file.read((char*)&n_instr, sizeof(n_instr));
+    file.read((char*)&n_leaves, sizeof(n_leaves));
+
+    if (!file || std::memcmp(magic, polar_program_magic, sizeof(magic)) || version != polar_program_version ||
+        file_key != key || n_leaves > N || n_instr > 4 * N)
+        return false;
+
+    // the decoder uses the offsets without checking them: a corrupted file is a cache miss
+    const auto in_bounds = [](const int32_t off, const int32_t n_elmts, const uint64_t size)
+    { return off >= 0 && (uint64_t)off + (uint64_t)n_elmts <= size; };
+
+    std::vector<polar_instr_t> instructions((size_t)n_instr);
+    for (auto& i : instructions)
+    {
+        int32_t instr[6];
+        file.read((char*)instr, sizeof(instr));
+        if (!file || instr[0] < 0 || instr[0] > (int32_t)polar_op_t::XO0) return false;
+
+        // the 'l' buffer is '2 * N' long and the 's' buffer is 'N' long (per frame)
+        const auto op = (polar_op_t)instr[0];
+        const auto n_elmts = instr[1];
+        const int n_l = polar_program_n_l[instr[0]];
+        const int n_s = polar_program_n_s[instr[0]];
+        if (n_elmts <= 0 || (uint64_t)n_elmts > N) return false;
+        for (auto o = 0; o < n_l + n_s; o++)
+            if (!in_bounds(instr[2 + o], n_elmts, o < n_l ? 2 * N : N)) return false;
+
+        i = { op, n_elmts, { instr[2], instr[3], instr[4], instr[5] } };
+    }
+
+    uint64_t leaves_size = 0;
+    std::vector<std::pair<unsigned char, int>> leaves_pattern_types((size_t)n_leaves);
+    for (auto& l : leaves_pattern_types)
+    {
+        int32_t leaf[2];
+        file.read((char*)leaf, sizeof(leaf));
+        if (!file || leaf[1] <= 0) return false;
+        leaves_size += (uint64_t)leaf[1];
+        l = std::make_pair((unsigned char)leaf[0], (int)leaf[1]);
+    }
+    if (leaves_size != N) return false;
+
+    this->N = (int)N;
+    this->instructions = std::move(instructions);
+    this->leaves_pattern_types = std::move(leaves_pattern_types);
+    return true;
+}
+
+uint64_t
+Polar_program ::hash(const std::vector<bool>& frozen_bits,
+                     const std::vector<Pattern_polar_i*>& patterns,
+                     const size_t pattern_rate0_id,
+                     const size_t pattern_rate1_id)
+{
+    uint64_t h = 0xcbf29ce484222325ull; // FNV-1a offset basis
+    auto add = [&h](uint64_t v)
+    {
+        for (auto b = 0; b < 8; b++)
+        {
+            h ^= (v >> (8 * b)) & 0xFF;
+            h *= 0x100000001b3ull; // FNV-1a prime
+        }
+    };
+
+    add(polar_program_version);
+    add(frozen_bits.size());
+    for (size_t i = 0; i < frozen_bits.size(); i += 64)
+    {
+        uint64_t word = 0;
+        for (size_t j = i; j < std::min(i + 64, frozen_bits.size()); j++)
+            word |= (uint64_t)frozen_bits[j] << (j - i);
+        add(word);
+    }
+
+    add(patterns.size());
+    for (auto p : patterns)
+    {
+        add((uint64_t)p->type());
+        add((uint64_t)(int64_t)p->get_min_lvl());
+        add((uint64_t)(int64_t)p->get_max_lvl());
+    }
+    add(pattern_rate0_id);
+    add(pattern_rate1_id);
+
+    return h;
+}
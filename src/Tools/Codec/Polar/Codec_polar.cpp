@@ -121,13 +121,13 @@ Codec_polar<B, Q>::Codec_polar(const factory::Frozenbits_generator& fb_params,
     {
         if (!adaptive_fb)
         {
-            if (fb_params.type == "BEC")
+            if (fb_params.type == "BEC" || (fb_params.type == "TVM" && fb_params.tv_channel != "AWGN"))
             {
                 Event_probability<> ep(fb_params.noise);
                 fb_generator->set_noise(ep);
                 fb_generator->generate(*frozen_bits);
             }
-            else /* type = GA, TV or FILE */
+            else /* type = GA, TV, TVM or FILE */
             {
                 Sigma<> sigma(fb_params.noise);
                 fb_generator->set_noise(sigma);
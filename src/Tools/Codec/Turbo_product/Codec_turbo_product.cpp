@@ -7,6 +7,7 @@
 #include "Module/Decoder/BCH/Decoder_BCH.hpp"
 #include "Module/Decoder/Turbo_product/Chase_pyndiah/Decoder_chase_pyndiah.hpp"
 #include "Module/Decoder/Turbo_product/Chase_pyndiah/Decoder_chase_pyndiah_fast.hpp"
+#include "Module/Decoder/Turbo_product/Chase_pyndiah/Decoder_chase_pyndiah_incr.hpp"
 #include "Module/Encoder/BCH/Encoder_BCH.hpp"
 #include "Tools/Codec/Turbo_product/Codec_turbo_product.hpp"
 
@@ -76,6 +77,18 @@ Codec_turbo_product<B, Q>::Codec_turbo_product(const factory::Encoder_turbo_prod
                                                                   dec_params.cp_coef));
         dec_cp->set_n_frames(N_cw_p);
     }
+    else if (dec_params.implem == "INCR")
+    {
+        dec_cp.reset(new module::Decoder_chase_pyndiah_incr<B, Q>(dec_bch->get_K(),
+                                                                  N_cw_p,
+                                                                  *dec_bch,
+                                                                  *enc_bch,
+                                                                  dec_params.n_least_reliable_positions,
+                                                                  dec_params.n_test_vectors,
+                                                                  dec_params.n_competitors,
+                                                                  dec_params.cp_coef));
+        dec_cp->set_n_frames(N_cw_p);
+    }
     else
     {
         dec_cp.reset(new module::Decoder_chase_pyndiah<B, Q>(dec_bch->get_K(),
@@ -0,0 +1,102 @@
+#include <memory>
+#include <sstream>
+#include <streampu.hpp>
+
+#include "Tools/Monitor/Monitor_BFER_counters.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+constexpr size_t Monitor_BFER_counters::cache_line;
+
+Monitor_BFER_counters ::Monitor_BFER_counters(const size_t n_shards)
+  : n_shards(n_shards)
+  , buffer((n_shards + 1) * sizeof(Shard) + cache_line)
+  , shards(nullptr)
+  , n_claimed(0)
+{
+    if (n_shards == 0)
+    {
+        std::stringstream message;
+        message << "'n_shards' has to be greater than 0.";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    void* ptr = this->buffer.data();
+    auto space = this->buffer.size();
+    if (std::align(cache_line, (n_shards + 1) * sizeof(Shard), ptr, space) == nullptr)
+    {
+        std::stringstream message;
+        message << "The shards can't be aligned on the cache lines ('buffer.size()' = " << this->buffer.size() << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    this->shards = static_cast<Shard*>(ptr);
+    for (size_t s = 0; s <= n_shards; s++)
+        new (&this->shards[s]) Shard();
+
+    this->reset();
+}
+
+size_t
+Monitor_BFER_counters ::claim_shard()
+{
+    return 1 + this->n_claimed++ % this->n_shards;
+}
+
+void
+Monitor_BFER_counters ::add_frame(const size_t shard, const unsigned n_be)
+{
+    auto& s = this->shards[shard];
+    s.n_fra.fetch_add(1, std::memory_order_relaxed);
+    if (n_be)
+    {
+        s.n_be.fetch_add(n_be, std::memory_order_relaxed);
+        this->shards[0].n_fe.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void
+Monitor_BFER_counters ::add_values(const unsigned long long n_fra,
+                                   const unsigned long long n_be,
+                                   const unsigned long long n_fe)
+{
+    this->shards[0].n_fra.fetch_add(n_fra, std::memory_order_relaxed);
+    this->shards[0].n_be.fetch_add(n_be, std::memory_order_relaxed);
+    this->shards[0].n_fe.fetch_add(n_fe, std::memory_order_relaxed);
+}
+
+unsigned long long
+Monitor_BFER_counters ::get_n_analyzed_fra() const
+{
+    unsigned long long n_fra = 0;
+    for (size_t s = 0; s <= this->n_shards; s++)
+        n_fra += this->shards[s].n_fra.load(std::memory_order_relaxed);
+    return n_fra;
+}
+
+unsigned long long
+Monitor_BFER_counters ::get_n_be() const
+{
+    unsigned long long n_be = 0;
+    for (size_t s = 0; s <= this->n_shards; s++)
+        n_be += this->shards[s].n_be.load(std::memory_order_relaxed);
+    return n_be;
+}
+
+unsigned long long
+Monitor_BFER_counters ::get_n_fe() const
+{
+    return this->shards[0].n_fe.load(std::memory_order_relaxed);
+}
+
+void
+Monitor_BFER_counters ::reset()
+{
+    for (size_t s = 0; s <= this->n_shards; s++)
+    {
+        this->shards[s].n_fra = 0;
+        this->shards[s].n_be = 0;
+        this->shards[s].n_fe = 0;
+    }
+}
@@ -0,0 +1,224 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <streampu.hpp>
+#include <utility>
+
+#include "Tools/Algo/Histogram.hpp"
+#include "Tools/Monitor/Monitor_checkpoint.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+static const char checkpoint_magic[8] = { 'A', 'F', 'F', '3', 'C', 'T', 'C', 'P' };
+static const uint32_t checkpoint_version = 1;
+
+Monitor_checkpoint ::Monitor_checkpoint(const std::string& path, const int n_info)
+  : path(path)
+  , n_info(n_info)
+  , n_runs(0)
+{
+    if (path.empty())
+    {
+        std::stringstream message;
+        message << "'path' can't be empty.";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+}
+
+void
+Monitor_checkpoint ::load()
+{
+    std::lock_guard<std::mutex> lock(this->mtx);
+
+    std::ifstream file(this->path, std::ios::binary);
+    if (!file.is_open())
+    {
+        std::stringstream message;
+        message << "Impossible to read the checkpoint file ('path' = " << this->path << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    char magic[sizeof(checkpoint_magic)];
+    uint32_t version = 0, n_runs = 0, n_points = 0;
+    int32_t n_info = 0;
+    file.read(magic, sizeof(magic));
+    file.read((char*)&version, sizeof(version));
+    file.read((char*)&n_runs, sizeof(n_runs));
+    file.read((char*)&n_info, sizeof(n_info));
+    file.read((char*)&n_points, sizeof(n_points));
+
+    if (!file || std::memcmp(magic, checkpoint_magic, sizeof(magic)) || version != checkpoint_version)
+    {
+        std::stringstream message;
+        message << "The file is not a valid checkpoint ('path' = " << this->path << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (n_info != this->n_info)
+    {
+        std::stringstream message;
+        message << "The checkpoint has been written by another simulation ('n_info' = " << n_info
+                << ", 'this->n_info' = " << this->n_info << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    std::map<float, Point> points;
+    for (uint32_t p = 0; p < n_points; p++)
+    {
+        float noise_val;
+        uint64_t n_fra, n_be, n_fe;
+        uint32_t n_hist;
+        file.read((char*)&noise_val, sizeof(noise_val));
+        file.read((char*)&n_fra, sizeof(n_fra));
+        file.read((char*)&n_be, sizeof(n_be));
+        file.read((char*)&n_fe, sizeof(n_fe));
+        file.read((char*)&n_hist, sizeof(n_hist));
+
+        auto& point = points[noise_val];
+        point.n_fra = n_fra;
+        point.n_be = n_be;
+        point.n_fe = n_fe;
+        for (uint32_t h = 0; h < n_hist && file; h++)
+        {
+            std::pair<int32_t, uint64_t> bin;
+            file.read((char*)&bin.first, sizeof(bin.first));
+            file.read((char*)&bin.second, sizeof(bin.second));
+            point.err_hist.push_back(bin);
+        }
+
+        if (!file)
+        {
+            std::stringstream message;
+            message << "The checkpoint file is truncated ('path' = " << this->path << ", 'p' = " << p
+                    << ", 'n_points' = " << n_points << ").";
+            throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+        }
+    }
+
+    this->n_runs = n_runs;
+    this->points = std::move(points);
+}
+
+template<typename B>
+void
+Monitor_checkpoint ::save(const float noise_val, const module::Monitor_BFER<B>& monitor)
+{
+    std::lock_guard<std::mutex> lock(this->mtx);
+
+    auto& point = this->points[noise_val];
+    point.n_fra = monitor.get_n_analyzed_fra();
+    point.n_be = monitor.get_n_be();
+    point.n_fe = monitor.get_n_fe();
+    point.err_hist.clear();
+    const auto& err_hist = monitor.get_err_hist();
+    for (auto& bin : err_hist.get_hist())
+        point.err_hist.push_back(std::make_pair((int32_t)err_hist.uncalibrate_val(bin.first), (uint64_t)bin.second));
+
+    this->write();
+}
+
+template<typename B>
+bool
+Monitor_checkpoint ::restore(const float noise_val, module::Monitor_BFER<B>& monitor)
+{
+    std::lock_guard<std::mutex> lock(this->mtx);
+
+    auto it = this->points.find(noise_val);
+    if (it == this->points.end()) return false;
+
+    const auto& point = it->second;
+    Histogram<int> err_hist(0);
+    for (auto& bin : point.err_hist)
+        err_hist.add_value((int)bin.first, (size_t)bin.second);
+
+    monitor.add_values(point.n_fra, point.n_be, point.n_fe, err_hist);
+    return true;
+}
+
+void
+Monitor_checkpoint ::write()
+{
+    const auto tmp_path = this->path + ".tmp";
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        std::stringstream message;
+        message << "Impossible to write the checkpoint file ('tmp_path' = " << tmp_path << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    const uint32_t n_runs = this->n_runs + 1;
+    const int32_t n_info = this->n_info;
+    const uint32_t n_points = (uint32_t)this->points.size();
+    file.write(checkpoint_magic, sizeof(checkpoint_magic));
+    file.write((const char*)&checkpoint_version, sizeof(checkpoint_version));
+    file.write((const char*)&n_runs, sizeof(n_runs));
+    file.write((const char*)&n_info, sizeof(n_info));
+    file.write((const char*)&n_points, sizeof(n_points));
+
+    for (auto& p : this->points)
+    {
+        const uint64_t n_fra = p.second.n_fra, n_be = p.second.n_be, n_fe = p.second.n_fe;
+        const uint32_t n_hist = (uint32_t)p.second.err_hist.size();
+        file.write((const char*)&p.first, sizeof(p.first));
+        file.write((const char*)&n_fra, sizeof(n_fra));
+        file.write((const char*)&n_be, sizeof(n_be));
+        file.write((const char*)&n_fe, sizeof(n_fe));
+        file.write((const char*)&n_hist, sizeof(n_hist));
+        for (auto& bin : p.second.err_hist)
+        {
+            file.write((const char*)&bin.first, sizeof(bin.first));
+            file.write((const char*)&bin.second, sizeof(bin.second));
+        }
+    }
+    file.close();
+
+    // the previous checkpoint is replaced only when the new one is complete
+    if (!file || std::rename(tmp_path.c_str(), this->path.c_str()))
+    {
+        std::stringstream message;
+        message << "Impossible to write the checkpoint file ('path' = " << this->path << ").";
+        throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
+    }
+}
+
+uint32_t
+Monitor_checkpoint ::get_n_runs() const
+{
+    return this->n_runs;
+}
+
+const std::string&
+Monitor_checkpoint ::get_path() const
+{
+    return this->path;
+}
+
+// ==================================================================================== explicit template instantiation
+#include "Tools/types.h"
+#ifdef AFF3CT_MULTI_PREC
+template void
+aff3ct::tools::Monitor_checkpoint::save<B_8>(const float, const module::Monitor_BFER<B_8>&);
+template void
+aff3ct::tools::Monitor_checkpoint::save<B_16>(const float, const module::Monitor_BFER<B_16>&);
+template void
+aff3ct::tools::Monitor_checkpoint::save<B_32>(const float, const module::Monitor_BFER<B_32>&);
+template void
+aff3ct::tools::Monitor_checkpoint::save<B_64>(const float, const module::Monitor_BFER<B_64>&);
+template bool
+aff3ct::tools::Monitor_checkpoint::restore<B_8>(const float, module::Monitor_BFER<B_8>&);
+template bool
+aff3ct::tools::Monitor_checkpoint::restore<B_16>(const float, module::Monitor_BFER<B_16>&);
+template bool
+aff3ct::tools::Monitor_checkpoint::restore<B_32>(const float, module::Monitor_BFER<B_32>&);
+template bool
+aff3ct::tools::Monitor_checkpoint::restore<B_64>(const float, module::Monitor_BFER<B_64>&);
+#else
+template void
+aff3ct::tools::Monitor_checkpoint::save<B>(const float, const module::Monitor_BFER<B>&);
+template bool
+aff3ct::tools::Monitor_checkpoint::restore<B>(const float, module::Monitor_BFER<B>&);
+#endif
+// ==================================================================================== explicit template instantiation
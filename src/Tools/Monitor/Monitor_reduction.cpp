@@ -10,50 +10,88 @@
 using namespace aff3ct;
 using namespace aff3ct::tools;
 
-bool aff3ct::tools::Monitor_reduction_static::stop_loop = false;
-std::vector<aff3ct::tools::Monitor_reduction_static*> aff3ct::tools::Monitor_reduction_static::monitors;
-std::thread::id aff3ct::tools::Monitor_reduction_static::master_thread_id = std::this_thread::get_id();
+std::map<size_t, aff3ct::tools::Monitor_reduction_static::Group> aff3ct::tools::Monitor_reduction_static::groups = {
+    { 0, aff3ct::tools::Monitor_reduction_static::Group() }
+};
 std::chrono::nanoseconds aff3ct::tools::Monitor_reduction_static::d_reduce_frequency = std::chrono::milliseconds(1000);
-std::chrono::time_point<std::chrono::steady_clock, std::chrono::nanoseconds>
-  aff3ct::tools::Monitor_reduction_static::t_last_reduction;
 
-Monitor_reduction_static ::Monitor_reduction_static()
+Monitor_reduction_static::Group ::Group()
+  : stop_loop(false)
+  , master_thread_id(std::this_thread::get_id())
+  , t_last_reduction(std::chrono::steady_clock::now())
+{
+}
+
+Monitor_reduction_static ::Monitor_reduction_static(const size_t group)
+  : group_id(group)
+  , group_state(Monitor_reduction_static::add_monitor(this, group))
 {
-    Monitor_reduction_static::add_monitor(this);
 }
 
 Monitor_reduction_static ::~Monitor_reduction_static()
 {
-    Monitor_reduction_static::remove_monitor(this);
+    Monitor_reduction_static::remove_monitor(this, this->group_id);
 }
 
-void
-Monitor_reduction_static ::add_monitor(Monitor_reduction_static* m)
+size_t
+Monitor_reduction_static ::get_group() const
+{
+    return this->group_id;
+}
+
+Monitor_reduction_static::Group&
+Monitor_reduction_static ::get_group(const size_t group)
+{
+    auto it = Monitor_reduction_static::groups.find(group);
+    if (it == Monitor_reduction_static::groups.end())
+    {
+        std::stringstream message;
+        message << "The reduction group does not exist ('group' = " << group << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    return it->second;
+}
+
+Monitor_reduction_static::Group&
+Monitor_reduction_static ::add_monitor(Monitor_reduction_static* m, const size_t group)
 {
-    Monitor_reduction_static::monitors.push_back(m);
+    auto& g = Monitor_reduction_static::groups[group];
+    g.monitors.push_back(m);
+    return g;
 }
 
 void
-Monitor_reduction_static ::remove_monitor(Monitor_reduction_static* m)
+Monitor_reduction_static ::remove_monitor(Monitor_reduction_static* m, const size_t group)
 {
-    for (size_t i = 0; i < Monitor_reduction_static::monitors.size(); i++)
-        if (m == Monitor_reduction_static::monitors[i])
+    auto& monitors = Monitor_reduction_static::get_group(group).monitors;
+    for (size_t i = 0; i < monitors.size(); i++)
+        if (m == monitors[i])
         {
-            Monitor_reduction_static::monitors.erase(Monitor_reduction_static::monitors.begin() + i);
+            monitors.erase(monitors.begin() + i);
             break;
         }
 }
 
 void
-Monitor_reduction_static ::reset_all()
+Monitor_reduction_static ::reset_all(const size_t group)
 {
-    Monitor_reduction_static::t_last_reduction = std::chrono::steady_clock::now();
-    Monitor_reduction_static::stop_loop = false;
+    auto& g = Monitor_reduction_static::get_group(group);
+    g.t_last_reduction = std::chrono::steady_clock::now();
+    g.stop_loop = false;
 
-    for (auto& m : Monitor_reduction_static::monitors)
+    for (auto& m : g.monitors)
         m->reset();
 }
 
+void
+Monitor_reduction_static ::resume_all(const size_t group)
+{
+    auto& g = Monitor_reduction_static::get_group(group);
+    g.t_last_reduction = std::chrono::steady_clock::now();
+    g.stop_loop = false;
+}
+
 bool
 Monitor_reduction_static ::is_done()
 {
@@ -61,39 +99,39 @@ Monitor_reduction_static ::is_done()
 }
 
 bool
-Monitor_reduction_static ::is_done_all(bool fully)
+Monitor_reduction_static ::is_done_all(bool fully, const size_t group)
 {
-    reduce_all(fully, false);
+    reduce_all(fully, false, group);
 
     bool is_done = false;
 
-    for (auto& m : Monitor_reduction_static::monitors)
+    for (auto& m : Monitor_reduction_static::get_group(group).monitors)
         is_done |= m->_is_done();
 
-    if (is_done) set_stop_loop();
+    if (is_done) set_stop_loop(group);
 
-    return get_stop_loop();
+    return get_stop_loop(group);
 }
 
 void
-Monitor_reduction_static ::reduce_all(bool fully, bool force)
+Monitor_reduction_static ::reduce_all(bool fully, bool force, const size_t group)
 {
-    _reduce(fully, force);
+    _reduce(fully, force, group);
 }
 
 void
-Monitor_reduction_static ::last_reduce_all(bool fully)
+Monitor_reduction_static ::last_reduce_all(bool fully, const size_t group)
 {
-    Monitor_reduction_static::set_stop_loop();
-    while (!_reduce(fully, true))
+    Monitor_reduction_static::set_stop_loop(group);
+    while (!_reduce(fully, true, group))
         ;
 }
 
 void
-Monitor_reduction_static ::check_reducible()
+Monitor_reduction_static ::check_reducible(const size_t group)
 {
 #ifdef AFF3CT_MPI
-    int n_monitor_send = Monitor_reduction_static::monitors.size(), n_monitor_recv;
+    int n_monitor_send = Monitor_reduction_static::get_group(group).monitors.size(), n_monitor_recv;
     if (auto ret = MPI_Allreduce(&n_monitor_send, &n_monitor_recv, 1, MPI_INT, MPI_PROD, MPI_COMM_WORLD))
     {
         std::stringstream message;
@@ -130,10 +168,10 @@ Monitor_reduction_static ::check_reducible()
 }
 
 bool
-Monitor_reduction_static ::reduce_stop_loop()
+Monitor_reduction_static ::reduce_stop_loop(const size_t group)
 {
 #ifdef AFF3CT_MPI
-    int n_stop_recv, stop_send = Monitor_reduction_static::get_stop_loop() ? 1 : 0;
+    int n_stop_recv, stop_send = Monitor_reduction_static::get_stop_loop(group) ? 1 : 0;
     if (auto ret = MPI_Allreduce(&stop_send, &n_stop_recv, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD))
     {
         std::stringstream message;
@@ -141,7 +179,7 @@ Monitor_reduction_static ::reduce_stop_loop()
         throw spu::tools::runtime_error(__FILE__, __LINE__, __func__, message.str());
     }
 
-    if (n_stop_recv > 0) Monitor_reduction_static::set_stop_loop();
+    if (n_stop_recv > 0) Monitor_reduction_static::set_stop_loop(group);
 
     int np;
     if (auto ret = MPI_Comm_size(MPI_COMM_WORLD, &np))
@@ -158,30 +196,31 @@ Monitor_reduction_static ::reduce_stop_loop()
 }
 
 bool
-Monitor_reduction_static ::_reduce(bool fully, bool force)
+Monitor_reduction_static ::_reduce(bool fully, bool force, const size_t group)
 {
     bool all_process_on_last = false;
+    auto& g = Monitor_reduction_static::get_group(group);
 
-    // only the master thread can do this
-    if (force || (std::this_thread::get_id() == Monitor_reduction_static::master_thread_id &&
-                  (std::chrono::steady_clock::now() - Monitor_reduction_static::t_last_reduction) >=
+    // only the master thread of the group can do this
+    if (force || (std::this_thread::get_id() == g.master_thread_id &&
+                  (std::chrono::steady_clock::now() - g.t_last_reduction) >=
                     Monitor_reduction_static::d_reduce_frequency))
     {
-        for (auto& m : Monitor_reduction_static::monitors)
+        for (auto& m : g.monitors)
             m->reduce(fully);
 
-        all_process_on_last = reduce_stop_loop();
+        all_process_on_last = reduce_stop_loop(group);
 
-        Monitor_reduction_static::t_last_reduction = std::chrono::steady_clock::now();
+        g.t_last_reduction = std::chrono::steady_clock::now();
     }
 
     return all_process_on_last;
 }
 
 void
-Monitor_reduction_static ::set_master_thread_id(std::thread::id t)
+Monitor_reduction_static ::set_master_thread_id(std::thread::id t, const size_t group)
 {
-    Monitor_reduction_static::master_thread_id = t;
+    Monitor_reduction_static::get_group(group).master_thread_id = t;
 }
 
 void
@@ -191,13 +230,13 @@ Monitor_reduction_static ::set_reduce_frequency(std::chrono::nanoseconds d)
 }
 
 bool
-Monitor_reduction_static ::get_stop_loop()
+Monitor_reduction_static ::get_stop_loop(const size_t group)
 {
-    return Monitor_reduction_static::stop_loop;
+    return Monitor_reduction_static::get_group(group).stop_loop;
 }
 
 void
-Monitor_reduction_static ::set_stop_loop()
+Monitor_reduction_static ::set_stop_loop(const size_t group)
 {
-    Monitor_reduction_static::stop_loop = true;
+    Monitor_reduction_static::get_group(group).stop_loop = true;
 }
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <streampu.hpp>
+
+#include "Tools/Noise/Noise_range_adaptive.hpp"
+
+using namespace aff3ct;
+using namespace aff3ct::tools;
+
+Noise_range_adaptive ::Noise_range_adaptive(const std::vector<float>& coarse_range,
+                                            const double target_fer,
+                                            const float min_step,
+                                            const float max_dec)
+  : coarse_range(coarse_range)
+  , target_fer(target_fer)
+  , min_step(min_step)
+  , max_dec(max_dec)
+  , direction(coarse_range.size() > 1 && coarse_range.back() < coarse_range.front() ? -1.f : 1.f)
+  , n_coarse_sched(0)
+  , coarse_done(false)
+{
+    if (coarse_range.empty())
+    {
+        std::stringstream message;
+        message << "'coarse_range' can't be empty.";
+        throw spu::tools::length_error(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (target_fer <= 0. || target_fer >= 1.)
+    {
+        std::stringstream message;
+        message << "'target_fer' has to be in the ]0, 1[ range ('target_fer' = " << target_fer << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (min_step <= 0.f)
+    {
+        std::stringstream message;
+        message << "'min_step' has to be greater than 0 ('min_step' = " << min_step << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+
+    if (max_dec <= 0.f)
+    {
+        std::stringstream message;
+        message << "'max_dec' has to be greater than 0 ('max_dec' = " << max_dec << ").";
+        throw spu::tools::invalid_argument(__FILE__, __LINE__, __func__, message.str());
+    }
+}
+
+double
+Noise_range_adaptive ::get_fer(const Point& p)
+{
+    if (p.n_fra == 0) return 1.;
+    return (p.n_fe ? (double)p.n_fe : 0.5) / (double)p.n_fra;
+}
+
+void
+Noise_range_adaptive ::add_result(const float value,
+                                  const unsigned long long n_fe,
+                                  const unsigned long long n_fra,
+                                  const bool limit_reached)
+{
+    const Point p = { value, n_fe, n_fra };
+    const auto dir = this->direction;
+    auto it = std::upper_bound(this->points.begin(),
+                               this->points.end(),
+                               p,
+                               [dir](const Point& a, const Point& b) { return dir * a.value < dir * b.value; });
+    this->points.insert(it, p);
+
+    if (!this->coarse_done && (limit_reached || (n_fra && (double)n_fe / (double)n_fra <= this->target_fer)))
+        this->coarse_done = true;
+}
+
+bool
+Noise_range_adaptive ::next(float& value)
+{
+    if (!this->coarse_done)
+    {
+        if (this->n_coarse_sched < this->coarse_range.size())
+        {
+            value = this->coarse_range[this->n_coarse_sched++];
+            return true;
+        }
+        this->coarse_done = true;
+    }
+
+    // refine the interval where the FER changes the most
+    auto best_dec = (double)this->max_dec;
+    auto best = this->points.size();
+    for (size_t i = 1; i < this->points.size(); i++)
+    {
+        const auto width = std::abs(this->points[i].value - this->points[i - 1].value);
+        if (width < 2.f * this->min_step * (1.f - 1e-4f)) continue;
+
+        const auto dec = std::abs(std::log10(get_fer(this->points[i - 1])) - std::log10(get_fer(this->points[i])));
+        if (dec > best_dec)
+        {
+            best_dec = dec;
+            best = i;
+        }
+    }
+
+    if (best == this->points.size()) return false;
+
+    value = (this->points[best - 1].value + this->points[best].value) / 2.f;
+    return true;
+}
+
+bool
+Noise_range_adaptive ::is_bracketed() const
+{
+    for (size_t i = 1; i < this->points.size(); i++)
+        if (get_fer(this->points[i - 1]) > this->target_fer && this->points[i].n_fra &&
+            (double)this->points[i].n_fe / (double)this->points[i].n_fra <= this->target_fer)
+            return true;
+    return false;
+}
+
+size_t
+Noise_range_adaptive ::get_n_points() const
+{
+    return this->points.size();
+}
@@ -1,3 +1,4 @@
+#include <cassert>
 #include <iomanip>
 #include <ios>
 #include <sstream>
@@ -10,8 +11,9 @@ using namespace aff3ct;
 using namespace aff3ct::tools;
 
 template<typename B>
-Reporter_BFER<B>::Reporter_BFER(const M& monitor)
+Reporter_BFER<B>::Reporter_BFER(const M& monitor, const bool weighted)
   : Rm(monitor)
+  , weighted(weighted)
 {
     create_groups();
 }
@@ -31,6 +33,20 @@ Reporter_BFER<B>::create_groups()
     BFER_cols.push_back(std::make_tuple("FER", "", 0));
 
     this->cols_groups.push_back(this->monitor_group);
+
+    if (this->weighted)
+    {
+        auto& IS_title = this->weighted_group.first;
+        auto& IS_cols = this->weighted_group.second;
+
+        IS_title = { "Importance Sampling (IS)", "weighted BER and FER", 0 };
+        IS_cols.push_back(std::make_tuple("IS-BER", "", 0));
+        IS_cols.push_back(std::make_tuple("CI 95%", "(+/-)", 0));
+        IS_cols.push_back(std::make_tuple("IS-FER", "", 0));
+        IS_cols.push_back(std::make_tuple("CI 95%", "(+/-)", 0));
+
+        this->cols_groups.push_back(this->weighted_group);
+    }
 }
 
 std::string
@@ -50,7 +66,7 @@ template<typename B>
 typename Reporter_BFER<B>::report_t
 Reporter_BFER<B>::report(bool final)
 {
-    assert(this->cols_groups.size() == 1);
+    assert(this->cols_groups.size() == (this->weighted ? 2 : 1));
 
     report_t the_report(this->cols_groups.size());
 
@@ -67,6 +83,22 @@ Reporter_BFER<B>::report(bool final)
     bfer_report.push_back(str_ber.str());
     bfer_report.push_back(str_fer.str());
 
+    if (this->weighted)
+    {
+        auto& is_report = the_report[1];
+
+        std::stringstream str_wber, str_wber_ci, str_wfer, str_wfer_ci;
+        str_wber << std::setprecision(2) << std::scientific << this->monitor.get_weighted_ber();
+        str_wber_ci << std::setprecision(2) << std::scientific << this->monitor.get_weighted_ber_ci();
+        str_wfer << std::setprecision(2) << std::scientific << this->monitor.get_weighted_fer();
+        str_wfer_ci << std::setprecision(2) << std::scientific << this->monitor.get_weighted_fer_ci();
+
+        is_report.push_back(str_wber.str());
+        is_report.push_back(str_wber_ci.str());
+        is_report.push_back(str_wfer.str());
+        is_report.push_back(str_wfer_ci.str());
+    }
+
     return the_report;
 }
 
@@ -3,8 +3,10 @@
 #include <cstdint>
 #include <limits>
 #include <map>
+#include <random>
 #include <sstream>
 #include <streampu.hpp>
+#include <thread>
 
 #include "Tools/general_utils.h"
 
@@ -43,6 +45,15 @@ aff3ct::tools::getline(std::istream& file, std::string& line)
         if (line[0] != '#' && !std::all_of(line.begin(), line.end(), isspace)) break;
 }
 
+std::string
+aff3ct::tools::unique_tmp_path(const std::string& path)
+{
+    // the thread id distinguishes the threads of a process, the random number the processes
+    std::stringstream tmp_path;
+    tmp_path << path << ".tmp." << std::hex << std::random_device()() << "." << std::this_thread::get_id();
+    return tmp_path.str();
+}
+
 template<typename R>
 R
 aff3ct::tools::sigma_to_esn0(const R sigma, const int upsample_factor)